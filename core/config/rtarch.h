@@ -245,8 +245,10 @@
  * 16/8-bit subsets are both self-consistent within themselves, their results
  * cannot be used in larger subsets without proper sign/zero-extend bridges,
  * cmdhn/hz and cmdbn/bz bridges for 16/8-bit are provided in 32-bit headers.
- * The results of 8-bit subset cannot be used within 16-bit subset consistently.
- * There is no sign/zero-extend bridge from 8-bit to 16-bit, use 32-bit instead.
+ * The results of 8-bit subset cannot be used within 16-bit subset consistently
+ * without mvbhn/hz bridges from 8-bit to 16-bit provided in 16/8-bit headers.
+ * Loads with sign/zero-extend (movhn/hz_ld, movbn/bz_ld, mvbhn/hz_ld) fold
+ * the bridge into the load itself, saving an op per element in byte parsers.
  *
  * 32-bit and 64-bit BASE subsets are not easily compatible on all targets,
  * thus any register modified with 32-bit op cannot be used in 64-bit subset.
@@ -282,6 +284,11 @@
  * In this model data paths are fixed-width, BASE and SIMD data elements are
  * width-compatible, code path divergence is handled via mkj**_** pseudo-ops.
  * Matching element-sized BASE subset cmdy*_** is defined in rtconf.h as well.
+ * Mask-jumps (mkj/mxj) use an internal register on ARM and x64 targets (r15)
+ * and leave all BASE registers intact, legacy x86 has no spare register and
+ * mkj**_rx (CHECK_MASK) destroys Reax there, use mkj**_rk to keep Reax intact
+ * (it saves/restores Reax on legacy x86, same as mkj**_rx on other targets).
+ * For index registers other than Reax use S***(R) or N***(R,n) addressing.
  *
  * Note, when using fixed-data-size 128/256-bit SIMD subsets simultaneously
  * upper 128-bit halves of full 256-bit SIMD registers may end up undefined.
@@ -342,6 +349,7 @@
 #define RT_SIMD_COMPAT_FMR_MASTER       0 /* for fm*ps_** rounding mode (x86) */
 #define RT_SIMD_COMPAT_DAZ_MASTER       1 /* DAZ for flush-to-zero mode (x86) */
 #define RT_SIMD_FLUSH_ZERO_MASTER       0 /* optional on MIPS and POWER */
+#define RT_SIMD_INTERLEAVE_MASTER       0 /* optional on AArch64 and POWER */
 
 /*
  * Determine maximum of available SIMD registers for applications' code-bases.
@@ -727,6 +735,12 @@
 #define RT_SIMD_COMPAT_FMS      RT_SIMD_COMPAT_FMS_MASTER
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/* RT_SIMD_INTERLEAVE when enabled issues multi-instruction composites
+ * round-robin across halves of SIMD pairs/quads instead of half by half */
+#ifndef RT_SIMD_INTERLEAVE
+#define RT_SIMD_INTERLEAVE      RT_SIMD_INTERLEAVE_MASTER
+#endif /* RT_SIMD_INTERLEAVE */
+
 #if   (RT_2K8X1 >= 1) && (RT_SIMD == 2048) && (RT_REGS <= 32)
 #include "rtarch_a64_SVEx1v1.h"
 #elif (RT_1K4X2 != 0) && (RT_SIMD == 2048) && (RT_REGS <= 16)
@@ -1314,6 +1328,12 @@
 #define RT_SIMD_COMPAT_SQR      RT_SIMD_COMPAT_SQR_MASTER
 #endif /* RT_SIMD_COMPAT_SQR */
 
+/* RT_SIMD_INTERLEAVE when enabled issues multi-instruction composites
+ * round-robin across halves of SIMD pairs/quads instead of half by half */
+#ifndef RT_SIMD_INTERLEAVE
+#define RT_SIMD_INTERLEAVE      RT_SIMD_INTERLEAVE_MASTER
+#endif /* RT_SIMD_INTERLEAVE */
+
 /* RT_SIMD_COMPAT_PW8 when enabled picks IBM POWER8 ISA variant
  * on top of default POWER7 ISA, only POWER8 is LE-qualified */
 #ifndef RT_SIMD_COMPAT_PW8
@@ -1576,7 +1596,7 @@
 #if   (defined RT_X32)
 
 #define label_ld(lb)/*Reax*/                                                \
-        ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
+        ASM_BEG ASM_OP2(leaq, %%rax, lb(%%rip)) ASM_END
 
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
@@ -1587,7 +1607,7 @@
 #elif (defined RT_X64)
 
 #define label_ld(lb)/*Reax*/                                                \
-        ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
+        ASM_BEG ASM_OP2(leaq, %%rax, lb(%%rip)) ASM_END
 
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
@@ -1658,6 +1678,24 @@
 #define RT_SIMD_COMPAT_FMR      RT_SIMD_COMPAT_FMR_MASTER
 #endif /* RT_SIMD_COMPAT_FMR */
 
+/* RT_BASE_COMPAT_HEAP when enabled changes 64/32-bit hybrid mode
+ * (RT_POINTER=64, RT_ADDRESS=32) from the low-4GB address window
+ * to 32-bit offsets from a per-thread heap base held in GS segment base,
+ * which is added to in-heap addresses by the AGU without extra instructions.
+ * The heap (up to 4GB) must be aligned to 4GB boundary, so that the lower
+ * halves of 64-bit pointers into it are equal to respective offsets, thus
+ * C/C++ code keeps full 64-bit pointers and ASM sections (including Info)
+ * see 32-bit offsets. Each thread running ASM sections sets its GS base
+ * to the start of the heap (Linux: arch_prctl(ARCH_SET_GS, base)) upfront.
+ * Not available on Windows and macOS, where GS is taken by the system */
+#ifndef RT_BASE_COMPAT_HEAP
+#define RT_BASE_COMPAT_HEAP     0 /* 0 - low-4GB window, 1 - GS-based heap */
+#endif /* RT_BASE_COMPAT_HEAP */
+
+#if (RT_BASE_COMPAT_HEAP != 0) && (defined RT_X32)
+#error "x86_64: heap-based addressing is only for hybrid x64, check flags"
+#endif /* RT_BASE_COMPAT_HEAP */
+
 /* RT_BASE_COMPAT_BMI when enabled changes the default behavior
  * of some bit-manipulation instructions to use BMI variants */
 #ifdef  RT_SIMD_CODE
@@ -2511,6 +2549,33 @@
 
 #endif /* OS, COMPILER, ARCH */
 
+/*
+ * The ASM_ENTER_S/ASM_LEAVE_S versions share the traits of the original ones,
+ * except that they also allocate a section-local stack frame of given size
+ * (rounded up to 16 bytes, aligned to RT_SIMD_ALIGN) addressable via Mesp.
+ * As the frame is private to the calling thread, it can hold spills and
+ * temporaries which otherwise would go to inf_SCR01/inf_SCR02 or to extra
+ * fields of the Info structure shared between all callers. The same size
+ * must be passed to both ASM_ENTER_S and ASM_LEAVE_S of the given section.
+ * Mesp is SP-relative, therefore stack_st/stack_ld (also used internally
+ * by some BASE instructions on legacy x86) mustn't be mixed with it.
+ * Internal SIMD temps never move SP (256-bit NEON pairs with
+ * RT_SIMD_COMPAT_XMM=0 spill them to the Info structure instead).
+ * Frame size is limited by native displacement range (DP at Q=1 on ARMv7).
+ * In 64/32-bit hybrid mode on AArch64 and MIPS64 address computations from
+ * SP are always 64-bit, as the stack may reside above 4GB, thus adrxx_ld
+ * from Mesp yields a full 64-bit pointer, which is only valid as a base.
+ * Mesp isn't available with RT_BASE_COMPAT_HEAP (GS-based heap on x64).
+ */
+
+#define ASM_ENTER_S(__Info__, __Size__)                                     \
+        ASM_ENTER(__Info__)                                                 \
+        stack_fa((((__Size__) + 0x0F) & -0x10))
+
+#define ASM_LEAVE_S(__Info__, __Size__)                                     \
+        stack_fl((((__Size__) + 0x0F) & -0x10))                             \
+        ASM_LEAVE(__Info__)
+
 #endif /* RT_RTARCH_H */
 
 /******************************************************************************/
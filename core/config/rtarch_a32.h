@@ -51,6 +51,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -167,6 +169,9 @@
 
 #define ADR ((A-1)*0x80000000)
 
+/* address add is 64-bit when base is SP (Mesp), even in 64/32-bit hybrid */
+#define ADS(br) (ADR | (M((br) == SPxx) & 0x80000000))
+
 #define EMPTY1(em1) em1
 #define EMPTY2(em1, em2) em1 em2
 
@@ -254,7 +259,7 @@
 #define P11(dp) (0x00206800 | TDxx << 16)
 #define C11(br, dp) C31(br, dp)
 #define A11(br, dp) C31(br, dp)                                             \
-                    EMITW(0x0B000000 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x0B206000 | MRM(TPxx,    (br),    TDxx) | ADS(br))
 #define C31(br, dp) EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) |        \
                              (0xFFFF & (dp)) << 5)
 
@@ -263,7 +268,7 @@
 #define P12(dp) (0x00206800 | TDxx << 16)
 #define C12(br, dp) C32(br, dp)
 #define A12(br, dp) C32(br, dp)                                             \
-                    EMITW(0x0B000000 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x0B206000 | MRM(TPxx,    (br),    TDxx) | ADS(br))
 #define C32(br, dp) EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) |        \
                              (0xFFFF & (dp)) << 5)                          \
                     EMITW(0x72A00000 | MRM(TDxx,    0x00,    0x00) |        \
@@ -299,6 +304,10 @@
 #define TEgD    0x0D  /* x13 */
 #define TEgE    0x0E  /* x14 */
 
+/* internal BASE register, used in place of Reax in mkj/mxj (SIMD masks) */
+
+#define RMxx    TMxx, 0x00, EMPTY
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -323,6 +332,7 @@
 /* addressing   REG,  MOD,  SIB */
 
 #define Oeax    TEax, TEax, EMPTY
+#define Meax    TEax, TEax, EMPTY       /* internal (sregs) */
 
 #define Mecx    TEcx, TEcx, EMPTY
 #define Medx    TEdx, TEdx, EMPTY
@@ -338,6 +348,10 @@
 #define MegD    TEgD, TEgD, EMPTY
 #define MegE    TEgE, TEgE, EMPTY
 
+/* section-local frame from ASM_ENTER_S, SP-relative (see rtarch.h) */
+
+#define Mesp    SPxx, SPxx, EMPTY
+
 /* public scalable I/J/K/L*** definitions are now provided in rtbase.h */
 /* public scalable S/T/U/V*** definitions accept any register as index */
 /* fully explicit N*** takes index register and scale (1,2,3) for 2x/4x/8x */
@@ -396,6 +410,12 @@
 #define _DV(dp) ((dp) & 0x7FFFFFFF),    2, 2       /* native x86_64 long mode */
 #define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
 
+/* widest displacement of each TP1/TP2 type, checked in burst ld/st */
+
+#define DL00    0xFFF
+#define DL10    0xFFFF
+#define DL22    0x7FFFFFFF
+
 #elif RT_BASE == 2
 
 #define _DP(dp) ((dp) & 0xFFE),         0, 0      /* native on all ARMs, MIPS */
@@ -406,6 +426,12 @@
 #define _DV(dp) ((dp) & 0x7FFFFFFE),    2, 2       /* native x86_64 long mode */
 #define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
 
+/* widest displacement of each TP1/TP2 type, checked in burst ld/st */
+
+#define DL00    0x1FFE
+#define DL10    0xFFFE
+#define DL22    0x7FFFFFFE
+
 #elif RT_BASE == 4
 
 #define _DP(dp) ((dp) & 0xFFC),         0, 0      /* native on all ARMs, MIPS */
@@ -416,6 +442,12 @@
 #define _DV(dp) ((dp) & 0x7FFFFFFC),    2, 2       /* native x86_64 long mode */
 #define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
 
+/* widest displacement of each TP1/TP2 type, checked in burst ld/st */
+
+#define DL00    0x3FFC
+#define DL10    0xFFFC
+#define DL22    0x7FFFFFFC
+
 #elif RT_BASE == 8
 
 #define _DP(dp) ((dp) & 0xFF8),         0, 0      /* native on all ARMs, MIPS */
@@ -426,12 +458,32 @@
 #define _DV(dp) ((dp) & 0x7FFFFFF8),    2, 2       /* native x86_64 long mode */
 #define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
 
+/* widest displacement of each TP1/TP2 type, checked in burst ld/st */
+
+#define DL00    0x7FF8
+#define DL10    0xFFF8
+#define DL22    0x7FFFFFF8
+
 #endif /* RT_BASE */
 
 /* triplet pass-through wrapper */
 
 #define W(p1, p2, p3)       p1,  p2,  p3
 
+/* displacement pass-through advancer, used in SIMD burst ld/st
+ * keeps TP1/TP2 of the original displacement, DNCHK fails at assembly time
+ * if the advanced value no longer fits the widest displacement of its type */
+
+#define DN(dn, val, tp1, tp2)  ((val) + (dn)), tp1, tp2
+
+#define DNCHK(dn, val, tp1, tp2)                                            \
+        DNERR(((val) + (dn)) > DL##tp1##tp2)
+
+#define DNERR(cond) /* not portable, do not use outside */                  \
+        ASM_BEG ASM_OP1(.if, cond) ASM_END                                  \
+        ASM_BEG ASM_OP1(.error, "burst displacement overflow") ASM_END      \
+        ASM_BEG ASM_OP0(.endif) ASM_END
+
 /******************************************************************************/
 /**********************************   BASE   **********************************/
 /******************************************************************************/
@@ -812,6 +864,16 @@
         EMITW(0x2A200000 | MRM(TMxx,    TZxx,    TMxx))                     \
         EMITW(0xB8000000 | MDM(TMxx,    MOD(MG), VAL(DG), B1(DG), P1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswwx_rx(RG)                                                        \
+        EMITW(0x5AC00800 | MRM(REG(RG), REG(RG), 0x00))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1752,6 +1814,9 @@
 #define rdvla_xx() /* destroys Reax, rdvl to Reax only available on SVE */  \
         EMITV(0x04BF5020 | TEax)    /* not portable, do not use outside */
 
+#define rdzfr_xx() /* destroys Recx, ID_AA64ZFR0_EL1 to Recx on SVE only */ \
+        EMITV(0xD5380480 | TEcx)    /* not portable, do not use outside */
+
 #define verxx_xx() /* destroys Reax, Recx, Rebx, Redx, Resi, Redi */        \
         /* request SVE:vector-length in bytes */                            \
         movwx_ri(Reax, IB(0))                                               \
@@ -1786,7 +1851,16 @@
         andwx_ri(Recx, IB(16))                                              \
         shlwx_ri(Recx, IB(26))                                              \
         orrwx_rr(Resi, Recx)  /* 2K8-bit to RT_2K8=4 */                     \
-        andwx_ri(Resi, IV(0x5515174F)) /* NEON: 0,1,2,3,6,8,9; SVE: rest */ \
+        movwx_ri(Recx, IB(0))                                               \
+        rdzfr_xx()    /* get SVE2 version */                                \
+        andwx_ri(Recx, IB(15))                                              \
+        negwx_rx(Recx)                                                      \
+        shrwx_ri(Recx, IB(31)) /* SVE2 to 1 */                              \
+        movwx_rr(Redx, Resi)                                                \
+        andwx_ri(Redx, IV(0x44040400)) /* SVEx1 bits from above */          \
+        shlwx_rx(Redx)        /* SVE2: RT_***=8, no SVE2 for pairs */       \
+        orrwx_rr(Resi, Redx)                                                \
+        andwx_ri(Resi, IV(0xDD1D1F4F)) /* NEON: 0,1,2,3,6,8,9; SVE: rest */ \
         movwx_st(Resi, Mebp, inf_VER)
 
 /************************* address-sized instructions *************************/
@@ -1796,7 +1870,7 @@
 
 #define adrxx_ld(RD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
-        EMITW(0x0B000000 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
+        EMITW(0x0B206000 | MRM(REG(RD), MOD(MS), TDxx) | ADS(MOD(MS)))
 
 /************************* pointer-sized instructions *************************/
 
@@ -1913,6 +1987,42 @@
         EMITW(0xA8C10000 | MRM(TEdx,    SPxx,    0x00) | TEbx << 10)        \
         EMITW(0xA8C10000 | MRM(TEax,    SPxx,    0x00) | TEcx << 10)
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        EMITW(0x91000000 | MRM(TEax,    SPxx,    0x00))                     \
+        EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) |                    \
+                             (0xFFFF & ((sz) + 0x08)) << 5)                 \
+        EMITW(0xCB206000 | MRM(TDxx,    SPxx,    TDxx))                     \
+        EMITW(0x52800000 | MRM(TPxx,    0x00,    0x00) |                    \
+                             (0xFFFF & (RT_SIMD_ALIGN-1)) << 5)             \
+        EMITW(0x8A200000 | MRM(TDxx,    TDxx,    TPxx))                     \
+        EMITW(0x91000000 | MRM(SPxx,    TDxx,    0x00))                     \
+        EMITW(0xF9000000 | MRM(TEax,    SPxx,    0x00) |                    \
+                             (0x7FF8 & (sz)) << 7)
+
+#define stack_fl(sz)                                                        \
+        EMITW(0xF9400000 | MRM(TDxx,    SPxx,    0x00) |                    \
+                             (0x7FF8 & (sz)) << 7)                          \
+        EMITW(0x91000000 | MRM(SPxx,    TDxx,    0x00))
+
+/* internal definitions for mask-to-index (mln) in SIMD byte subsets,
+ * ctozx_rx: G = count of trailing 1s in 64-bit nibble-mask G over 4 (0..16),
+ * ctozx_rr: G = S + G if S == 16 else S, S is the count of preceding part */
+
+#define ctozx_rx(RG)         /* not portable, do not use outside */         \
+        EMITW(0xAA200000 | MRM(REG(RG), TZxx,    REG(RG)))                  \
+        EMITW(0xDAC00000 | MRM(REG(RG), REG(RG), 0x00))                     \
+        EMITW(0xDAC01000 | MRM(REG(RG), REG(RG), 0x00))                     \
+        EMITW(0xD342FC00 | MRM(REG(RG), REG(RG), 0x00))
+
+#define ctozx_rr(RG, RS)     /* not portable, do not use outside */         \
+        EMITW(0x0B000000 | MRM(REG(RG), REG(RG), REG(RS)))                  \
+        EMITW(0x7100401F | MRM(0x00,    REG(RS), 0x00))                     \
+        EMITW(0x1A800000 | MRM(REG(RG), REG(RG), REG(RS)))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -1948,6 +2058,31 @@
 #define CMJ(cc, lb)                                                         \
         cc(lb)
 
+/* internal definitions for fp-compare-jump (cmj), fcmp reports
+ * unordered (NaN) operands as NZCV = 0011, signed GT/GE conditions are used
+ * for GT_x, GE_x (only NE_x jumps on NaN as in C) */
+
+#define Fjeqxx_lb(lb)                                                       \
+        jeqxx_lb(lb)
+
+#define Fjnexx_lb(lb)                                                       \
+        jnexx_lb(lb)
+
+#define Fjltxx_lb(lb)                                                       \
+        jltxx_lb(lb)
+
+#define Fjlexx_lb(lb)                                                       \
+        jlexx_lb(lb)
+
+#define Fjgtxx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(b.gt, lb) ASM_END
+
+#define Fjgexx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(b.ge, lb) ASM_END
+
+#define CMF(cc, lb)                                                         \
+        F##cc(lb)
+
 #endif /* RT_RTARCH_A32_H */
 
 /******************************************************************************/
@@ -158,7 +158,7 @@
 #define C21(br, dp) EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) |        \
                              (0xFFF0 & (dp)) << 5)
 #define A21(br, dp) C21(br, dp)                                             \
-                    EMITW(0x0B000000 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x0B206000 | MRM(TPxx,    (br),    TDxx) | ADS(br))
 
 #define B22(br) (br)
 #define B42(br) TPxx
@@ -169,7 +169,28 @@
                     EMITW(0x72A00000 | MRM(TDxx,    0x00,    0x00) |        \
                              (0x7FFF & (dp) >> 16) << 5)
 #define A22(br, dp) C22(br, dp)                                             \
-                    EMITW(0x0B000000 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x0B206000 | MRM(TPxx,    (br),    TDxx) | ADS(br))
+
+/* burst address in TPxx for ldp/stp, ld1/st1 (no offset) BASE(TP1) */
+
+#define  U1(val, tp1, tp2)  U1##tp1
+
+#if RT_BASE == 1
+
+#define U10(br, dp) EMITW(0x11000000 | MRM(TPxx,    (br),    0x00) |        \
+                             ADS(br) | (0xFFF & (dp)) << 10)
+
+#else  /* RT_BASE != 1, BASE native range exceeds 12-bit in TP1 == 0 */
+
+#define U10(br, dp) EMITW(0x11000000 | MRM(TPxx,    (br),    0x00) |        \
+                             ADS(br) | (0xFFF & (dp)) << 10)                \
+                    EMITW(0x11400000 | MRM(TPxx,    TPxx,    0x00) |        \
+                             ADS(br) | (0xFFF & (dp) >> 12) << 10)
+
+#endif /* RT_BASE */
+
+#define U11(br, dp) A11(br, dp)
+#define U12(br, dp) A12(br, dp)
 
 /* registers    REG   (check mapping with ASM_ENTER/ASM_LEAVE in rtarch.h) */
 
@@ -177,6 +198,40 @@
 #define TmmQ    0x0F  /* v15, internal name for all-ones */
 #define TmmM    0x1F  /* v31, temp-reg name for mem-args */
 
+/* RT_SIMD_COMPAT_XMM == 0 exposes XmmF (v15+v31) in 256-bit NEON pairs,
+ * in which case temps are spilled to the Info structure around their use
+ * (16-byte slot at 0x010 inside fctrl[], which is not used on ARM targets),
+ * SP is left untouched, so temps don't interfere with SP-relative Mesp,
+ * upper halves of pair-ops then switch to TmmN as TmmM is part of XmmF */
+
+#if (RT_SIMD == 256) && !(defined RT_SVEX1) && (RT_SIMD_COMPAT_XMM == 0)
+
+#define TmmN    0x0F  /* v15, temp-reg name for mem-args (upper half) */
+
+#define EMITX(w)    EMITW(w)
+
+/* check that the 16-byte temp slot at 0x010 fits inside fctrl[] */
+typedef rt_si08 rt_A32_SPILL_CHECK[(0x00C +
+        sizeof(((struct rt_SIMD_INFO *)0)->fctrl) >= 0x020) ? 1 : -1];
+
+#else  /* RT_SIMD_COMPAT_XMM != 0 */
+
+#define TmmN    0x1F  /* v31, temp-reg name for mem-args (upper half) */
+
+#define EMITX(w) /* EMPTY */
+
+#endif /* RT_SIMD_COMPAT_XMM */
+
+#define STT(tm) /* save temp tm */                                          \
+        EMITX(0x3D800400 | MXM(tm,      TEbp,    0x00))
+
+#define SWT(tm, tn) /* restore temp tm, save temp tn */                     \
+        EMITX(0x3DC00400 | MXM(tm,      TEbp,    0x00))                     \
+        EMITX(0x3D800400 | MXM(tn,      TEbp,    0x00))
+
+#define LDT(tn) /* restore temp tn */                                       \
+        EMITX(0x3DC00400 | MXM(tn,      TEbp,    0x00))
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -200,9 +255,14 @@
 #define XmmE    0x0E, 0x00, EMPTY       /* v14 */
 
 /* only for 128-bit instructions (save/restore in 256-bit header)
- * provided as an extension to common baseline of 15 registers */
+ * provided as an extension to common baseline of 15 registers,
+ * XmmF is v15 (lower half of 256-bit XmmF) if RT_SIMD_COMPAT_XMM == 0 */
 
+#if (RT_SIMD == 256) && !(defined RT_SVEX1) && (RT_SIMD_COMPAT_XMM == 0)
+#define XmmF    0x0F, 0x00, EMPTY       /* v15 */
+#else  /* RT_SIMD_COMPAT_XMM != 0 */
 #define XmmF    0x1E, 0x00, EMPTY       /* v30 */
+#endif /* RT_SIMD_COMPAT_XMM */
 #define XmmG    0x10, 0x00, EMPTY       /* v16 */
 #define XmmH    0x11, 0x00, EMPTY       /* v17 */
 #define XmmI    0x12, 0x00, EMPTY       /* v18 */
@@ -243,6 +303,43 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+/* mov (D = S), burst of 2/4 registers to/from consecutive memory slots
+ * ldp/stp take any register pair, ld1/st1 need consecutive registers,
+ * 4-register bursts fall back to two ldp/stp at assembly time if not */
+
+#define RT_SIMD_BURST_128       1
+
+#define movix2ld(XD, XE, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), U1(DS), EMPTY2)   \
+        EMITW(0xAD400000 | MXM(REG(XD), TPxx,    0x00) | REG(XE) << 10)
+
+#define movix2st(XS, XT, MD, DD)                                            \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), U1(DD), EMPTY2)   \
+        EMITW(0xAD000000 | MXM(REG(XS), TPxx,    0x00) | REG(XT) << 10)
+
+#define movix4ld(XD, XE, XF, XG, MS, DS)                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), U1(DS), EMPTY2)   \
+        MV4IF(REG(XD), REG(XE), REG(XF), REG(XG))                           \
+        EMITW(0x4C402800 | MXM(REG(XD), TPxx,    0x00))                     \
+        ASM_BEG ASM_OP0(.else) ASM_END                                      \
+        EMITW(0xAD400000 | MXM(REG(XD), TPxx,    0x00) | REG(XE) << 10)     \
+        EMITW(0xAD400000 | MXM(REG(XF), TPxx,    0x01) | REG(XG) << 10)     \
+        ASM_BEG ASM_OP0(.endif) ASM_END
+
+#define movix4st(XS, XT, XU, XV, MD, DD)                                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), U1(DD), EMPTY2)   \
+        MV4IF(REG(XS), REG(XT), REG(XU), REG(XV))                           \
+        EMITW(0x4C002800 | MXM(REG(XS), TPxx,    0x00))                     \
+        ASM_BEG ASM_OP0(.else) ASM_END                                      \
+        EMITW(0xAD000000 | MXM(REG(XS), TPxx,    0x00) | REG(XT) << 10)     \
+        EMITW(0xAD000000 | MXM(REG(XU), TPxx,    0x01) | REG(XV) << 10)     \
+        ASM_BEG ASM_OP0(.endif) ASM_END
+
+#define MV4IF(r0, r1, r2, r3) /* not portable, do not use outside */        \
+        ASM_BEG ASM_OP1(.if, (((r1) - (r0)) & 31) == 1 &&                   \
+                             (((r2) - (r0)) & 31) == 2 &&                   \
+                             (((r3) - (r0)) & 31) == 3) ASM_END
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -251,14 +348,18 @@
 
 #define mmvix_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))
+        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
+        LDT(TmmM)
 
 #define mmvix_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
-        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
+        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
+        LDT(TmmM)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
@@ -273,8 +374,10 @@
 
 #define andix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ann (G = ~G & S), (D = ~S & T) if (#D != #T) */
 
@@ -289,8 +392,10 @@
 
 #define annix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* orr (G = G | S), (D = S | T) if (#D != #T) */
 
@@ -305,8 +410,10 @@
 
 #define orrix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* orn (G = ~G | S), (D = ~S | T) if (#D != #T) */
 
@@ -321,8 +428,10 @@
 
 #define ornix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* xor (G = G ^ S), (D = S ^ T) if (#D != #T) */
 
@@ -337,8 +446,10 @@
 
 #define xorix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* not (G = ~G), (D = ~S) */
 
@@ -371,8 +482,10 @@
 
 #define addis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E20D400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E20D400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -384,8 +497,10 @@
 #undef  adpis3ld
 #define adpis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E20D400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E20D400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -400,8 +515,10 @@
 
 #define subis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA0D400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA0D400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -416,8 +533,10 @@
 
 #define mulis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E20DC00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E20DC00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -435,8 +554,10 @@
 
 #define divis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E20FC00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E20FC00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sqr (D = sqrt S) */
 
@@ -445,8 +566,10 @@
 
 #define sqris_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA1F800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EA1F800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cbr (D = cbrt S) */
 
@@ -499,8 +622,10 @@
 
 #define fmais_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E20CC00 | MXM(REG(XG), REG(XS), TmmM))
+        EMITW(0x4E20CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMA */
 
@@ -515,8 +640,10 @@
 
 #define fmsis_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA0CC00 | MXM(REG(XG), REG(XS), TmmM))
+        EMITW(0x4EA0CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
@@ -535,8 +662,10 @@
 
 #define minis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA0F400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA0F400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -554,8 +683,10 @@
 
 #define maxis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E20F400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E20F400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -573,8 +704,10 @@
 
 #define ceqis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E20E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -590,8 +723,10 @@
 
 #define cneis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -607,8 +742,10 @@
 
 #define cltis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA0E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6EA0E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -623,8 +760,10 @@
 
 #define cleis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E20E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6E20E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -639,8 +778,10 @@
 
 #define cgtis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA0E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA0E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -655,20 +796,27 @@
 
 #define cgeis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E20E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE32_128     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_128     0x04    /*  all satisfy the condition */
 
-#define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjix_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4EB1B800 | MXM(TmmM,    REG(XS), 0x00))                     \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##32_128))                     \
         jezxx_lb(lb)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -681,16 +829,20 @@
 
 #define rnzis_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EA19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvzis_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x4EA1B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvzis_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EA1B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EA1B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvp (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -702,16 +854,20 @@
 
 #define rnpis_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EA18800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EA18800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvpis_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x4EA1A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvpis_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EA1A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EA1A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvm (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -723,16 +879,20 @@
 
 #define rnmis_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E219800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E219800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvmis_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x4E21B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvmis_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E21B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E21B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvn (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -744,16 +904,20 @@
 
 #define rnnis_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E218800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E218800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvnis_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x4E21A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvnis_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E21A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E21A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvt (D = fp-to-signed-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -766,8 +930,10 @@
 
 #define rndis_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvtis_rr(XD, XS)                                                    \
         rndis_rr(W(XD), W(XS))                                              \
@@ -810,8 +976,10 @@
 
 #define cvtin_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E21D800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E21D800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvn (D = unsigned-int-to-fp S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks) */
@@ -831,8 +999,10 @@
 
 #define cvtix_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E21D800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E21D800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
@@ -844,16 +1014,20 @@
 
 #define ruzis_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EA19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cuzis_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x6EA1B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cuzis_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA1B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EA1B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cup (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -865,16 +1039,20 @@
 
 #define rupis_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EA18800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EA18800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cupis_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x6EA1A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cupis_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA1A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EA1A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cum (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -886,16 +1064,20 @@
 
 #define rumis_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E219800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E219800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cumis_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x6E21B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cumis_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E21B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E21B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cun (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -907,16 +1089,20 @@
 
 #define runis_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E218800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E218800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cunis_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x6E21A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cunis_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E21A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E21A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cut (D = fp-to-unsigned-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -929,8 +1115,10 @@
 
 #define rudis_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cutis_rr(XD, XS)                                                    \
         rudis_rr(W(XD), W(XS))                                              \
@@ -970,8 +1158,10 @@
 
 #define addix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA08400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA08400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -986,8 +1176,10 @@
 
 #define subix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA08400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA08400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -1002,8 +1194,10 @@
 
 #define mulix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA09C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA09C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -1024,9 +1218,11 @@
 
 #define shlix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E040400 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1044,10 +1240,12 @@
 
 #define shrix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E040400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1065,10 +1263,12 @@
 
 #define shrin3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E040400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1084,8 +1284,10 @@
 
 #define svlix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1097,14 +1299,18 @@
         svrix3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrix3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EA0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1116,14 +1322,27 @@
         svrin3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrin3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EA0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrin3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
+
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswix_rr(XD, XS)                                                    \
+        EMITW(0x6E200800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
 
 /****************   packed single-precision integer compare   *****************/
 
@@ -1140,8 +1359,10 @@
 
 #define minix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA06C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA06C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), signed */
 
@@ -1156,8 +1377,10 @@
 
 #define minin3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA06C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA06C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), unsigned */
 
@@ -1172,8 +1395,10 @@
 
 #define maxix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA06400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA06400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), signed */
 
@@ -1188,8 +1413,10 @@
 
 #define maxin3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA06400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA06400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -1204,8 +1431,10 @@
 
 #define ceqix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1221,8 +1450,10 @@
 
 #define cneix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -1238,8 +1469,10 @@
 
 #define cltix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA03400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6EA03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -1254,8 +1487,10 @@
 
 #define cltin3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA03400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4EA03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1270,8 +1505,10 @@
 
 #define cleix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1286,8 +1523,10 @@
 
 #define clein3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1302,8 +1541,10 @@
 
 #define cgtix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA03400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA03400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -1318,8 +1559,10 @@
 
 #define cgtin3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA03400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA03400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1334,8 +1577,10 @@
 
 #define cgeix3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EA03C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EA03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1350,8 +1595,10 @@
 
 #define cgein3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA03C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /******************************************************************************/
 /**********************************   ELEM   **********************************/
@@ -1385,8 +1632,10 @@
 
 #define addrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E202800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E202800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -1401,8 +1650,10 @@
 
 #define subrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E203800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E203800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -1417,8 +1668,10 @@
 
 #define mulrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E200800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E200800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
@@ -1433,8 +1686,10 @@
 
 #define divrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E201800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E201800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sqr (D = sqrt S) */
 
@@ -1443,8 +1698,10 @@
 
 #define sqrrs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
-        EMITW(0x1E21C000 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x1E21C000 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -1492,8 +1749,10 @@
 
 #define fmars_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1F000000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)
+        EMITW(0x1F000000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMA */
 
@@ -1508,8 +1767,10 @@
 
 #define fmsrs_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1F008000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)
+        EMITW(0x1F008000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
@@ -1528,8 +1789,10 @@
 
 #define minrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E205800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E205800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
@@ -1544,8 +1807,10 @@
 
 #define maxrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E204800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E204800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -1560,8 +1825,10 @@
 
 #define ceqrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x5E20E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x5E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1577,8 +1844,10 @@
 
 #define cners3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
         EMITW(0x5E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -1594,8 +1863,10 @@
 
 #define cltrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7EA0E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x7EA0E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -1610,8 +1881,10 @@
 
 #define clers3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7E20E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x7E20E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -1626,8 +1899,10 @@
 
 #define cgtrs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7EA0E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x7EA0E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -1642,8 +1917,19 @@
 
 #define cgers3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xBC400000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7E20E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x7E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
+
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        EMITW(0x1E202000 | MXM(0x00,    REG(XS), REG(XT)))                  \
+        CMF(cc, lb)
 
 /******************************************************************************/
 /**********************************   MODE   **********************************/
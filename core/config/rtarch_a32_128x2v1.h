@@ -123,7 +123,7 @@
 
 #if (defined RT_SIMD_CODE)
 
-#if (RT_128X2 != 0) && (RT_SIMD_COMPAT_XMM > 0)
+#if (RT_128X2 != 0)
 
 #ifndef RT_RTARCH_A64_128X1V1_H
 #undef  RT_128X1
@@ -163,6 +163,35 @@
         EMITW(0x3D800000 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x3D800000 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+/* mov (D = S), burst of 2/4 registers to/from consecutive memory slots
+ * one ldp/stp of (lo, hi) halves per register, any registers */
+
+#define RT_SIMD_BURST_256       1
+
+#define movcx2ld(XD, XE, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), U1(DS), EMPTY2)   \
+        EMITW(0xAD400000 | MXM(REG(XD), TPxx,    0x00) | RYG(XD) << 10)     \
+        EMITW(0xAD400000 | MXM(REG(XE), TPxx,    0x01) | RYG(XE) << 10)
+
+#define movcx2st(XS, XT, MD, DD)                                            \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), U1(DD), EMPTY2)   \
+        EMITW(0xAD000000 | MXM(REG(XS), TPxx,    0x00) | RYG(XS) << 10)     \
+        EMITW(0xAD000000 | MXM(REG(XT), TPxx,    0x01) | RYG(XT) << 10)
+
+#define movcx4ld(XD, XE, XF, XG, MS, DS)                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), U1(DS), EMPTY2)   \
+        EMITW(0xAD400000 | MXM(REG(XD), TPxx,    0x00) | RYG(XD) << 10)     \
+        EMITW(0xAD400000 | MXM(REG(XE), TPxx,    0x01) | RYG(XE) << 10)     \
+        EMITW(0xAD400000 | MXM(REG(XF), TPxx,    0x02) | RYG(XF) << 10)     \
+        EMITW(0xAD400000 | MXM(REG(XG), TPxx,    0x03) | RYG(XG) << 10)
+
+#define movcx4st(XS, XT, XU, XV, MD, DD)                                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), U1(DD), EMPTY2)   \
+        EMITW(0xAD000000 | MXM(REG(XS), TPxx,    0x00) | RYG(XS) << 10)     \
+        EMITW(0xAD000000 | MXM(REG(XT), TPxx,    0x01) | RYG(XT) << 10)     \
+        EMITW(0xAD000000 | MXM(REG(XU), TPxx,    0x02) | RYG(XU) << 10)     \
+        EMITW(0xAD000000 | MXM(REG(XV), TPxx,    0x03) | RYG(XV) << 10)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -172,19 +201,25 @@
 
 #define mmvcx_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmM,    Tmm0+16))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmN,    Tmm0+16))                  \
+        LDT(TmmN)
 
 #define mmvcx_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), A2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x6EA01C00 | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
-        EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        EMITW(0x6EA01C00 | MXM(TmmN,    RYG(XS), Tmm0+16))                  \
+        EMITW(0x3D800000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        LDT(TmmN)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
@@ -200,10 +235,13 @@
 
 #define andcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E201C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E201C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ann (G = ~G & S), (D = ~S & T) if (#D != #T) */
 
@@ -219,10 +257,13 @@
 
 #define anncx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E601C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E601C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* orr (G = G | S), (D = S | T) if (#D != #T) */
 
@@ -238,10 +279,13 @@
 
 #define orrcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA01C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* orn (G = ~G | S), (D = ~S | T) if (#D != #T) */
 
@@ -257,10 +301,13 @@
 
 #define orncx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE01C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE01C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* xor (G = G ^ S), (D = S ^ T) if (#D != #T) */
 
@@ -276,10 +323,13 @@
 
 #define xorcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* not (G = ~G), (D = ~S) */
 
@@ -315,10 +365,13 @@
 
 #define addcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E20D400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E20D400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E20D400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -333,8 +386,10 @@
         EMITW(0x6E20D400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
         EMITW(0x3DC00000 | MPM(RYG(XD), MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E20D400 | MXM(RYG(XD), RYG(XD), TmmM))
+        STT(TmmN)                                                           \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E20D400 | MXM(RYG(XD), RYG(XD), TmmN))                     \
+        LDT(TmmN)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -350,10 +405,13 @@
 
 #define subcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA0D400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA0D400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA0D400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -369,10 +427,13 @@
 
 #define mulcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E20DC00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E20DC00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E20DC00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -391,10 +452,13 @@
 
 #define divcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E20FC00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E20FC00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E20FC00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sqr (D = sqrt S) */
 
@@ -404,10 +468,13 @@
 
 #define sqrcs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA1F800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA1F800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA1F800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cbr (D = cbrt S) */
 
@@ -423,12 +490,24 @@
         EMITW(0x4EA1D800 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x4EA1D800 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcscs_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x4E20FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x6E20DC00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0x4E20FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x6E20DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcscs_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x4E20FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x4E20FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x6E20DC00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x6E20DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RCP */
 
         /* rce, rcs, rcp are defined in rtconf.h
@@ -443,6 +522,8 @@
         EMITW(0x6EA1D800 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x6EA1D800 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rsscs_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x6E20DC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x4EA0FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
@@ -451,6 +532,18 @@
         EMITW(0x4EA0FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x6E20DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rsscs_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x6E20DC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x6E20DC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x4EA0FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x4EA0FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x6E20DC00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x6E20DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RSQ */
 
         /* rse, rss, rsq are defined in rtconf.h
@@ -468,10 +561,13 @@
 
 #define fmacs_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E20CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E20CC00 | MXM(RYG(XG), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E20CC00 | MXM(RYG(XG), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #endif /* RT_SIMD_COMPAT_FMA */
 
@@ -487,10 +583,13 @@
 
 #define fmscs_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA0CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA0CC00 | MXM(RYG(XG), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA0CC00 | MXM(RYG(XG), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
@@ -510,10 +609,13 @@
 
 #define mincs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA0F400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA0F400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA0F400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -532,10 +634,13 @@
 
 #define maxcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E20F400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E20F400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E20F400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -554,10 +659,13 @@
 
 #define ceqcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E20E400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E20E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -567,19 +675,34 @@
 #define cnecs_ld(XG, MS, DS)                                                \
         cnecs3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnecs3rr(XD, XS, XT)                                                \
         EMITW(0x4E20E400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
         EMITW(0x4E20E400 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnecs3rr(XD, XS, XT)                                                \
+        EMITW(0x4E20E400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E20E400 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnecs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E20E400 | MXM(RYG(XD), RYG(XS), TmmM))                     \
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E20E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)                                                           \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -596,10 +719,13 @@
 
 #define cltcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA0E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA0E400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA0E400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -615,10 +741,13 @@
 
 #define clecs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E20E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E20E400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E20E400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -634,10 +763,13 @@
 
 #define cgtcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA0E400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA0E400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA0E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -653,24 +785,32 @@
 
 #define cgecs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E20E400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E20E400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E20E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE32_256     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_256     0x04    /*  all satisfy the condition */
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4E201C00 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                                 (0x04 - RT_SIMD_MASK_##mask##32_256) << 21) \
         EMITW(0x4EB1B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##32_256))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##32_256))                     \
         jezxx_lb(lb)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -684,10 +824,13 @@
 
 #define rnzcs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EA19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EA19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvzcs_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x4EA1B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -695,10 +838,13 @@
 
 #define cvzcs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EA1B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EA1B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EA1B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvp (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -711,10 +857,13 @@
 
 #define rnpcs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EA18800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EA18800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EA18800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvpcs_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x4EA1A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -722,10 +871,13 @@
 
 #define cvpcs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EA1A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EA1A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EA1A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvm (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -738,10 +890,13 @@
 
 #define rnmcs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E219800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E219800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E219800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvmcs_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x4E21B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -749,10 +904,13 @@
 
 #define cvmcs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E21B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E21B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E21B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvn (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -765,10 +923,13 @@
 
 #define rnncs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E218800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E218800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E218800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvncs_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x4E21A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -776,10 +937,13 @@
 
 #define cvncs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E21A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E21A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E21A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvt (D = fp-to-signed-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -793,10 +957,13 @@
 
 #define rndcs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvtcs_rr(XD, XS)                                                    \
         rndcs_rr(W(XD), W(XS))                                              \
@@ -844,10 +1011,13 @@
 
 #define cvtcn_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E21D800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E21D800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E21D800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvn (D = unsigned-int-to-fp S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks) */
@@ -868,10 +1038,13 @@
 
 #define cvtcx_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E21D800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E21D800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E21D800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
@@ -884,10 +1057,13 @@
 
 #define ruzcs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EA19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EA19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cuzcs_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x6EA1B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -895,10 +1071,13 @@
 
 #define cuzcs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA1B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA1B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA1B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cup (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -911,10 +1090,13 @@
 
 #define rupcs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EA18800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EA18800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EA18800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cupcs_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x6EA1A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -922,10 +1104,13 @@
 
 #define cupcs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA1A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA1A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA1A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cum (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -938,10 +1123,13 @@
 
 #define rumcs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E219800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E219800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E219800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cumcs_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x6E21B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -949,10 +1137,13 @@
 
 #define cumcs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E21B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E21B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E21B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cun (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -965,10 +1156,13 @@
 
 #define runcs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E218800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E218800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E218800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cuncs_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x6E21A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -976,10 +1170,13 @@
 
 #define cuncs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E21A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E21A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E21A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cut (D = fp-to-unsigned-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -993,10 +1190,13 @@
 
 #define rudcs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cutcs_rr(XD, XS)                                                    \
         rudcs_rr(W(XD), W(XS))                                              \
@@ -1041,10 +1241,13 @@
 
 #define addcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA08400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA08400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA08400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -1060,10 +1263,13 @@
 
 #define subcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA08400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA08400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA08400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -1079,10 +1285,13 @@
 
 #define mulcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA09C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA09C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA09C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -1106,10 +1315,15 @@
 
 #define shlcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E040400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E040400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1130,11 +1344,17 @@
 
 #define shrcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E040400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E040400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6EA0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1155,11 +1375,17 @@
 
 #define shrcn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E040400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x4EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E040400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6EA0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1176,10 +1402,13 @@
 
 #define svlcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1191,19 +1420,25 @@
         svrcx3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrcx3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EA0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EA0B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6EA0B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svrcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1215,19 +1450,35 @@
         svrcn3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrcn3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EA0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EA0B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x4EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6EA0B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x4EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svrcn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4EA04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
+
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswcx_rr(XD, XS)                                                    \
+        EMITW(0x6E200800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x6E200800 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
 
 /****************   packed single-precision integer compare   *****************/
 
@@ -1245,10 +1496,13 @@
 
 #define mincx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA06C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA06C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA06C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), signed */
 
@@ -1264,10 +1518,13 @@
 
 #define mincn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA06C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA06C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA06C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), unsigned */
 
@@ -1283,10 +1540,13 @@
 
 #define maxcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA06400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA06400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA06400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), signed */
 
@@ -1302,10 +1562,13 @@
 
 #define maxcn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA06400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA06400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA06400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -1321,10 +1584,13 @@
 
 #define ceqcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA08C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA08C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1334,19 +1600,34 @@
 #define cnecx_ld(XG, MS, DS)                                                \
         cnecx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnecx3rr(XD, XS, XT)                                                \
         EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
         EMITW(0x6EA08C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnecx3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6EA08C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA08C00 | MXM(RYG(XD), RYG(XS), TmmM))                     \
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA08C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)                                                           \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -1363,10 +1644,13 @@
 
 #define cltcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA03400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA03400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -1382,10 +1666,13 @@
 
 #define cltcn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA03400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA03400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1401,10 +1688,13 @@
 
 #define clecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA03C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA03C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1420,10 +1710,13 @@
 
 #define clecn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA03C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA03C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1439,10 +1732,13 @@
 
 #define cgtcx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA03400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA03400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA03400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -1458,10 +1754,13 @@
 
 #define cgtcn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA03400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA03400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA03400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1477,10 +1776,13 @@
 
 #define cgecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EA03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EA03C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EA03C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1496,90 +1798,48 @@
 
 #define cgecn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA03C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA03C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
 
-/* sregs */
+/* sregs, ld1/st1 quad bursts over v0-v31 at Reax + 64*k (no pointer bumps),
+ * v15, v30, v31 have no 128-bit names in every mode, named internally here */
+
+#define Xv15    TmmQ, 0x00, EMPTY       /* v15 */
+#define Xv30    0x1E, 0x00, EMPTY       /* v30 */
+#define Xv31    TmmM, 0x00, EMPTY       /* v31 */
 
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        EMITW(0x3D800000 | MXM(TmmQ,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0x3D800000 | MXM(TmmM,    TEax,    0x00))
+        movix4st(Xmm0, Xmm1, Xmm2, Xmm3, Meax, DP(0x000))                   \
+        movix4st(Xmm4, Xmm5, Xmm6, Xmm7, Meax, DP(0x040))                   \
+        movix4st(Xmm8, Xmm9, XmmA, XmmB, Meax, DP(0x080))                   \
+        movix4st(XmmC, XmmD, XmmE, Xv15, Meax, DP(0x0C0))                   \
+        movix4st(XmmG, XmmH, XmmI, XmmJ, Meax, DP(0x100))                   \
+        movix4st(XmmK, XmmL, XmmM, XmmN, Meax, DP(0x140))                   \
+        movix4st(XmmO, XmmP, XmmQ, XmmR, Meax, DP(0x180))                   \
+        movix4st(XmmS, XmmT, Xv30, Xv31, Meax, DP(0x1C0))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        EMITW(0x3DC00000 | MXM(TmmQ,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0x3DC00000 | MXM(TmmM,    TEax,    0x00))
+        movix4ld(Xmm0, Xmm1, Xmm2, Xmm3, Meax, DP(0x000))                   \
+        movix4ld(Xmm4, Xmm5, Xmm6, Xmm7, Meax, DP(0x040))                   \
+        movix4ld(Xmm8, Xmm9, XmmA, XmmB, Meax, DP(0x080))                   \
+        movix4ld(XmmC, XmmD, XmmE, Xv15, Meax, DP(0x0C0))                   \
+        movix4ld(XmmG, XmmH, XmmI, XmmJ, Meax, DP(0x100))                   \
+        movix4ld(XmmK, XmmL, XmmM, XmmN, Meax, DP(0x140))                   \
+        movix4ld(XmmO, XmmP, XmmQ, XmmR, Meax, DP(0x180))                   \
+        movix4ld(XmmS, XmmT, Xv30, Xv31, Meax, DP(0x1C0))
 
 #endif /* RT_128X2 */
 
@@ -373,9 +373,9 @@
 
 /* mxj (jump to lb) if (S satisfies mask condition) - NONE, FULL */
 
-#define mxjox_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0x25A08000 | MXM(TEax,    REG(PS), 0x00))                     \
-        xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##32_SVE*RT_SIMD_WIDTH32))     \
+#define mxjox_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        EMITW(0x25A08000 | MXM(TMxx,    REG(PS), 0x00))                     \
+        xorwxZri(RMxx, IM(RT_SIMD_MASK_##mask##32_SVE*RT_SIMD_WIDTH32))     \
         jezxx_lb(lb)
 
 /* mov (D = S), predicated */
@@ -391,6 +391,8 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD)>>2, C3(DD), EMPTY2)\
         EMITW(0xE5404000 | MXM(REG(XS), MOD(MD), TDxx) | REG(PS) << 10)
 
+/* sel (D = P ? T : S), predicated blend */
+
 #define selox_rr(XD, PS, XS, XT)                                            \
         EMITW(0x05A0C000 | MXM(REG(XD), REG(XT), REG(XS)) | REG(PS) << 10)
 
@@ -1022,13 +1024,16 @@
 #define RT_SIMD_MASK_NONE32_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04982000 | MXM(TmmM,    REG(XS), 0x00) |                    \
                           RT_SIMD_MASK_##mask##32_SVE << 17)                \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##32_SVE))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##32_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjox_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1351,6 +1356,24 @@
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
+#if (RT_SVEX1 == 8) /* SVE2: unpredicated 3-op mul */
+
+#define mulox_rr(XG, XS)                                                    \
+        mulox3rr(W(XG), W(XG), W(XS))
+
+#define mulox_ld(XG, MS, DS)                                                \
+        mulox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulox3rr(XD, XS, XT)                                                \
+        EMITW(0x04A06000 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulox3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04A06000 | MXM(REG(XD), REG(XS), TmmM))
+
+#else  /* RT_SVEX1 != 8 */
+
 #define mulox_rr(XG, XS)                                                    \
         EMITW(0x04900000 | MXM(REG(XG), REG(XS), 0x00))
 
@@ -1367,6 +1390,8 @@
         movox_rr(W(XD), W(XS))                                              \
         mulox_ld(W(XD), W(MT), W(DT))
 
+#endif /* RT_SVEX1 != 8 */
+
 /* div (G = G / S), (D = S / T) if (#D != #T) */
 
 #undef  divox_rr
@@ -1591,6 +1616,15 @@
         movox_rr(W(XD), W(XS))                                              \
         svron_ld(W(XD), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswox_rr(XD, XS)                                                    \
+        EMITW(0x05A48000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        bswox_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1869,173 +1903,97 @@
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
 
-/* sregs */
+/* sregs, str/ldr burst at Reax + k*VL (imm9 split in rem and << 10 field) */
 
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5804000 | MXM(TmmQ,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5804000 | MXM(TmmM,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5804000 | MXM(0x00,    TEax,    0x00) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x01,    TEax,    0x00) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x02,    TEax,    0x00) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x03,    TEax,    0x00) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x04,    TEax,    0x00) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x05,    TEax,    0x00) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(0x06,    TEax,    0x00) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(0x07,    TEax,    0x00) | 0x07 << 10)        \
+        EMITW(0xE5804000 | MXM(0x08,    TEax,    0x01) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x09,    TEax,    0x01) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0A,    TEax,    0x01) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0B,    TEax,    0x01) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0C,    TEax,    0x01) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0D,    TEax,    0x01) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0E,    TEax,    0x01) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1E,    TEax,    0x01) | 0x07 << 10)        \
+        EMITW(0xE5804000 | MXM(0x10,    TEax,    0x02) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x11,    TEax,    0x02) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x12,    TEax,    0x02) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x13,    TEax,    0x02) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x14,    TEax,    0x02) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x15,    TEax,    0x02) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(0x16,    TEax,    0x02) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(0x17,    TEax,    0x02) | 0x07 << 10)        \
+        EMITW(0xE5804000 | MXM(0x18,    TEax,    0x03) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x19,    TEax,    0x03) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1A,    TEax,    0x03) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1B,    TEax,    0x03) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1C,    TEax,    0x03) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1D,    TEax,    0x03) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(TmmQ,    TEax,    0x03) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(TmmM,    TEax,    0x03) | 0x07 << 10)        \
+        addxx_ri(Reax, IH(RT_SIMD_WIDTH32*4*32))                            \
         EMITW(0xE5800000 | MXM(0x00,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x01,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x02,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x03,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x04,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x05,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x06,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x07,    TEax,    0x00))
+        EMITW(0xE5800000 | MXM(0x01,    TEax,    0x01))                     \
+        EMITW(0xE5800000 | MXM(0x02,    TEax,    0x02))                     \
+        EMITW(0xE5800000 | MXM(0x03,    TEax,    0x03))                     \
+        EMITW(0xE5800000 | MXM(0x04,    TEax,    0x04))                     \
+        EMITW(0xE5800000 | MXM(0x05,    TEax,    0x05))                     \
+        EMITW(0xE5800000 | MXM(0x06,    TEax,    0x06))                     \
+        EMITW(0xE5800000 | MXM(0x07,    TEax,    0x07))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85804000 | MXM(TmmQ,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85804000 | MXM(TmmM,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85804000 | MXM(0x00,    TEax,    0x00) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x01,    TEax,    0x00) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x02,    TEax,    0x00) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x03,    TEax,    0x00) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x04,    TEax,    0x00) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x05,    TEax,    0x00) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(0x06,    TEax,    0x00) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(0x07,    TEax,    0x00) | 0x07 << 10)        \
+        EMITW(0x85804000 | MXM(0x08,    TEax,    0x01) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x09,    TEax,    0x01) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x0A,    TEax,    0x01) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x0B,    TEax,    0x01) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x0C,    TEax,    0x01) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x0D,    TEax,    0x01) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(0x0E,    TEax,    0x01) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(0x1E,    TEax,    0x01) | 0x07 << 10)        \
+        EMITW(0x85804000 | MXM(0x10,    TEax,    0x02) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x11,    TEax,    0x02) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x12,    TEax,    0x02) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x13,    TEax,    0x02) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x14,    TEax,    0x02) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x15,    TEax,    0x02) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(0x16,    TEax,    0x02) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(0x17,    TEax,    0x02) | 0x07 << 10)        \
+        EMITW(0x85804000 | MXM(0x18,    TEax,    0x03) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x19,    TEax,    0x03) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x1A,    TEax,    0x03) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x1B,    TEax,    0x03) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x1C,    TEax,    0x03) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x1D,    TEax,    0x03) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(TmmQ,    TEax,    0x03) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(TmmM,    TEax,    0x03) | 0x07 << 10)        \
+        addxx_ri(Reax, IH(RT_SIMD_WIDTH32*4*32))                            \
         EMITW(0x85800000 | MXM(0x00,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x01,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x02,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x03,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x04,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x05,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x06,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x07,    TEax,    0x00))
+        EMITW(0x85800000 | MXM(0x01,    TEax,    0x01))                     \
+        EMITW(0x85800000 | MXM(0x02,    TEax,    0x02))                     \
+        EMITW(0x85800000 | MXM(0x03,    TEax,    0x03))                     \
+        EMITW(0x85800000 | MXM(0x04,    TEax,    0x04))                     \
+        EMITW(0x85800000 | MXM(0x05,    TEax,    0x05))                     \
+        EMITW(0x85800000 | MXM(0x06,    TEax,    0x06))                     \
+        EMITW(0x85800000 | MXM(0x07,    TEax,    0x07))
 
 #endif /* RT_SVEX1 */
 
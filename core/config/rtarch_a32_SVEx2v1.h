@@ -430,24 +430,67 @@
 
 /* mxx (D = mask-from-predicate S), (D = predicate-from-mask S) */
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define mmxox_rr(XD, PS)                                                    \
         EMITW(0x04A03000 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x05A0C000 | MXM(REG(XD), TmmQ,    REG(XD)) | REG(PS) << 10)  \
         EMITW(0x04A03000 | MXM(RYG(XD), RYG(XD), RYG(XD)))                  \
         EMITW(0x05A0C000 | MXM(RYG(XD), TmmQ,    RYG(XD)) | REP(PS) << 10)
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define mmxox_rr(XD, PS)                                                    \
+        EMITW(0x04A03000 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x04A03000 | MXM(RYG(XD), RYG(XD), RYG(XD)))                  \
+        EMITW(0x05A0C000 | MXM(REG(XD), TmmQ,    REG(XD)) | REG(PS) << 10)  \
+        EMITW(0x05A0C000 | MXM(RYG(XD), TmmQ,    RYG(XD)) | REP(PS) << 10)
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define mxmox_rr(PD, XS)                                                    \
         EMITW(0x2480A000 | MXM(REG(PD), REG(XS), TmmQ))                     \
         EMITW(0x2480A000 | MXM(REP(PD), RYG(XS), TmmQ))
 
 /* mxj (jump to lb) if (S satisfies mask condition) - NONE, FULL */
 
-#define mxjox_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0x25A08000 | MXM(Teax,    REG(PS), 0x00))                     \
-        EMITW(0x25AC8800 | MXM(Teax,    REP(PS), 0x00))                     \
-        xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##32_SVE*RT_SIMD_WIDTH32))     \
+#define mxjox_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        EMITW(0x25A08000 | MXM(TMxx,    REG(PS), 0x00))                     \
+        EMITW(0x25AC8800 | MXM(TMxx,    REP(PS), 0x00))                     \
+        xorwxZri(RMxx, IM(RT_SIMD_MASK_##mask##32_SVE*RT_SIMD_WIDTH32))     \
         jezxx_lb(lb)
 
+/* mov (D = S), predicated */
+
+#define mxvox_rr(XD, PS, XS)                                                \
+        EMITW(0x05A0C000 | MXM(REG(XD), REG(XS), REG(XD)) | REG(PS) << 10)  \
+        EMITW(0x05A0C000 | MXM(RYG(XD), RYG(XS), RYG(XD)) | REP(PS) << 10)
+
+#define mxvox_ld(XD, PS, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS)>>2, C3(DS), EMPTY2)\
+        EMITW(0xA5404000 | MXM(REG(XD), MOD(MS), TDxx) | REG(PS) << 10)     \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VZL(DS)>>2, C3(DS), EMPTY2)\
+        EMITW(0xA5404000 | MXM(RYG(XD), MOD(MS), TDxx) | REP(PS) << 10)
+
+#define mxvox_st(XS, PS, MD, DD)                                            \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD)>>2, C3(DD), EMPTY2)\
+        EMITW(0xE5404000 | MXM(REG(XS), MOD(MD), TDxx) | REG(PS) << 10)     \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VZL(DD)>>2, C3(DD), EMPTY2)\
+        EMITW(0xE5404000 | MXM(RYG(XS), MOD(MD), TDxx) | REP(PS) << 10)
+
+/* sel (D = P ? T : S), predicated blend */
+
+#define selox_rr(XD, PS, XS, XT)                                            \
+        EMITW(0x05A0C000 | MXM(REG(XD), REG(XT), REG(XS)) | REG(PS) << 10)  \
+        EMITW(0x05A0C000 | MXM(RYG(XD), RYG(XT), RYG(XS)) | REP(PS) << 10)
+
+#define selox_ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x05A0C000 | MXM(REG(XD), TmmM,    REG(XS)) | REG(PS) << 10)  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x05A0C000 | MXM(RYG(XD), TmmM,    RYG(XS)) | REP(PS) << 10)
+
 /******************************************************************************/
 /**********************************   SIMD   **********************************/
 /******************************************************************************/
@@ -730,12 +773,24 @@
         EMITW(0x658E3000 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x658E3000 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcsos_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x65801800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x65800800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0x65801800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x65800800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcsos_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x65801800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65801800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65800800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x65800800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RCP */
 
         /* rce, rcs, rcp are defined in rtconf.h
@@ -750,6 +805,8 @@
         EMITW(0x658F3000 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x658F3000 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rssos_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x65800800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x65801C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
@@ -758,6 +815,18 @@
         EMITW(0x65801C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x65800800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rssos_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x65800800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65800800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65801C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65801C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65800800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x65800800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RSQ */
 
         /* rse, rss, rsq are defined in rtconf.h
@@ -1018,15 +1087,18 @@
 #define RT_SIMD_MASK_NONE32_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04203000 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                      (1 - RT_SIMD_MASK_##mask##32_SVE) << 22)               \
         EMITW(0x04982000 | MXM(TmmM,    TmmM,    0x00) |                    \
                           RT_SIMD_MASK_##mask##32_SVE << 17)                \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##32_SVE))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##32_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjox_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1690,6 +1762,16 @@
         movox_rr(W(XD), W(XS))                                              \
         svron_ld(W(XD), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswox_rr(XD, XS)                                                    \
+        EMITW(0x05A48000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x05A48000 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        bswox_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -2050,89 +2132,85 @@
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
 
-/* sregs */
+/* sregs, str/ldr burst at Reax + k*VL (imm9 split in rem and << 10 field) */
 
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5804000 | MXM(TmmQ,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5804000 | MXM(TmmM,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5804000 | MXM(0x00,    TEax,    0x00) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x10,    TEax,    0x00) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x01,    TEax,    0x00) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x11,    TEax,    0x00) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x02,    TEax,    0x00) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x12,    TEax,    0x00) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(0x03,    TEax,    0x00) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(0x13,    TEax,    0x00) | 0x07 << 10)        \
+        EMITW(0xE5804000 | MXM(0x04,    TEax,    0x01) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x14,    TEax,    0x01) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x05,    TEax,    0x01) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x15,    TEax,    0x01) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x06,    TEax,    0x01) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x16,    TEax,    0x01) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(0x07,    TEax,    0x01) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(0x17,    TEax,    0x01) | 0x07 << 10)        \
+        EMITW(0xE5804000 | MXM(0x08,    TEax,    0x02) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x18,    TEax,    0x02) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x09,    TEax,    0x02) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x19,    TEax,    0x02) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0A,    TEax,    0x02) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1A,    TEax,    0x02) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0B,    TEax,    0x02) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1B,    TEax,    0x02) | 0x07 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0C,    TEax,    0x03) | 0x00 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1C,    TEax,    0x03) | 0x01 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0D,    TEax,    0x03) | 0x02 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1D,    TEax,    0x03) | 0x03 << 10)        \
+        EMITW(0xE5804000 | MXM(0x0E,    TEax,    0x03) | 0x04 << 10)        \
+        EMITW(0xE5804000 | MXM(0x1E,    TEax,    0x03) | 0x05 << 10)        \
+        EMITW(0xE5804000 | MXM(TmmQ,    TEax,    0x03) | 0x06 << 10)        \
+        EMITW(0xE5804000 | MXM(TmmM,    TEax,    0x03) | 0x07 << 10)        \
+        addxx_ri(Reax, IH(RT_SIMD_WIDTH32*4*32))                            \
         EMITW(0xE5800000 | MXM(0x00,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0xE5800000 | MXM(0x01,    TEax,    0x00))
+        EMITW(0xE5800000 | MXM(0x01,    TEax,    0x01))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85804000 | MXM(TmmQ,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85804000 | MXM(TmmM,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85804000 | MXM(0x00,    TEax,    0x00) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x10,    TEax,    0x00) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x01,    TEax,    0x00) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x11,    TEax,    0x00) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x02,    TEax,    0x00) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x12,    TEax,    0x00) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(0x03,    TEax,    0x00) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(0x13,    TEax,    0x00) | 0x07 << 10)        \
+        EMITW(0x85804000 | MXM(0x04,    TEax,    0x01) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x14,    TEax,    0x01) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x05,    TEax,    0x01) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x15,    TEax,    0x01) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x06,    TEax,    0x01) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x16,    TEax,    0x01) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(0x07,    TEax,    0x01) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(0x17,    TEax,    0x01) | 0x07 << 10)        \
+        EMITW(0x85804000 | MXM(0x08,    TEax,    0x02) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x18,    TEax,    0x02) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x09,    TEax,    0x02) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x19,    TEax,    0x02) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x0A,    TEax,    0x02) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x1A,    TEax,    0x02) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(0x0B,    TEax,    0x02) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(0x1B,    TEax,    0x02) | 0x07 << 10)        \
+        EMITW(0x85804000 | MXM(0x0C,    TEax,    0x03) | 0x00 << 10)        \
+        EMITW(0x85804000 | MXM(0x1C,    TEax,    0x03) | 0x01 << 10)        \
+        EMITW(0x85804000 | MXM(0x0D,    TEax,    0x03) | 0x02 << 10)        \
+        EMITW(0x85804000 | MXM(0x1D,    TEax,    0x03) | 0x03 << 10)        \
+        EMITW(0x85804000 | MXM(0x0E,    TEax,    0x03) | 0x04 << 10)        \
+        EMITW(0x85804000 | MXM(0x1E,    TEax,    0x03) | 0x05 << 10)        \
+        EMITW(0x85804000 | MXM(TmmQ,    TEax,    0x03) | 0x06 << 10)        \
+        EMITW(0x85804000 | MXM(TmmM,    TEax,    0x03) | 0x07 << 10)        \
+        addxx_ri(Reax, IH(RT_SIMD_WIDTH32*4*32))                            \
         EMITW(0x85800000 | MXM(0x00,    TEax,    0x00))                     \
-        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
-        EMITW(0x85800000 | MXM(0x01,    TEax,    0x00))
+        EMITW(0x85800000 | MXM(0x01,    TEax,    0x01))
 
 #endif /* RT_SVEX2 */
 
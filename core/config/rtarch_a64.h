@@ -49,6 +49,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -522,6 +524,16 @@
         EMITW(0xAA200000 | MRM(TMxx,    TZxx,    TMxx))                     \
         EMITW(0xF8000000 | MDM(TMxx,    MOD(MG), VXL(DG), B1(DG), P1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswzx_rx(RG)                                                        \
+        EMITW(0xDAC00C00 | MRM(REG(RG), REG(RG), 0x00))
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        bswzx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -162,14 +162,18 @@
 
 #define mmvjx_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))
+        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
+        LDT(TmmM)
 
 #define mmvjx_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
-        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
+        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
+        LDT(TmmM)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
@@ -184,8 +188,10 @@
 
 #define andjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ann (G = ~G & S), (D = ~S & T) if (#D != #T) */
 
@@ -200,8 +206,10 @@
 
 #define annjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* orr (G = G | S), (D = S | T) if (#D != #T) */
 
@@ -216,8 +224,10 @@
 
 #define orrjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* orn (G = ~G | S), (D = ~S | T) if (#D != #T) */
 
@@ -232,8 +242,10 @@
 
 #define ornjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* xor (G = G ^ S), (D = S ^ T) if (#D != #T) */
 
@@ -248,8 +260,10 @@
 
 #define xorjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* not (G = ~G), (D = ~S) */
 
@@ -282,8 +296,10 @@
 
 #define addjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E60D400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E60D400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -295,8 +311,10 @@
 #undef  adpjs3ld
 #define adpjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E60D400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E60D400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -311,8 +329,10 @@
 
 #define subjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE0D400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE0D400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -327,8 +347,10 @@
 
 #define muljs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E60DC00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E60DC00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -346,8 +368,10 @@
 
 #define divjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E60FC00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E60FC00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sqr (D = sqrt S) */
 
@@ -356,8 +380,10 @@
 
 #define sqrjs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EE1F800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EE1F800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cbr (D = cbrt S) */
 
@@ -410,8 +436,10 @@
 
 #define fmajs_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E60CC00 | MXM(REG(XG), REG(XS), TmmM))
+        EMITW(0x4E60CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMA */
 
@@ -426,8 +454,10 @@
 
 #define fmsjs_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE0CC00 | MXM(REG(XG), REG(XS), TmmM))
+        EMITW(0x4EE0CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
@@ -446,8 +476,10 @@
 
 #define minjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE0F400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE0F400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -465,8 +497,10 @@
 
 #define maxjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E60F400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E60F400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -484,8 +518,10 @@
 
 #define ceqjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E60E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -501,8 +537,10 @@
 
 #define cnejs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -518,8 +556,10 @@
 
 #define cltjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE0E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6EE0E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -534,8 +574,10 @@
 
 #define clejs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E60E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6E60E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -550,8 +592,10 @@
 
 #define cgtjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE0E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE0E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -566,20 +610,27 @@
 
 #define cgejs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E60E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE64_128     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_128     0x04    /*  all satisfy the condition */
 
-#define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjjx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4EB1B800 | MXM(TmmM,    REG(XS), 0x00))                     \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##64_128))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##64_128))                     \
         jezxx_lb(lb)
 
+#define mkjjx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -592,16 +643,20 @@
 
 #define rnzjs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EE19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvzjs_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x4EE1B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvzjs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EE1B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EE1B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvp (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -613,16 +668,20 @@
 
 #define rnpjs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EE18800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EE18800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvpjs_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x4EE1A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvpjs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EE1A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EE1A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvm (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -634,16 +693,20 @@
 
 #define rnmjs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E619800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E619800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvmjs_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x4E61B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvmjs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E61B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E61B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvn (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -655,16 +718,20 @@
 
 #define rnnjs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E618800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E618800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvnjs_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x4E61A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvnjs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E61A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E61A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvt (D = fp-to-signed-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -677,8 +744,10 @@
 
 #define rndjs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EE19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvtjs_rr(XD, XS)                                                    \
         rndjs_rr(W(XD), W(XS))                                              \
@@ -721,8 +790,10 @@
 
 #define cvtjn_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E61D800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E61D800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvn (D = unsigned-int-to-fp S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks) */
@@ -742,8 +813,10 @@
 
 #define cvtjx_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E61D800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E61D800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
@@ -755,16 +828,20 @@
 
 #define ruzjs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EE19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cuzjs_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x6EE1B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cuzjs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EE1B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EE1B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cup (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -776,16 +853,20 @@
 
 #define rupjs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EE18800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EE18800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cupjs_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x6EE1A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cupjs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EE1A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EE1A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cum (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -797,16 +878,20 @@
 
 #define rumjs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E619800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E619800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cumjs_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x6E61B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cumjs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E61B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E61B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cun (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -818,16 +903,20 @@
 
 #define runjs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E618800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E618800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cunjs_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x6E61A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cunjs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E61A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E61A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cut (D = fp-to-unsigned-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -840,8 +929,10 @@
 
 #define rudjs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EE19800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cutjs_rr(XD, XS)                                                    \
         rudjs_rr(W(XD), W(XS))                                              \
@@ -881,8 +972,10 @@
 
 #define addjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE08400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE08400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -897,8 +990,10 @@
 
 #define subjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE08400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE08400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -954,9 +1049,11 @@
 
 #define shljx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E080400 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -974,10 +1071,12 @@
 
 #define shrjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E080400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -995,10 +1094,12 @@
 
 #define shrjn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E080400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1014,8 +1115,10 @@
 
 #define svljx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1027,14 +1130,18 @@
         svrjx3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrjx3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EE0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1046,14 +1153,27 @@
         svrjn3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrjn3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EE0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrjn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
+
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswjx_rr(XD, XS)                                                    \
+        EMITW(0x4E200800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
 
 /****************   packed double-precision integer compare   *****************/
 
@@ -1226,8 +1346,10 @@
 
 #define ceqjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1243,8 +1365,10 @@
 
 #define cnejx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -1260,8 +1384,10 @@
 
 #define cltjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE03400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6EE03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -1276,8 +1402,10 @@
 
 #define cltjn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE03400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4EE03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1292,8 +1420,10 @@
 
 #define clejx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1308,8 +1438,10 @@
 
 #define clejn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1324,8 +1456,10 @@
 
 #define cgtjx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE03400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE03400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -1340,8 +1474,10 @@
 
 #define cgtjn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE03400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE03400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1356,8 +1492,10 @@
 
 #define cgejx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EE03C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EE03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1372,8 +1510,10 @@
 
 #define cgejn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE03C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EE03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /******************************************************************************/
 /**********************************   ELEM   **********************************/
@@ -1407,8 +1547,10 @@
 
 #define addts3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E602800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E602800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -1423,8 +1565,10 @@
 
 #define subts3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E603800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E603800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -1439,8 +1583,10 @@
 
 #define mults3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E600800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E600800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
@@ -1455,8 +1601,10 @@
 
 #define divts3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E601800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E601800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sqr (D = sqrt S) */
 
@@ -1465,8 +1613,10 @@
 
 #define sqrts_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MS), VXL(DS), B1(DS), P1(DS)))  \
-        EMITW(0x1E61C000 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x1E61C000 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -1514,8 +1664,10 @@
 
 #define fmats_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1F400000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)
+        EMITW(0x1F400000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMA */
 
@@ -1530,8 +1682,10 @@
 
 #define fmsts_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1F408000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)
+        EMITW(0x1F408000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)     \
+        LDT(TmmM)
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
@@ -1550,8 +1704,10 @@
 
 #define mints3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E605800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E605800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
@@ -1566,8 +1722,10 @@
 
 #define maxts3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1E604800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1E604800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -1582,8 +1740,10 @@
 
 #define ceqts3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x5E60E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x5E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1599,8 +1759,10 @@
 
 #define cnets3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
         EMITW(0x5E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -1616,8 +1778,10 @@
 
 #define cltts3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7EE0E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x7EE0E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -1632,8 +1796,10 @@
 
 #define clets3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7E60E400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x7E60E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -1648,8 +1814,10 @@
 
 #define cgtts3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7EE0E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x7EE0E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -1664,8 +1832,19 @@
 
 #define cgets3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0xFC400000 | MPM(TmmM,    MOD(MT), VXL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7E60E400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x7E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
+
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjts_rr(XS, XT, cc, lb)                                            \
+        EMITW(0x1E602000 | MXM(0x00,    REG(XS), REG(XT)))                  \
+        CMF(cc, lb)
 
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
@@ -123,7 +123,7 @@
 
 #if (defined RT_SIMD_CODE)
 
-#if (RT_128X2 != 0) && (RT_SIMD_COMPAT_XMM > 0)
+#if (RT_128X2 != 0)
 
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
@@ -166,19 +166,25 @@
 
 #define mmvdx_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmM,    Tmm0+16))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmN,    Tmm0+16))                  \
+        LDT(TmmN)
 
 #define mmvdx_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), A2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x6EA01C00 | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
-        EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        EMITW(0x6EA01C00 | MXM(TmmN,    RYG(XS), Tmm0+16))                  \
+        EMITW(0x3D800000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        LDT(TmmN)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
@@ -194,10 +200,13 @@
 
 #define anddx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E201C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E201C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ann (G = ~G & S), (D = ~S & T) if (#D != #T) */
 
@@ -213,10 +222,13 @@
 
 #define anndx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E601C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E601C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* orr (G = G | S), (D = S | T) if (#D != #T) */
 
@@ -232,10 +244,13 @@
 
 #define orrdx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA01C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* orn (G = ~G | S), (D = ~S | T) if (#D != #T) */
 
@@ -251,10 +266,13 @@
 
 #define orndx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE01C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE01C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* xor (G = G ^ S), (D = S ^ T) if (#D != #T) */
 
@@ -270,10 +288,13 @@
 
 #define xordx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* not (G = ~G), (D = ~S) */
 
@@ -309,10 +330,13 @@
 
 #define addds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E60D400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E60D400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E60D400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -327,8 +351,10 @@
         EMITW(0x6E60D400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
         EMITW(0x3DC00000 | MPM(RYG(XD), MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E60D400 | MXM(RYG(XD), RYG(XD), TmmM))
+        STT(TmmN)                                                           \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E60D400 | MXM(RYG(XD), RYG(XD), TmmN))                     \
+        LDT(TmmN)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -344,10 +370,13 @@
 
 #define subds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE0D400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE0D400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE0D400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -363,10 +392,13 @@
 
 #define mulds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E60DC00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E60DC00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E60DC00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -385,10 +417,13 @@
 
 #define divds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E60FC00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E60FC00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E60FC00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sqr (D = sqrt S) */
 
@@ -398,10 +433,13 @@
 
 #define sqrds_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EE1F800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EE1F800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EE1F800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cbr (D = cbrt S) */
 
@@ -417,12 +455,24 @@
         EMITW(0x4EE1D800 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x4EE1D800 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcsds_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x4E60FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x6E60DC00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0x4E60FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x6E60DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcsds_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x4E60FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x4E60FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x6E60DC00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x6E60DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RCP */
 
         /* rce, rcs, rcp are defined in rtconf.h
@@ -437,6 +487,8 @@
         EMITW(0x6EE1D800 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x6EE1D800 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rssds_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x6E60DC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x4EE0FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
@@ -445,6 +497,18 @@
         EMITW(0x4EE0FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x6E60DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rssds_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x6E60DC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x6E60DC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x4EE0FC00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x4EE0FC00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x6E60DC00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x6E60DC00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RSQ */
 
         /* rse, rss, rsq are defined in rtconf.h
@@ -462,10 +526,13 @@
 
 #define fmads_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E60CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E60CC00 | MXM(RYG(XG), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E60CC00 | MXM(RYG(XG), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #endif /* RT_SIMD_COMPAT_FMA */
 
@@ -481,10 +548,13 @@
 
 #define fmsds_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE0CC00 | MXM(REG(XG), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE0CC00 | MXM(RYG(XG), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE0CC00 | MXM(RYG(XG), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
@@ -504,10 +574,13 @@
 
 #define minds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE0F400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE0F400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE0F400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -526,10 +599,13 @@
 
 #define maxds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E60F400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E60F400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E60F400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -548,10 +624,13 @@
 
 #define ceqds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E60E400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E60E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -561,19 +640,34 @@
 #define cneds_ld(XG, MS, DS)                                                \
         cneds3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneds3rr(XD, XS, XT)                                                \
         EMITW(0x4E60E400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
         EMITW(0x4E60E400 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneds3rr(XD, XS, XT)                                                \
+        EMITW(0x4E60E400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E60E400 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E60E400 | MXM(RYG(XD), RYG(XS), TmmM))                     \
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E60E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)                                                           \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -590,10 +684,13 @@
 
 #define cltds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE0E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE0E400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE0E400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -609,10 +706,13 @@
 
 #define cleds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E60E400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E60E400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E60E400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -628,10 +728,13 @@
 
 #define cgtds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE0E400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE0E400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE0E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -647,24 +750,32 @@
 
 #define cgeds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E60E400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E60E400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E60E400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE64_256     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_256     0x04    /*  all satisfy the condition */
 
-#define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjdx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4E201C00 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                                 (0x04 - RT_SIMD_MASK_##mask##64_256) << 21) \
         EMITW(0x4EB1B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##64_256))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##64_256))                     \
         jezxx_lb(lb)
 
+#define mkjdx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjdx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -678,10 +789,13 @@
 
 #define rnzds_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EE19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EE19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvzds_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x4EE1B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -689,10 +803,13 @@
 
 #define cvzds_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EE1B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EE1B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EE1B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvp (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -705,10 +822,13 @@
 
 #define rnpds_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EE18800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EE18800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EE18800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvpds_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x4EE1A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -716,10 +836,13 @@
 
 #define cvpds_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EE1A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EE1A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EE1A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvm (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -732,10 +855,13 @@
 
 #define rnmds_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E619800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E619800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E619800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvmds_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x4E61B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -743,10 +869,13 @@
 
 #define cvmds_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E61B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E61B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E61B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvn (D = fp-to-signed-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -759,10 +888,13 @@
 
 #define rnnds_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E618800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E618800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E618800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvnds_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x4E61A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -770,10 +902,13 @@
 
 #define cvnds_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E61A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E61A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E61A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvt (D = fp-to-signed-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -787,10 +922,13 @@
 
 #define rndds_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EE19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EE19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvtds_rr(XD, XS)                                                    \
         rndds_rr(W(XD), W(XS))                                              \
@@ -838,10 +976,13 @@
 
 #define cvtdn_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E61D800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E61D800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E61D800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvn (D = unsigned-int-to-fp S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks) */
@@ -862,10 +1003,13 @@
 
 #define cvtdx_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E61D800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E61D800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E61D800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
@@ -878,10 +1022,13 @@
 
 #define ruzds_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EE19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EE19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cuzds_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x6EE1B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -889,10 +1036,13 @@
 
 #define cuzds_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EE1B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EE1B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EE1B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cup (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -905,10 +1055,13 @@
 
 #define rupds_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EE18800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EE18800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EE18800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cupds_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x6EE1A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -916,10 +1069,13 @@
 
 #define cupds_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EE1A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EE1A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EE1A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cum (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -932,10 +1088,13 @@
 
 #define rumds_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E619800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E619800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E619800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cumds_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x6E61B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -943,10 +1102,13 @@
 
 #define cumds_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E61B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E61B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E61B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cun (D = fp-to-unsigned-int S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks)
@@ -959,10 +1121,13 @@
 
 #define runds_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E618800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E618800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E618800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cunds_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x6E61A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -970,10 +1135,13 @@
 
 #define cunds_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E61A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E61A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E61A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cut (D = fp-to-unsigned-int S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -987,10 +1155,13 @@
 
 #define rudds_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EE19800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EE19800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EE19800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cutds_rr(XD, XS)                                                    \
         rudds_rr(W(XD), W(XS))                                              \
@@ -1035,10 +1206,13 @@
 
 #define adddx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE08400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE08400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE08400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -1054,10 +1228,13 @@
 
 #define subdx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE08400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE08400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE08400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -1128,10 +1305,15 @@
 
 #define shldx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E080400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E080400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1152,11 +1334,17 @@
 
 #define shrdx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E080400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E080400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6EE0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1177,11 +1365,17 @@
 
 #define shrdn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E080400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x4EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E080400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6EE0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1198,10 +1392,13 @@
 
 #define svldx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1213,19 +1410,25 @@
         svrdx3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrdx3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EE0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EE0B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6EE0B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svrdx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1237,19 +1440,35 @@
         svrdn3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrdn3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6EE0B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6EE0B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x4EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6EE0B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x4EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svrdn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4EE04400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE0B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4EE04400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
+
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswdx_rr(XD, XS)                                                    \
+        EMITW(0x4E200800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x4E200800 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
 
 /****************   packed double-precision integer compare   *****************/
 
@@ -1487,10 +1706,13 @@
 
 #define ceqdx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE08C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE08C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1500,19 +1722,34 @@
 #define cnedx_ld(XG, MS, DS)                                                \
         cnedx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnedx3rr(XD, XS, XT)                                                \
         EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
         EMITW(0x6EE08C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnedx3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6EE08C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnedx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), TmmM))                     \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE08C00 | MXM(RYG(XD), RYG(XS), TmmM))                     \
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE08C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)                                                           \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -1529,10 +1766,13 @@
 
 #define cltdx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE03400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE03400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -1548,10 +1788,13 @@
 
 #define cltdn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE03400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE03400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE03400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1567,10 +1810,13 @@
 
 #define cledx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE03C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE03C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1586,10 +1832,13 @@
 
 #define cledn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE03C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE03C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1605,10 +1854,13 @@
 
 #define cgtdx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE03400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE03400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE03400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -1624,10 +1876,13 @@
 
 #define cgtdn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE03400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE03400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE03400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1643,10 +1898,13 @@
 
 #define cgedx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EE03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EE03C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EE03C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1662,10 +1920,13 @@
 
 #define cgedn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE03C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE03C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE03C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
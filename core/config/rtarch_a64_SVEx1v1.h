@@ -339,9 +339,9 @@
 
 /* mxj (jump to lb) if (S satisfies mask condition) - NONE, FULL */
 
-#define mxjqx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0x25E08000 | MXM(Teax,    REG(PS), 0x00))                     \
-        xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##64_SVE*RT_SIMD_WIDTH64))     \
+#define mxjqx_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        EMITW(0x25E08000 | MXM(TMxx,    REG(PS), 0x00))                     \
+        xorwxZri(RMxx, IM(RT_SIMD_MASK_##mask##64_SVE*RT_SIMD_WIDTH64))     \
         jezxx_lb(lb)
 
 /* mov (D = S), predicated */
@@ -357,6 +357,8 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD)>>3, C3(DD), EMPTY2)\
         EMITW(0xE5E04000 | MXM(REG(XS), MOD(MD), TDxx) | REG(PS) << 10)
 
+/* sel (D = P ? T : S), predicated blend */
+
 #define selqx_rr(XD, PS, XS, XT)                                            \
         EMITW(0x05E0C000 | MXM(REG(XD), REG(XT), REG(XS)) | REG(PS) << 10)
 
@@ -984,13 +986,16 @@
 #define RT_SIMD_MASK_NONE64_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjqx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04D82000 | MXM(TmmM,    REG(XS), 0x00) |                    \
                           RT_SIMD_MASK_##mask##64_SVE << 17)                \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##64_SVE))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##64_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjqx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjqx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1313,6 +1318,24 @@
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
+#if (RT_SVEX1 == 8) /* SVE2: unpredicated 3-op mul */
+
+#define mulqx_rr(XG, XS)                                                    \
+        mulqx3rr(W(XG), W(XG), W(XS))
+
+#define mulqx_ld(XG, MS, DS)                                                \
+        mulqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulqx3rr(XD, XS, XT)                                                \
+        EMITW(0x04E06000 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulqx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04E06000 | MXM(REG(XD), REG(XS), TmmM))
+
+#else  /* RT_SVEX1 != 8 */
+
 #define mulqx_rr(XG, XS)                                                    \
         EMITW(0x04D00000 | MXM(REG(XG), REG(XS), 0x00))
 
@@ -1329,6 +1352,8 @@
         movqx_rr(W(XD), W(XS))                                              \
         mulqx_ld(W(XD), W(MT), W(DT))
 
+#endif /* RT_SVEX1 != 8 */
+
 /* div (G = G / S), (D = S / T) if (#D != #T) */
 
 #undef  divqx_rr
@@ -1556,6 +1581,15 @@
         movqx_rr(W(XD), W(XS))                                              \
         svrqn_ld(W(XD), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswqx_rr(XD, XS)                                                    \
+        EMITW(0x05E48000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        bswqx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
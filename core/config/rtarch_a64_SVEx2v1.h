@@ -402,24 +402,67 @@
 
 /* mxx (D = mask-from-predicate S), (D = predicate-from-mask S) */
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define mmxqx_rr(XD, PS)                                                    \
         EMITW(0x04A03000 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x05E0C000 | MXM(REG(XD), TmmQ,    REG(XD)) | REG(PS) << 10)  \
         EMITW(0x04A03000 | MXM(RYG(XD), RYG(XD), RYG(XD)))                  \
         EMITW(0x05E0C000 | MXM(RYG(XD), TmmQ,    RYG(XD)) | REP(PS) << 10)
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define mmxqx_rr(XD, PS)                                                    \
+        EMITW(0x04A03000 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x04A03000 | MXM(RYG(XD), RYG(XD), RYG(XD)))                  \
+        EMITW(0x05E0C000 | MXM(REG(XD), TmmQ,    REG(XD)) | REG(PS) << 10)  \
+        EMITW(0x05E0C000 | MXM(RYG(XD), TmmQ,    RYG(XD)) | REP(PS) << 10)
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define mxmqx_rr(PD, XS)                                                    \
         EMITW(0x24C0A000 | MXM(REG(PD), REG(XS), TmmQ))                     \
         EMITW(0x24C0A000 | MXM(REP(PD), RYG(XS), TmmQ))
 
 /* mxj (jump to lb) if (S satisfies mask condition) - NONE, FULL */
 
-#define mxjqx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0x25E08000 | MXM(Teax,    REG(PS), 0x00))                     \
-        EMITW(0x25EC8800 | MXM(Teax,    REP(PS), 0x00))                     \
-        xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##64_SVE*RT_SIMD_WIDTH64))     \
+#define mxjqx_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        EMITW(0x25E08000 | MXM(TMxx,    REG(PS), 0x00))                     \
+        EMITW(0x25EC8800 | MXM(TMxx,    REP(PS), 0x00))                     \
+        xorwxZri(RMxx, IM(RT_SIMD_MASK_##mask##64_SVE*RT_SIMD_WIDTH64))     \
         jezxx_lb(lb)
 
+/* mov (D = S), predicated */
+
+#define mxvqx_rr(XD, PS, XS)                                                \
+        EMITW(0x05E0C000 | MXM(REG(XD), REG(XS), REG(XD)) | REG(PS) << 10)  \
+        EMITW(0x05E0C000 | MXM(RYG(XD), RYG(XS), RYG(XD)) | REP(PS) << 10)
+
+#define mxvqx_ld(XD, PS, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS)>>3, C3(DS), EMPTY2)\
+        EMITW(0xA5E04000 | MXM(REG(XD), MOD(MS), TDxx) | REG(PS) << 10)     \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VZL(DS)>>3, C3(DS), EMPTY2)\
+        EMITW(0xA5E04000 | MXM(RYG(XD), MOD(MS), TDxx) | REP(PS) << 10)
+
+#define mxvqx_st(XS, PS, MD, DD)                                            \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD)>>3, C3(DD), EMPTY2)\
+        EMITW(0xE5E04000 | MXM(REG(XS), MOD(MD), TDxx) | REG(PS) << 10)     \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VZL(DD)>>3, C3(DD), EMPTY2)\
+        EMITW(0xE5E04000 | MXM(RYG(XS), MOD(MD), TDxx) | REP(PS) << 10)
+
+/* sel (D = P ? T : S), predicated blend */
+
+#define selqx_rr(XD, PS, XS, XT)                                            \
+        EMITW(0x05E0C000 | MXM(REG(XD), REG(XT), REG(XS)) | REG(PS) << 10)  \
+        EMITW(0x05E0C000 | MXM(RYG(XD), RYG(XT), RYG(XS)) | REP(PS) << 10)
+
+#define selqx_ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x05E0C000 | MXM(REG(XD), TmmM,    REG(XS)) | REG(PS) << 10)  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x05E0C000 | MXM(RYG(XD), TmmM,    RYG(XS)) | REP(PS) << 10)
+
 /******************************************************************************/
 /**********************************   SIMD   **********************************/
 /******************************************************************************/
@@ -702,12 +745,24 @@
         EMITW(0x65CE3000 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x65CE3000 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcsqs_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x65C01800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x65C00800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0x65C01800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x65C00800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x65C01800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65C01800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65C00800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x65C00800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RCP */
 
         /* rce, rcs, rcp are defined in rtconf.h
@@ -722,6 +777,8 @@
         EMITW(0x65CF3000 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x65CF3000 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rssqs_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x65C00800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x65C01C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
@@ -730,6 +787,18 @@
         EMITW(0x65C01C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x65C00800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rssqs_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x65C00800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65C00800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65C01C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65C01C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65C00800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x65C00800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RSQ */
 
         /* rse, rss, rsq are defined in rtconf.h
@@ -990,15 +1059,18 @@
 #define RT_SIMD_MASK_NONE64_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjqx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04203000 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                      (1 - RT_SIMD_MASK_##mask##64_SVE) << 22)               \
         EMITW(0x04D82000 | MXM(TmmM,    TmmM,    0x00) |                    \
                           RT_SIMD_MASK_##mask##64_SVE << 17)                \
-        EMITW(0x0E043C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##64_SVE))                     \
+        EMITW(0x0E043C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##64_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjqx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjqx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1668,6 +1740,16 @@
         movqx_rr(W(XD), W(XS))                                              \
         svrqn_ld(W(XD), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswqx_rr(XD, XS)                                                    \
+        EMITW(0x05E48000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x05E48000 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        bswqx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
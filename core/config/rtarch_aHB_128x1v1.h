@@ -140,6 +140,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvugx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))
+
+#define mvugx_st(XS, MD, DD)                                                \
+        movgx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -148,14 +157,18 @@
 
 #define mmvgx_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))
+        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
+        LDT(TmmM)
 
 #define mmvgx_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
-        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
+        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
+        LDT(TmmM)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
@@ -170,8 +183,10 @@
 
 #define andgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ann (G = ~G & S), (D = ~S & T) if (#D != #T) */
 
@@ -186,8 +201,10 @@
 
 #define anngx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* orr (G = G | S), (D = S | T) if (#D != #T) */
 
@@ -202,8 +219,10 @@
 
 #define orrgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* orn (G = ~G | S), (D = ~S | T) if (#D != #T) */
 
@@ -218,8 +237,10 @@
 
 #define orngx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* xor (G = G ^ S), (D = S ^ T) if (#D != #T) */
 
@@ -234,8 +255,10 @@
 
 #define xorgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* not (G = ~G), (D = ~S) */
 
@@ -260,8 +283,10 @@
 
 #define addgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E608400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E608400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, unsigned */
 
@@ -276,8 +301,10 @@
 
 #define adsgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E600C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E600C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, signed */
 
@@ -292,8 +319,10 @@
 
 #define adsgn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E600C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E600C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -308,8 +337,10 @@
 
 #define subgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E608400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E608400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, unsigned */
 
@@ -324,8 +355,10 @@
 
 #define sbsgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E602C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E602C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, signed */
 
@@ -340,8 +373,10 @@
 
 #define sbsgn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E602C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E602C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -356,8 +391,10 @@
 
 #define mulgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E609C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E609C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -375,9 +412,11 @@
 
 #define shlgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E020400 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -395,10 +434,12 @@
 
 #define shrgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E020400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -416,10 +457,12 @@
 
 #define shrgn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E020400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -435,8 +478,10 @@
 
 #define svlgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -448,14 +493,18 @@
         svrgx3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrgx3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E60B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -467,14 +516,27 @@
         svrgn3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrgn3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E60B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrgn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
+
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswgx_rr(XD, XS)                                                    \
+        EMITW(0x4E201800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
 
 /*****************   packed half-precision integer compare   ******************/
 
@@ -491,8 +553,10 @@
 
 #define mingx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E606C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E606C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), signed */
 
@@ -507,8 +571,10 @@
 
 #define mingn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E606C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E606C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), unsigned */
 
@@ -523,8 +589,10 @@
 
 #define maxgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E606400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E606400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), signed */
 
@@ -539,8 +607,10 @@
 
 #define maxgn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E606400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E606400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -555,8 +625,10 @@
 
 #define ceqgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E608C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E608C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -572,8 +644,10 @@
 
 #define cnegx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6E608C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -589,8 +663,10 @@
 
 #define cltgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E603400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6E603400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -605,8 +681,10 @@
 
 #define cltgn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E603400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4E603400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -621,8 +699,10 @@
 
 #define clegx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E603C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6E603C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -637,8 +717,10 @@
 
 #define clegn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E603C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4E603C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -653,8 +735,10 @@
 
 #define cgtgx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E603400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E603400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -669,8 +753,10 @@
 
 #define cgtgn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E603400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E603400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -685,8 +771,10 @@
 
 #define cgegx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E603C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E603C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -701,20 +789,27 @@
 
 #define cgegn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E603C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E603C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE16_128     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_128     0x08    /*  all satisfy the condition */
 
-#define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4E71B800 | MXM(TmmM,    REG(XS), 0x00))                     \
-        EMITW(0x0E022C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##16_128))                     \
+        EMITW(0x0E022C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##16_128))                     \
         jezxx_lb(lb)
 
+#define mkjgx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -725,14 +820,18 @@
 
 #define mmvgb_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))
+        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
+        LDT(TmmM)
 
 #define mmvgb_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
-        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
+        EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))  \
+        LDT(TmmM)
 
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
@@ -751,8 +850,10 @@
 
 #define addgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E208400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E208400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, unsigned */
 
@@ -767,8 +868,10 @@
 
 #define adsgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E200C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E200C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, signed */
 
@@ -783,8 +886,10 @@
 
 #define adsgc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E200C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E200C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -799,8 +904,10 @@
 
 #define subgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E208400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E208400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, unsigned */
 
@@ -815,8 +922,10 @@
 
 #define sbsgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E202C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E202C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, signed */
 
@@ -831,8 +940,10 @@
 
 #define sbsgc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E202C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E202C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -847,8 +958,10 @@
 
 #define mulgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E209C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E209C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -866,9 +979,11 @@
 
 #define shlgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E010400 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -886,10 +1001,12 @@
 
 #define shrgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E010400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -907,10 +1024,12 @@
 
 #define shrgc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E010400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -926,8 +1045,10 @@
 
 #define svlgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -939,14 +1060,18 @@
         svrgb3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrgb3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E20B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -958,14 +1083,18 @@
         svrgc3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrgc3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E20B800 | MXM(TmmM,    REG(XT), 0x00))                     \
-        EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 #define svrgc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /*****************   packed byte-precision integer compare   ******************/
 
@@ -982,8 +1111,10 @@
 
 #define mingb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E206C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E206C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), signed */
 
@@ -998,8 +1129,10 @@
 
 #define mingc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E206C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E206C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), unsigned */
 
@@ -1014,8 +1147,10 @@
 
 #define maxgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E206400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E206400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), signed */
 
@@ -1030,8 +1165,10 @@
 
 #define maxgc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E206400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E206400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -1046,8 +1183,10 @@
 
 #define ceqgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E208C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E208C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1063,8 +1202,10 @@
 
 #define cnegb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6E208C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -1080,8 +1221,10 @@
 
 #define cltgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E203400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6E203400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -1096,8 +1239,10 @@
 
 #define cltgc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E203400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4E203400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1112,8 +1257,10 @@
 
 #define clegb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E203C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6E203C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1128,8 +1275,10 @@
 
 #define clegc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E203C00 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x4E203C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1144,8 +1293,10 @@
 
 #define cgtgb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E203400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E203400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -1160,8 +1311,10 @@
 
 #define cgtgc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E203400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E203400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1176,8 +1329,10 @@
 
 #define cgegb3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E203C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E203C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1192,20 +1347,37 @@
 
 #define cgegc3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E203C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E203C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE08_128     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL08_128     0x10    /*  all satisfy the condition */
 
-#define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4E31B800 | MXM(TmmM,    REG(XS), 0x00))                     \
-        EMITW(0x0E012C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##08_128))                     \
+        EMITW(0x0E012C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##08_128))                     \
         jezxx_lb(lb)
 
+#define mkjgb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 16 if all elems of S are -1 */
+
+#define mlngb_rr(RD, XS)                                                    \
+        STT(TmmM)                                                           \
+        EMITW(0x0F0C8400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x9E660000 | MXM(REG(RD), TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        ctozx_rx(W(RD))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -115,7 +115,7 @@
 
 #if (defined RT_SIMD_CODE)
 
-#if (RT_128X2 != 0) && (RT_SIMD_COMPAT_XMM > 0)
+#if (RT_128X2 != 0)
 
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
@@ -143,6 +143,15 @@
         EMITW(0x3D800000 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x3D800000 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvuax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))
+
+#define mvuax_st(XS, MD, DD)                                                \
+        movax_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -152,19 +161,25 @@
 
 #define mmvax_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmM,    Tmm0+16))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmN,    Tmm0+16))                  \
+        LDT(TmmN)
 
 #define mmvax_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), A2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x6EA01C00 | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
-        EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        EMITW(0x6EA01C00 | MXM(TmmN,    RYG(XS), Tmm0+16))                  \
+        EMITW(0x3D800000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        LDT(TmmN)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
@@ -180,10 +195,13 @@
 
 #define andax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E201C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E201C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ann (G = ~G & S), (D = ~S & T) if (#D != #T) */
 
@@ -199,10 +217,13 @@
 
 #define annax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E601C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E601C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E601C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* orr (G = G | S), (D = S | T) if (#D != #T) */
 
@@ -218,10 +239,13 @@
 
 #define orrax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EA01C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EA01C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* orn (G = ~G | S), (D = ~S | T) if (#D != #T) */
 
@@ -237,10 +261,13 @@
 
 #define ornax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE01C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EE01C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EE01C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* xor (G = G ^ S), (D = S ^ T) if (#D != #T) */
 
@@ -256,10 +283,13 @@
 
 #define xorax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E201C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* not (G = ~G), (D = ~S) */
 
@@ -286,10 +316,13 @@
 
 #define addax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E608400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E608400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E608400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, unsigned */
 
@@ -305,10 +338,13 @@
 
 #define adsax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E600C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E600C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E600C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, signed */
 
@@ -324,10 +360,13 @@
 
 #define adsan3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E600C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E600C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E600C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -343,10 +382,13 @@
 
 #define subax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E608400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E608400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E608400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, unsigned */
 
@@ -362,10 +404,13 @@
 
 #define sbsax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E602C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E602C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E602C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, signed */
 
@@ -381,10 +426,13 @@
 
 #define sbsan3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E602C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E602C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E602C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -400,10 +448,13 @@
 
 #define mulax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E609C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E609C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E609C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -424,10 +475,15 @@
 
 #define shlax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E020400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E020400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -448,11 +504,17 @@
 
 #define shrax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E020400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E020400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6E60B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -473,11 +535,17 @@
 
 #define shran3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E020400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x4E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E020400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6E60B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -494,10 +562,13 @@
 
 #define svlax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -509,19 +580,25 @@
         svrax3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrax3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E60B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E60B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6E60B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svrax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E60B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -533,19 +610,35 @@
         svran3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svran3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E60B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E60B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x4E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6E60B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x4E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svran3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4E604400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E60B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4E604400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
+
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswax_rr(XD, XS)                                                    \
+        EMITW(0x4E201800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x4E201800 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax_rr(W(XD), W(XD))
 
 /*****************   packed half-precision integer compare   ******************/
 
@@ -563,10 +656,13 @@
 
 #define minax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E606C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E606C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E606C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), signed */
 
@@ -582,10 +678,13 @@
 
 #define minan3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E606C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E606C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E606C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), unsigned */
 
@@ -601,10 +700,13 @@
 
 #define maxax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E606400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E606400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E606400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), signed */
 
@@ -620,10 +722,13 @@
 
 #define maxan3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E606400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E606400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E606400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -639,10 +744,13 @@
 
 #define ceqax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E608C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E608C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E608C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -652,19 +760,34 @@
 #define cneax_ld(XG, MS, DS)                                                \
         cneax3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneax3rr(XD, XS, XT)                                                \
         EMITW(0x6E608C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
         EMITW(0x6E608C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneax3rr(XD, XS, XT)                                                \
+        EMITW(0x6E608C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E608C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E608C00 | MXM(REG(XD), REG(XS), TmmM))                     \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E608C00 | MXM(RYG(XD), RYG(XS), TmmM))                     \
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E608C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)                                                           \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -681,10 +804,13 @@
 
 #define cltax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E603400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E603400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E603400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -700,10 +826,13 @@
 
 #define cltan3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E603400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E603400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E603400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -719,10 +848,13 @@
 
 #define cleax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E603C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E603C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E603C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -738,10 +870,13 @@
 
 #define clean3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E603C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E603C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E603C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -757,10 +892,13 @@
 
 #define cgtax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E603400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E603400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E603400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -776,10 +914,13 @@
 
 #define cgtan3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E603400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E603400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E603400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -795,10 +936,13 @@
 
 #define cgeax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E603C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E603C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E603C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -814,24 +958,32 @@
 
 #define cgean3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E603C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E603C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E603C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE16_256     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_256     0x08    /*  all satisfy the condition */
 
-#define mkjax_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjax_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4E201C00 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                   (0x08 - RT_SIMD_MASK_##mask##16_256) << 20)               \
         EMITW(0x4E71B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x0E022C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##16_256))                     \
+        EMITW(0x0E022C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##16_256))                     \
         jezxx_lb(lb)
 
+#define mkjax_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjax_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -843,19 +995,25 @@
 
 #define mmvab_ld(XG, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    Tmm0))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmM,    Tmm0+16))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EA01C00 | MXM(RYG(XG), TmmN,    Tmm0+16))                  \
+        LDT(TmmN)
 
 #define mmvab_st(XS, MG, DG)                                                \
         AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), A2(DG), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
-        EMITW(0x6EA01C00 | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
-        EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        EMITW(0x6EA01C00 | MXM(TmmN,    RYG(XS), Tmm0+16))                  \
+        EMITW(0x3D800000 | MPM(TmmN,    MOD(MG), VYL(DG), B4(DG), L2(DG)))  \
+        LDT(TmmN)
 
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
@@ -875,10 +1033,13 @@
 
 #define addab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E208400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E208400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E208400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, unsigned */
 
@@ -894,10 +1055,13 @@
 
 #define adsab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E200C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E200C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E200C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ads (G = G + S), (D = S + T) if (#D != #T) - saturate, signed */
 
@@ -913,10 +1077,13 @@
 
 #define adsac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E200C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E200C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E200C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -932,10 +1099,13 @@
 
 #define subab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E208400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E208400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E208400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, unsigned */
 
@@ -951,10 +1121,13 @@
 
 #define sbsab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E202C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E202C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E202C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sbs (G = G - S), (D = S - T) if (#D != #T) - saturate, signed */
 
@@ -970,10 +1143,13 @@
 
 #define sbsac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E202C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E202C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E202C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -989,10 +1165,13 @@
 
 #define mulab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E209C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E209C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E209C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1013,10 +1192,15 @@
 
 #define shlab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E010400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E010400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1037,11 +1221,17 @@
 
 #define shrab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E010400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E010400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6E20B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #T) - plain, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1062,11 +1252,17 @@
 
 #define shrac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E010400 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x4E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITX(0x3DC00000 | MPM(TmmN,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITX(0x4E010400 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITX(0x6E20B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1083,10 +1279,13 @@
 
 #define svlab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1098,19 +1297,25 @@
         svrab3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrab3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E20B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E20B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6E20B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svrab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x6E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E20B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x6E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* svr (G = G >> S), (D = S >> T) if (#D != #T) - variable, signed
  * for maximum compatibility: shift count must be modulo elem-size */
@@ -1122,19 +1327,25 @@
         svrac3ld(W(XG), W(XG), W(MS), W(DS))
 
 #define svrac3rr(XD, XS, XT)                                                \
+        STT(TmmM)                                                           \
         EMITW(0x6E20B800 | MXM(TmmM,    REG(XT), 0x00))                     \
         EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x6E20B800 | MXM(TmmM,    RYG(XT), 0x00))                     \
-        EMITW(0x4E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x6E20B800 | MXM(TmmN,    RYG(XT), 0x00))                     \
+        EMITW(0x4E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 #define svrac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4E204400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E20B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x4E204400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E20B800 | MXM(TmmN,    TmmN,    0x00))                     \
+        EMITW(0x4E204400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /*****************   packed half-precision integer compare   ******************/
 
@@ -1152,10 +1363,13 @@
 
 #define minab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E206C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E206C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E206C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), signed */
 
@@ -1171,10 +1385,13 @@
 
 #define minac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E206C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E206C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E206C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), unsigned */
 
@@ -1190,10 +1407,13 @@
 
 #define maxab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E206400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E206400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E206400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T), signed */
 
@@ -1209,10 +1429,13 @@
 
 #define maxac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E206400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E206400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E206400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -1228,10 +1451,13 @@
 
 #define ceqab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E208C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E208C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E208C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -1241,19 +1467,34 @@
 #define cneab_ld(XG, MS, DS)                                                \
         cneab3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneab3rr(XD, XS, XT)                                                \
         EMITW(0x6E208C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
         EMITW(0x6E208C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneab3rr(XD, XS, XT)                                                \
+        EMITW(0x6E208C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E208C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E208C00 | MXM(REG(XD), REG(XS), TmmM))                     \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E208C00 | MXM(RYG(XD), RYG(XS), TmmM))                     \
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E208C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)                                                           \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), unsigned */
@@ -1270,10 +1511,13 @@
 
 #define cltab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E203400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E203400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E203400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T), signed */
 
@@ -1289,10 +1533,13 @@
 
 #define cltac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E203400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E203400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E203400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1308,10 +1555,13 @@
 
 #define cleab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E203C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E203C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E203C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1327,10 +1577,13 @@
 
 #define cleac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E203C00 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E203C00 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E203C00 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1346,10 +1599,13 @@
 
 #define cgtab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E203400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E203400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E203400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T), signed */
 
@@ -1365,10 +1621,13 @@
 
 #define cgtac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E203400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E203400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E203400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), unsigned */
 
@@ -1384,10 +1643,13 @@
 
 #define cgeab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E203C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E203C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E203C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T), signed */
 
@@ -1403,24 +1665,46 @@
 
 #define cgeac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E203C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E203C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E203C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
 #define RT_SIMD_MASK_NONE08_256     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL08_256     0x10    /*  all satisfy the condition */
 
-#define mkjab_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjab_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        STT(TmmM)                                                           \
         EMITW(0x4E201C00 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                   (0x10 - RT_SIMD_MASK_##mask##08_256) << 19)               \
         EMITW(0x4E31B800 | MXM(TmmM,    TmmM,    0x00))                     \
-        EMITW(0x0E012C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##08_256))                     \
+        EMITW(0x0E012C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##08_256))                     \
         jezxx_lb(lb)
 
+#define mkjab_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjab_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 32 if all elems of S are -1 */
+
+#define mlnab_rr(RD, XS)                                                    \
+        STT(TmmM)                                                           \
+        EMITW(0x0F0C8400 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x9E660000 | MXM(REG(RD), TmmM,    0x00))                     \
+        EMITW(0x0F0C8400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x9E660000 | MXM(TMxx,    TmmM,    0x00))                     \
+        LDT(TmmM)                                                           \
+        ctozx_rx(W(RD))                                                     \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -140,6 +140,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), F1(DD)))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))
+
+#define mvumx_st(XS, MD, DD)                                                \
+        movmx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -350,6 +359,24 @@
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
+#if (RT_SVEX1 == 8) /* SVE2: unpredicated 3-op mul */
+
+#define mulmx_rr(XG, XS)                                                    \
+        mulmx3rr(W(XG), W(XG), W(XS))
+
+#define mulmx_ld(XG, MS, DS)                                                \
+        mulmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulmx3rr(XD, XS, XT)                                                \
+        EMITW(0x04606000 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulmx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04606000 | MXM(REG(XD), REG(XS), TmmM))
+
+#else  /* RT_SVEX1 != 8 */
+
 #define mulmx_rr(XG, XS)                                                    \
         EMITW(0x04500000 | MXM(REG(XG), REG(XS), 0x00))
 
@@ -366,6 +393,8 @@
         movmx_rr(W(XD), W(XS))                                              \
         mulmx_ld(W(XD), W(MT), W(DT))
 
+#endif /* RT_SVEX1 != 8 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -486,6 +515,15 @@
         movmx_rr(W(XD), W(XS))                                              \
         svrmn_ld(W(XD), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswmx_rr(XD, XS)                                                    \
+        EMITW(0x05648000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        bswmx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -765,13 +803,16 @@
 #define RT_SIMD_MASK_NONE16_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04582000 | MXM(TmmM,    REG(XS), 0x00) |                    \
                           RT_SIMD_MASK_##mask##16_SVE << 17)                \
-        EMITW(0x0E022C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##16_SVE))                     \
+        EMITW(0x0E022C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##16_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -896,6 +937,24 @@
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
+#if (RT_SVEX1 == 8) /* SVE2: unpredicated 3-op mul */
+
+#define mulmb_rr(XG, XS)                                                    \
+        mulmb3rr(W(XG), W(XG), W(XS))
+
+#define mulmb_ld(XG, MS, DS)                                                \
+        mulmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulmb3rr(XD, XS, XT)                                                \
+        EMITW(0x04206000 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulmb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04206000 | MXM(REG(XD), REG(XS), TmmM))
+
+#else  /* RT_SVEX1 != 8 */
+
 #define mulmb_rr(XG, XS)                                                    \
         EMITW(0x04100000 | MXM(REG(XG), REG(XS), 0x00))
 
@@ -912,6 +971,8 @@
         movmx_rr(W(XD), W(XS))                                              \
         mulmb_ld(W(XD), W(MT), W(DT))
 
+#endif /* RT_SVEX1 != 8 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1311,13 +1372,24 @@
 #define RT_SIMD_MASK_NONE08_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL08_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04182000 | MXM(TmmM,    REG(XS), 0x00) |                    \
                           RT_SIMD_MASK_##mask##08_SVE << 17)                \
-        EMITW(0x0E012C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##08_SVE))                     \
+        EMITW(0x0E012C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##08_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = J if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        EMITW(0x25008000 | MXM(0x01,    REG(XS), 0x00))                     \
+        EMITW(0x25904000 | MXM(0x01,    0x01,    0x00))                     \
+        EMITW(0x25208000 | MXM(REG(RD), 0x01,    0x00))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -143,6 +143,15 @@
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), K1(DD)))  \
         EMITW(0xE5804000 | MPM(RYG(XS), MOD(MD), VZL(DD), B3(DD), K1(DD)))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))
+
+#define mvumx_st(XS, MD, DD)                                                \
+        movmx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -553,6 +562,16 @@
         movmx_rr(W(XD), W(XS))                                              \
         svrmn_ld(W(XD), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswmx_rr(XD, XS)                                                    \
+        EMITW(0x05648000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x05648000 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        bswmx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -914,15 +933,18 @@
 #define RT_SIMD_MASK_NONE16_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04203000 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                      (1 - RT_SIMD_MASK_##mask##16_SVE) << 22)               \
         EMITW(0x04582000 | MXM(TmmM,    TmmM,    0x00) |                    \
                           RT_SIMD_MASK_##mask##16_SVE << 17)                \
-        EMITW(0x0E022C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##16_SVE))                     \
+        EMITW(0x0E022C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##16_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -1595,15 +1617,32 @@
 #define RT_SIMD_MASK_NONE08_SVE     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL08_SVE     0x01    /*  all satisfy the condition */
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x04203000 | MXM(TmmM,    REG(XS), RYG(XS)) |                 \
                      (1 - RT_SIMD_MASK_##mask##08_SVE) << 22)               \
         EMITW(0x04182000 | MXM(TmmM,    TmmM,    0x00) |                    \
                           RT_SIMD_MASK_##mask##08_SVE << 17)                \
-        EMITW(0x0E012C00 | MXM(TEax,    TmmM,    0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##08_SVE))                     \
+        EMITW(0x0E012C00 | MXM(TMxx,    TmmM,    0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##08_SVE))                     \
         jezxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = J if all elems of S are -1,
+ * upper half counts only if BRKBS flags the lower half as fully active */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        EMITW(0x25008000 | MXM(0x01,    RYG(XS), 0x00))                     \
+        EMITW(0x25904000 | MXM(0x01,    0x01,    0x00))                     \
+        EMITW(0x25208000 | MXM(TMxx,    0x01,    0x00))                     \
+        EMITW(0x25008000 | MXM(0x01,    REG(XS), 0x00))                     \
+        EMITW(0x25D04000 | MXM(0x01,    0x01,    0x00))                     \
+        EMITW(0x25208000 | MXM(REG(RD), 0x01,    0x00))                     \
+        EMITW(0x1A803000 | MRM(TMxx,    TMxx,    TZxx))                     \
+        EMITW(0x0B000000 | MRM(REG(RD), REG(RD), TMxx))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -156,8 +156,10 @@
 
 #define addgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E401400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E401400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -172,8 +174,10 @@
 
 #define subgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EC01400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EC01400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -188,8 +192,10 @@
 
 #define mulgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E401C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E401C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* div (G = G / S), (D = S / T) if (#D != #T) */
 
@@ -204,8 +210,10 @@
 
 #define divgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E403C00 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E403C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sqr (D = sqrt S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -215,8 +223,10 @@
 
 #define sqrgs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EF9F800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EF9F800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -246,8 +256,10 @@
 
 #define fmags_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E400C00 | MXM(REG(XG), REG(XS), TmmM))
+        EMITW(0x4E400C00 | MXM(REG(XG), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* fms (G = G - S * T) if (#G != #S && #G != #T) */
 
@@ -256,8 +268,10 @@
 
 #define fmsgs_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EC00C00 | MXM(REG(XG), REG(XS), TmmM))
+        EMITW(0x4EC00C00 | MXM(REG(XG), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /**************   packed half-precision floating-point compare   **************/
 
@@ -274,8 +288,10 @@
 
 #define mings3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4EC03400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4EC03400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
@@ -290,8 +306,10 @@
 
 #define maxgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E403400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E403400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -306,8 +324,10 @@
 
 #define ceqgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x4E402400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x4E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -323,8 +343,10 @@
 
 #define cnegs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -340,8 +362,10 @@
 
 #define cltgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EC02400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6EC02400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -356,8 +380,10 @@
 
 #define clegs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E402400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x6E402400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -372,8 +398,10 @@
 
 #define cgtgs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6EC02400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6EC02400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -388,8 +416,10 @@
 
 #define cgegs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
-        EMITW(0x6E402400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x6E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
@@ -405,16 +435,20 @@
 
 #define rnzgs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EF99800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvzgs_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x4EF9B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvzgs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EF9B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EF9B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvp (D = fp-to-signed-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -424,16 +458,20 @@
 
 #define rnpgs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EF98800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EF98800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvpgs_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x4EF9A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvpgs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EF9A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EF9A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvm (D = fp-to-signed-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -443,16 +481,20 @@
 
 #define rnmgs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E799800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E799800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvmgs_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x4E79B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvmgs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E79B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E79B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvn (D = fp-to-signed-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -462,16 +504,20 @@
 
 #define rnngs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E798800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E798800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvngs_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x4E79A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cvngs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E79A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E79A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvt (D = fp-to-signed-int S)
  * rounding mode comes from control register (set in FCTRL blocks) */
@@ -481,8 +527,10 @@
 
 #define rndgs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EF99800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cvtgs_rr(XD, XS)                                                    \
         rndgs_rr(W(XD), W(XS))                                              \
@@ -520,8 +568,10 @@
 
 #define cvtgn_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E79D800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E79D800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cvn (D = unsigned-int-to-fp S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks) */
@@ -540,8 +590,10 @@
 
 #define cvtgx_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E79D800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E79D800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -551,16 +603,20 @@
 
 #define ruzgs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EF99800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cuzgs_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x6EF9B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cuzgs_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EF9B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EF9B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cup (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -570,16 +626,20 @@
 
 #define rupgs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4EF98800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4EF98800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cupgs_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x6EF9A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cupgs_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EF9A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EF9A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cum (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -589,16 +649,20 @@
 
 #define rumgs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E799800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E799800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cumgs_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x6E79B800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cumgs_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E79B800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E79B800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cun (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -608,16 +672,20 @@
 
 #define rungs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x4E798800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x4E798800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cungs_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x6E79A800 | MXM(REG(XD), REG(XS), 0x00))
 
 #define cungs_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6E79A800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6E79A800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* cut (D = fp-to-unsigned-int S)
  * rounding mode comes from control register (set in FCTRL blocks) */
@@ -627,8 +695,10 @@
 
 #define rudgs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
-        EMITW(0x6EF99800 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x6EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 #define cutgs_rr(XD, XS)                                                    \
         rudgs_rr(W(XD), W(XS))                                              \
@@ -683,8 +753,10 @@
 
 #define addns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1EE02800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1EE02800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -699,8 +771,10 @@
 
 #define subns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1EE03800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1EE03800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -715,8 +789,10 @@
 
 #define mulns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1EE00800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1EE00800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* div (G = G / S), (D = S / T) if (#D != #T) */
 
@@ -731,8 +807,10 @@
 
 #define divns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1EE01800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1EE01800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* sqr (D = sqrt S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -742,8 +820,10 @@
 
 #define sqrns_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MS), VHL(DS), B1(DS), P1(DS)))  \
-        EMITW(0x1EE1C000 | MXM(REG(XD), TmmM,    0x00))
+        EMITW(0x1EE1C000 | MXM(REG(XD), TmmM,    0x00))                     \
+        LDT(TmmM)
 
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -773,8 +853,10 @@
 
 #define fmans_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1FC00000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)
+        EMITW(0x1FC00000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)     \
+        LDT(TmmM)
 
 /* fms (G = G - S * T) if (#G != #S && #G != #T) */
 
@@ -783,8 +865,10 @@
 
 #define fmsns_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1FC08000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)
+        EMITW(0x1FC08000 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 10)     \
+        LDT(TmmM)
 
 /**************   scalar half-precision floating-point compare   **************/
 
@@ -801,8 +885,10 @@
 
 #define minns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1EE05800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1EE05800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
@@ -817,8 +903,10 @@
 
 #define maxns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x1EE04800 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x1EE04800 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -833,8 +921,10 @@
 
 #define ceqns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x5E402400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x5E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -850,8 +940,10 @@
 
 #define cnens3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
         EMITW(0x5E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)                                                           \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -867,8 +959,10 @@
 
 #define cltns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7EC02400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x7EC02400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -883,8 +977,10 @@
 
 #define clens3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7E402400 | MXM(REG(XD), TmmM,    REG(XS)))
+        EMITW(0x7E402400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
+        LDT(TmmM)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -899,8 +995,10 @@
 
 #define cgtns3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7EC02400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x7EC02400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -915,8 +1013,10 @@
 
 #define cgens3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x7C400000 | MPM(TmmM,    MOD(MT), VHL(DT), B1(DT), P1(DT)))  \
-        EMITW(0x7E402400 | MXM(REG(XD), REG(XS), TmmM))
+        EMITW(0x7E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        LDT(TmmM)
 
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
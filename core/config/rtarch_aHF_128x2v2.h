@@ -115,7 +115,7 @@
 
 #if (defined RT_SIMD_CODE)
 
-#if (RT_128X2 != 0) && (RT_SIMD_COMPAT_XMM > 0)
+#if (RT_128X2 != 0)
 
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
@@ -158,10 +158,13 @@
 
 #define addas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E401400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E401400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E401400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -177,10 +180,13 @@
 
 #define subas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EC01400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EC01400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EC01400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -196,10 +202,13 @@
 
 #define mulas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E401C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E401C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E401C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* div (G = G / S), (D = S / T) if (#D != #T) */
 
@@ -215,10 +224,13 @@
 
 #define divas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E403C00 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E403C00 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E403C00 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* sqr (D = sqrt S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -229,10 +241,13 @@
 
 #define sqras_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EF9F800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EF9F800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EF9F800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
@@ -241,12 +256,24 @@
         EMITW(0x4EF9D800 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x4EF9D800 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcsas_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x4E403C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x6E401C00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0x4E403C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x6E401C00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcsas_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x4E403C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x4E403C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x6E401C00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x6E401C00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 /* rsq (D = 1.0 / sqrt S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -254,6 +281,8 @@
         EMITW(0x6EF9D800 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x6EF9D800 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rssas_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x6E401C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x4EC03C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
@@ -262,6 +291,18 @@
         EMITW(0x4EC03C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x6E401C00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rssas_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x6E401C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x6E401C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x4EC03C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x4EC03C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x6E401C00 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x6E401C00 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 /* fma (G = G + S * T) if (#G != #S && #G != #T) */
 
 #define fmaas_rr(XG, XS, XT)                                                \
@@ -270,10 +311,13 @@
 
 #define fmaas_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E400C00 | MXM(REG(XG), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E400C00 | MXM(RYG(XG), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E400C00 | MXM(RYG(XG), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* fms (G = G - S * T) if (#G != #S && #G != #T) */
 
@@ -283,10 +327,13 @@
 
 #define fmsas_ld(XG, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EC00C00 | MXM(REG(XG), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EC00C00 | MXM(RYG(XG), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EC00C00 | MXM(RYG(XG), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /**************   packed half-precision floating-point compare   **************/
 
@@ -304,10 +351,13 @@
 
 #define minas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EC03400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4EC03400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4EC03400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
@@ -323,10 +373,13 @@
 
 #define maxas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E403400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E403400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E403400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
@@ -342,10 +395,13 @@
 
 #define ceqas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E402400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E402400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
 
@@ -355,19 +411,34 @@
 #define cneas_ld(XG, MS, DS)                                                \
         cneas3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneas3rr(XD, XS, XT)                                                \
         EMITW(0x4E402400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
         EMITW(0x4E402400 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneas3rr(XD, XS, XT)                                                \
+        EMITW(0x4E402400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E402400 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
         EMITW(0x6E205800 | MXM(REG(XD), REG(XD), 0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x4E402400 | MXM(RYG(XD), RYG(XS), TmmM))                     \
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x4E402400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)                                                           \
         EMITW(0x6E205800 | MXM(RYG(XD), RYG(XD), 0x00))
 
 /* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
@@ -384,10 +455,13 @@
 
 #define cltas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EC02400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EC02400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EC02400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
 
@@ -403,10 +477,13 @@
 
 #define cleas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E402400 | MXM(REG(XD), TmmM,    REG(XS)))                  \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E402400 | MXM(RYG(XD), TmmM,    RYG(XS)))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E402400 | MXM(RYG(XD), TmmN,    RYG(XS)))                  \
+        LDT(TmmN)
 
 /* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
 
@@ -422,10 +499,13 @@
 
 #define cgtas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6EC02400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6EC02400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6EC02400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
 
@@ -441,10 +521,13 @@
 
 #define cgeas3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E402400 | MXM(REG(XD), REG(XS), TmmM))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
-        EMITW(0x6E402400 | MXM(RYG(XD), RYG(XS), TmmM))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6E402400 | MXM(RYG(XD), RYG(XS), TmmN))                     \
+        LDT(TmmN)
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
@@ -461,10 +544,13 @@
 
 #define rnzas_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EF99800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EF99800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvzas_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x4EF9B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -472,10 +558,13 @@
 
 #define cvzas_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EF9B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EF9B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EF9B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvp (D = fp-to-signed-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -486,10 +575,13 @@
 
 #define rnpas_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EF98800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EF98800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EF98800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvpas_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x4EF9A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -497,10 +589,13 @@
 
 #define cvpas_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EF9A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EF9A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EF9A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvm (D = fp-to-signed-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -511,10 +606,13 @@
 
 #define rnmas_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E799800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E799800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E799800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvmas_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x4E79B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -522,10 +620,13 @@
 
 #define cvmas_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E79B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E79B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E79B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvn (D = fp-to-signed-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -536,10 +637,13 @@
 
 #define rnnas_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E798800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E798800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E798800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvnas_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x4E79A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -547,10 +651,13 @@
 
 #define cvnas_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E79A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E79A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E79A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvt (D = fp-to-signed-int S)
  * rounding mode comes from control register (set in FCTRL blocks) */
@@ -561,10 +668,13 @@
 
 #define rndas_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EF99800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EF99800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cvtas_rr(XD, XS)                                                    \
         rndas_rr(W(XD), W(XS))                                              \
@@ -607,10 +717,13 @@
 
 #define cvtan_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E79D800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E79D800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E79D800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cvn (D = unsigned-int-to-fp S)
  * rounding mode encoded directly (cannot be used in FCTRL blocks) */
@@ -630,10 +743,13 @@
 
 #define cvtax_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E79D800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E79D800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E79D800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -644,10 +760,13 @@
 
 #define ruzas_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EF99800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EF99800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cuzas_rr(XD, XS)     /* round towards zero */                       \
         EMITW(0x6EF9B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -655,10 +774,13 @@
 
 #define cuzas_ld(XD, MS, DS) /* round towards zero */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EF9B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EF9B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EF9B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cup (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -669,10 +791,13 @@
 
 #define rupas_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4EF98800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4EF98800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4EF98800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cupas_rr(XD, XS)     /* round towards +inf */                       \
         EMITW(0x6EF9A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -680,10 +805,13 @@
 
 #define cupas_ld(XD, MS, DS) /* round towards +inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EF9A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EF9A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EF9A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cum (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -694,10 +822,13 @@
 
 #define rumas_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E799800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E799800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E799800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cumas_rr(XD, XS)     /* round towards -inf */                       \
         EMITW(0x6E79B800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -705,10 +836,13 @@
 
 #define cumas_ld(XD, MS, DS) /* round towards -inf */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E79B800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E79B800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E79B800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cun (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks) */
@@ -719,10 +853,13 @@
 
 #define runas_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x4E798800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x4E798800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x4E798800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cunas_rr(XD, XS)     /* round towards near */                       \
         EMITW(0x6E79A800 | MXM(REG(XD), REG(XS), 0x00))                     \
@@ -730,10 +867,13 @@
 
 #define cunas_ld(XD, MS, DS) /* round towards near */                       \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E79A800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6E79A800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6E79A800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 /* cut (D = fp-to-unsigned-int S)
  * rounding mode comes from control register (set in FCTRL blocks) */
@@ -744,10 +884,13 @@
 
 #define rudas_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        STT(TmmM)                                                           \
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6EF99800 | MXM(REG(XD), TmmM,    0x00))                     \
-        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
-        EMITW(0x6EF99800 | MXM(RYG(XD), TmmM,    0x00))
+        SWT(TmmM, TmmN)                                                     \
+        EMITW(0x3DC00000 | MPM(TmmN,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
+        EMITW(0x6EF99800 | MXM(RYG(XD), TmmN,    0x00))                     \
+        LDT(TmmN)
 
 #define cutas_rr(XD, XS)                                                    \
         rudas_rr(W(XD), W(XS))                                              \
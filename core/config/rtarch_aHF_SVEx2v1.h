@@ -241,12 +241,24 @@
         EMITW(0x654E3000 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x654E3000 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcsms_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x65401800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x65400800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0x65401800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x65400800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcsms_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x65401800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65401800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65400800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x65400800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 /* rsq (D = 1.0 / sqrt S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -254,6 +266,8 @@
         EMITW(0x654F3000 | MXM(REG(XD), REG(XS), 0x00))                     \
         EMITW(0x654F3000 | MXM(RYG(XD), RYG(XS), 0x00))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rssms_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x65400800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
         EMITW(0x65401C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
@@ -262,6 +276,18 @@
         EMITW(0x65401C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
         EMITW(0x65400800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rssms_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x65400800 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65400800 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65401C00 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x65401C00 | MXM(RYG(XS), RYG(XS), RYG(XG)))                  \
+        EMITW(0x65400800 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x65400800 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 /* fma (G = G + S * T) if (#G != #S && #G != #T) */
 
 #define fmams_rr(XG, XS, XT)                                                \
@@ -51,6 +51,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -292,6 +294,10 @@
 #define TEsi    0x06  /* r6 */
 #define TEdi    0x07  /* r7 */
 
+/* internal BASE register, used in place of Reax in mkj/mxj (SIMD masks) */
+
+#define RMxx    TMxx, 0x00, EMPTY
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -317,6 +323,10 @@
 #define Mesi    TEsi, TEsi, EMPTY
 #define Medi    TEdi, TEdi, EMPTY
 
+/* section-local frame from ASM_ENTER_S, SP-relative (see rtarch.h) */
+
+#define Mesp    SPxx, SPxx, EMPTY
+
 /* public scalable I/J/K/L*** definitions are now provided in rtbase.h */
 /* public scalable S/T/U/V*** definitions accept any register as index */
 /* fully explicit N*** takes index register and scale (1,2,3) for 2x/4x/8x */
@@ -359,10 +369,30 @@
 #define _DV(dp) ((dp) & 0x7FFFFFFF),    2, 2       /* native x86_64 long mode */
 #define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
 
+/* widest displacement of each TP1/TP2 type, checked in burst ld/st */
+
+#define DL00    0xFFF
+#define DL11    0xFFFF
+#define DL22    0x7FFFFFFF
+
 /* triplet pass-through wrapper */
 
 #define W(p1, p2, p3)       p1,  p2,  p3
 
+/* displacement pass-through advancer, used in SIMD burst ld/st
+ * keeps TP1/TP2 of the original displacement, DNCHK fails at assembly time
+ * if the advanced value no longer fits the widest displacement of its type */
+
+#define DN(dn, val, tp1, tp2)  ((val) + (dn)), tp1, tp2
+
+#define DNCHK(dn, val, tp1, tp2)                                            \
+        DNERR(((val) + (dn)) > DL##tp1##tp2)
+
+#define DNERR(cond) /* not portable, do not use outside */                  \
+        ASM_BEG ASM_OP1(.if, cond) ASM_END                                  \
+        ASM_BEG ASM_OP1(.error, "burst displacement overflow") ASM_END      \
+        ASM_BEG ASM_OP0(.endif) ASM_END
+
 /******************************************************************************/
 /**********************************   BASE   **********************************/
 /******************************************************************************/
@@ -731,6 +761,16 @@
         EMITW(0xE1E00000 | MRM(TMxx,    0x00,    TMxx))                     \
         EMITW(0xE5800000 | MDM(TMxx,    MOD(MG), VAL(DG), B3(DG), P1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswwx_rx(RG)                                                        \
+        EMITW(0xE6BF0F30 | MRM(REG(RG), 0x00,    REG(RG)))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1888,6 +1928,22 @@
 #define stack_la()   /* load all, 7 temps + [Redi - Reax], 14 regs total */ \
         EMITW(0xE8B05FFF | MRM(0x00,    SPxx,    0x00))
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        EMITW(0xE1A00000 | MRM(TEax,    0x00,    SPxx))                     \
+        EMITW(0xE3000000 | MRM(TDxx,    0x00,    0x00) |                    \
+                 (0xF0000 & ((sz) + 0x04) << 4) | (0xFFF & ((sz) + 0x04)))  \
+        EMITW(0xE0400000 | MRM(TDxx,    SPxx,    TDxx))                     \
+        EMITW(0xE3C00000 | MRM(TDxx,    TDxx,    0x00) | (RT_SIMD_ALIGN-1)) \
+        EMITW(0xE1A00000 | MRM(SPxx,    0x00,    TDxx))                     \
+        EMITW(0xE5800000 | MRM(TEax,    SPxx,    0x00) | (0xFFF & (sz)))
+
+#define stack_fl(sz)                                                        \
+        EMITW(0xE5900000 | MRM(SPxx,    SPxx,    0x00) | (0xFFF & (sz)))
+
 /************************* 16-bit subset instructions *************************/
 
 /* mov (D = S)
@@ -2236,6 +2292,16 @@
         EMITW(0xE1E00000 | MRM(TMxx,    0x00,    TMxx))                     \
         EMITW(0xE1C000B0 | MDM(TMxx,    MOD(MG), VAL(DG), BH(DG), PH(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: undefined */
+
+#define bswhx_rx(RG)                                                        \
+        EMITW(0xE6BF0FB0 | MRM(REG(RG), 0x00,    REG(RG)))
+
+#define bswhx_ld(RD, MS, DS)                                                \
+        movhx_ld(W(RD), W(MS), W(DS))                                       \
+        bswhx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -3090,6 +3156,21 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
         EMITW(0xE5C00000 | MDM(REG(RS), MOD(MD), VAL(DD), B3(DD), P1(DD)))
 
+/* mvb (D = S), bridges from 8-bit to 16-bit subset
+ * set-flags: no */
+
+#define mvbhn_rr(RD, RS)      /* move  8-bit to 16-bit with sign-extend */  \
+        movbn_rr(W(RD), W(RS))
+
+#define mvbhz_rr(RD, RS)      /* move  8-bit to 16-bit with zero-extend */  \
+        movbz_rr(W(RD), W(RS))
+
+#define mvbhn_ld(RD, MS, DS)  /* load  8-bit to 16-bit with sign-extend */  \
+        movbn_ld(W(RD), W(MS), W(DS))
+
+#define mvbhz_ld(RD, MS, DS)  /* load  8-bit to 16-bit with zero-extend */  \
+        movbz_ld(W(RD), W(MS), W(DS))
+
 /* and (G = G & S)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -4277,6 +4358,31 @@
 #define CMJ(cc, lb)                                                         \
         cc(lb)
 
+/* internal definitions for fp-compare-jump (cmj), vcmp (via vmrs) reports
+ * unordered (NaN) operands as NZCV = 0011, signed GT/GE conditions are used
+ * for GT_x, GE_x (only NE_x jumps on NaN as in C) */
+
+#define Fjeqxx_lb(lb)                                                       \
+        jeqxx_lb(lb)
+
+#define Fjnexx_lb(lb)                                                       \
+        jnexx_lb(lb)
+
+#define Fjltxx_lb(lb)                                                       \
+        jltxx_lb(lb)
+
+#define Fjlexx_lb(lb)                                                       \
+        jlexx_lb(lb)
+
+#define Fjgtxx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(bgt, lb) ASM_END
+
+#define Fjgexx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(bge, lb) ASM_END
+
+#define CMF(cc, lb)                                                         \
+        F##cc(lb)
+
 #endif /* RT_RTARCH_ARM_H */
 
 /******************************************************************************/
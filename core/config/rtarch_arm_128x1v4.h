@@ -1121,13 +1121,16 @@
 #define RT_SIMD_MASK_NONE32_128     0x00    /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_128     0x01    /*  all satisfy the condition */
 
-#define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjix_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0xF3B60200 | MXM(TmmM+0,  0x00,    REG(XS)))                  \
         EMITW(0xF3B20200 | MXM(TmmM+0,  0x00,    TmmM))                     \
-        EMITW(0xEE100B10 | MXM(TEax,    TmmM+0,  0x00))                     \
-        addwxZri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
+        EMITW(0xEE100B10 | MXM(TMxx,    TmmM+0,  0x00))                     \
+        addwxZri(RMxx, IB(RT_SIMD_MASK_##mask##32_128))                     \
         jezxx_lb(lb)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 #if (RT_128X1 < 4) /* ASIMDv4 is used here for ARMv8:AArch32 processors */
@@ -1895,6 +1898,15 @@
         EMITW(0xF3B903C0 | MXM(TmmM,    0x00,    TmmM))                     \
         EMITW(0xF2200440 | MXM(REG(XD), TmmM,    REG(XS)))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswix_rr(XD, XS)                                                    \
+        EMITW(0xF3B000C0 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -2154,6 +2166,19 @@
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0xF4000AAF | MXM(REG(XS), TPxx,    0x00))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvugx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0xF4200A0F | MXM(REG(XD), TPxx,    0x00))
+
+#define mvugx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0xF4000A0F | MXM(REG(XS), TPxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -2507,6 +2532,15 @@
         EMITW(0xF3B503C0 | MXM(TmmM,    0x00,    TmmM))                     \
         EMITW(0xF2100440 | MXM(REG(XD), TmmM,    REG(XS)))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswgx_rr(XD, XS)                                                    \
+        EMITW(0xF3B00140 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -2754,13 +2788,16 @@
 #define RT_SIMD_MASK_NONE16_128  0x00000000 /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_128  0xFFFCFFFC /*  all satisfy the condition */
 
-#define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0xF2100B10 | MXM(TmmM+0,  REG(XS)+0, REG(XS)+1))              \
         EMITW(0xF2100B10 | MXM(TmmM+0,  TmmM+0,    TmmM+1))                 \
-        EMITW(0xEE100B10 | MXM(TEax,    TmmM+0,    0x00))                   \
-        cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##16_128))                     \
+        EMITW(0xEE100B10 | MXM(TMxx,    TmmM+0,    0x00))                   \
+        cmpwx_ri(RMxx, IW(RT_SIMD_MASK_##mask##16_128))                     \
         jeqxx_lb(lb)
 
+#define mkjgx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -3272,13 +3309,33 @@
 #define RT_SIMD_MASK_NONE08_128  0x00000000 /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL08_128  0xFCFCFCFC /*  all satisfy the condition */
 
-#define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0xF2000B10 | MXM(TmmM+0,  REG(XS)+0, REG(XS)+1))              \
         EMITW(0xF2000B10 | MXM(TmmM+0,  TmmM+0,    TmmM+1))                 \
-        EMITW(0xEE100B10 | MXM(TEax,    TmmM+0,    0x00))                   \
-        cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##08_128))                     \
+        EMITW(0xEE100B10 | MXM(TMxx,    TmmM+0,    0x00))                   \
+        cmpwx_ri(RMxx, IW(RT_SIMD_MASK_##mask##08_128))                     \
         jeqxx_lb(lb)
 
+#define mkjgb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 16 if all elems of S are -1,
+ * S is narrowed to a 64-bit nibble-mask in D:TMxx, then ~mask is counted */
+
+#define mlngb_rr(RD, XS)                                                    \
+        EMITW(0xF28C0810 | MXM(TmmM+0,  0x00,    REG(XS)))                  \
+        EMITW(0xEC500B10 | MXM(REG(RD), TMxx,    TmmM+0))                   \
+        EMITW(0xE1E00000 | MRM(REG(RD), 0x00,    REG(RD)))                  \
+        EMITW(0xE6FF0F30 | MRM(REG(RD), 0x00,    REG(RD)))                  \
+        EMITW(0xE16F0F10 | MRM(REG(RD), 0x00,    REG(RD)))                  \
+        EMITW(0xE3500020 | MRM(0x00,    REG(RD), 0x00))                     \
+        EMITW(0x01E00000 | MRM(TMxx,    0x00,    TMxx))                     \
+        EMITW(0x06FF0F30 | MRM(TMxx,    0x00,    TMxx))                     \
+        EMITW(0x016F0F10 | MRM(TMxx,    0x00,    TMxx))                     \
+        EMITW(0x00800000 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0xE1A00120 | MRM(REG(RD), 0x00,    REG(RD)))
+
 /******************************************************************************/
 /**********************************   ELEM   **********************************/
 /******************************************************************************/
@@ -3668,6 +3725,16 @@
         EMITW(0xF4A0083F | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xF3000E00 | MXM(REG(XD), REG(XS), TmmM))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        EMITW(0xEEB40A40 | MXM(REG(XS), 0x00,    REG(XT)))                  \
+        EMITW(0xEEF1FA10)                                                   \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /**********************************   MODE   **********************************/
 /******************************************************************************/
@@ -3731,65 +3798,19 @@
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
 
-/* sregs */
+/* sregs, single vstm/vldm burst over q0-q12 (d0-d25) without pointer bumps */
 
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movix_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4000AAF | MXM(TmmM,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4000AAF | MXM(TmmC,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4000AAF | MXM(TmmD,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4000AAF | MXM(TmmE,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4000AAF | MXM(TmmF,    TEax,    0x00))
+        EMITW(0xECA00B20 | MXM(Tmm0,    TEax,    0x00)) /* d0-d15, wback */ \
+        EMITW(0xEC800B14 | MXM(TmmM,    TEax,    0x00)) /* d16-d25 */
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movix_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4200AAF | MXM(TmmM,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4200AAF | MXM(TmmC,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4200AAF | MXM(TmmD,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4200AAF | MXM(TmmE,    TEax,    0x00))                     \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        EMITW(0xF4200AAF | MXM(TmmF,    TEax,    0x00))
+        EMITW(0xECB00B20 | MXM(Tmm0,    TEax,    0x00)) /* d0-d15, wback */ \
+        EMITW(0xEC900B14 | MXM(TmmM,    TEax,    0x00)) /* d16-d25 */
 
 #endif /* RT_128X1 */
 
@@ -51,6 +51,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -172,6 +174,13 @@
 #define SLL ((A-1)*0x00000038)
 #define LSA ((A-1)*0x00000010)
 
+/* address add is 64-bit when base is SP (Mesp), even in 64/32-bit hybrid */
+#if   (defined RT_M32)
+#define ADS(br) ADR
+#elif (defined RT_M64)
+#define ADS(br) (ADR | (M((br) == SPxx) & 0x0000000C))
+#endif /* defined (RT_M32, RT_M64) */
+
 #define EMPTY1(em1) em1
 #define EMPTY2(em1, em2) em1 em2
 
@@ -244,7 +253,7 @@
 #define P11(dp) (0x00000000)
 #define C11(br, dp) C31(br, dp)
 #define A11(br, dp) C31(br, dp)                                             \
-                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADS(br))
 #define C31(br, dp) EMITW(0x34000000 | TDxx << 16 | (0xFFFF & (dp)))
 
 #define B12(br) (br)
@@ -252,7 +261,7 @@
 #define P12(dp) (0x00000000)
 #define C12(br, dp) C32(br, dp)
 #define A12(br, dp) C32(br, dp)                                             \
-                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADS(br))
 #define C32(br, dp) EMITW(0x3C000000 | TDxx << 16 | (0x7FFF & (dp) >> 16))  \
                     EMITW(0x34000000 | TDxx << 16 | TDxx << 21 |            \
                                                     (0xFFFF & (dp)))
@@ -313,6 +322,7 @@
 /* addressing   REG,  MOD,  SIB */
 
 #define Oeax    TEax, TEax, EMPTY
+#define Meax    TEax, TEax, EMPTY       /* internal (sregs) */
 
 #define Mecx    TEcx, TEcx, EMPTY
 #define Medx    TEdx, TEdx, EMPTY
@@ -328,6 +338,10 @@
 #define MegD    TEgD, TEgD, EMPTY
 #define MegE    TEgE, TEgE, EMPTY
 
+/* section-local frame from ASM_ENTER_S, SP-relative (see rtarch.h) */
+
+#define Mesp    SPxx, SPxx, EMPTY
+
 /* public scalable I/J/K/L*** definitions are now provided in rtbase.h */
 /* public scalable S/T/U/V*** definitions accept any register as index */
 /* fully explicit N*** takes index register and scale (1,2,3) for 2x/4x/8x */
@@ -417,10 +431,31 @@
 #define _DV(dp) ((dp) & 0x7FFFFFFF),    2, 2       /* native x86_64 long mode */
 #define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
 
+/* widest displacement of each TP1/TP2 type, checked in burst ld/st */
+
+#define DL00    0xFFF
+#define DL01    0x7FFF
+#define DL11    0xFFFF
+#define DL22    0x7FFFFFFF
+
 /* triplet pass-through wrapper */
 
 #define W(p1, p2, p3)       p1,  p2,  p3
 
+/* displacement pass-through advancer, used in SIMD burst ld/st
+ * keeps TP1/TP2 of the original displacement, DNCHK fails at assembly time
+ * if the advanced value no longer fits the widest displacement of its type */
+
+#define DN(dn, val, tp1, tp2)  ((val) + (dn)), tp1, tp2
+
+#define DNCHK(dn, val, tp1, tp2)                                            \
+        DNERR(((val) + (dn)) > DL##tp1##tp2)
+
+#define DNERR(cond) /* not portable, do not use outside */                  \
+        ASM_BEG ASM_OP1(.if, cond) ASM_END                                  \
+        ASM_BEG ASM_OP1(.error, "burst displacement overflow") ASM_END      \
+        ASM_BEG ASM_OP0(.endif) ASM_END
+
 /******************************************************************************/
 /**********************************   BASE   **********************************/
 /******************************************************************************/
@@ -816,6 +851,17 @@
         EMITW(0x00000027 | MRM(TDxx,    TZxx,    TDxx))                     \
         EMITW(0xAC000000 | MDM(TDxx,    MOD(MG), VAL(DG), B3(DG), P1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswwx_rx(RG)                                                        \
+        EMITW(0x7C0000A0 | MSM(REG(RG), REG(RG), 0x00))                     \
+        EMITW(0x00200402 | MSM(REG(RG), REG(RG), 0x00))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1989,7 +2035,7 @@
 
 #define adrxx_ld(RD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
-        EMITW(0x00000021 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
+        EMITW(0x00000021 | MRM(REG(RD), MOD(MS), TDxx) | ADS(MOD(MS)))
 
 /************************* pointer-sized instructions *************************/
 
@@ -2222,6 +2268,22 @@
         EMITW(0x8C000000 | MRM(0x00,    SPxx,    TEax) | (+0x00 & 0xFFFF))  \
         EMITW(0x24000000 | MRM(0x00,    SPxx,    SPxx) | (+0x60 & 0xFFFF))
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        EMITW(0x00000025 | MRM(TEax,    SPxx,    TZxx))                     \
+        EMITW(0x24000000 | MRM(0x00,    SPxx,    TDxx) |                    \
+                             (-((sz) + 0x04) & 0xFFFF))                     \
+        EMITW(0x24000000 | MRM(0x00,    TZxx,    TPxx) |                    \
+                             (-RT_SIMD_ALIGN & 0xFFFF))                     \
+        EMITW(0x00000024 | MRM(SPxx,    TDxx,    TPxx))                     \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TEax) | (+(sz) & 0xFFFF))
+
+#define stack_fl(sz)                                                        \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    SPxx) | (+(sz) & 0xFFFF))
+
 #endif /* (defined RT_M32) */
 
 /******************************************************************************/
@@ -166,7 +166,7 @@
 #define K21(dp) (0x01FF0000 & ((dp) & 0x010) << (14 - RT_SIMD_COMPAT_D12))
 #define C21(br, dp) EMITW(0x34000000 | TDxx << 16 | (0xFFFC & (dp)))
 #define A21(br, dp) C21(br, dp)                                             \
-                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADS(br))
 
 #define B22(br) (br)
 #define B42(br) TPxx
@@ -178,7 +178,7 @@
                     EMITW(0x34000000 | TDxx << 16 | TDxx << 21 |            \
                                                     (0xFFFC & (dp)))
 #define A22(br, dp) C22(br, dp)                                             \
-                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADR)
+                    EMITW(0x00000021 | MRM(TPxx,    (br),    TDxx) | ADS(br))
 
 /* configuration for vector/scalar compatibility mode */
 
@@ -206,6 +206,77 @@
 #define SJX(x)  x
 #endif /* RT_ENDIAN, RT_SIMD_COMPAT_D12, RT_ELEM_COMPAT_MSA */
 
+/* internal definitions for fp-compare-jump (cmj), $f31 is TmmM on r6 */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define FJ0(fm, fs, ft, lb)                                                 \
+        EMITW(0x46000032 | (fm) | MXM(0x00,    fs,      ft))                \
+        ASM_BEG ASM_OP1(bc1t, lb) ASM_END
+
+#define FJ1(fm, fs, ft, lb)                                                 \
+        EMITW(0x46000032 | (fm) | MXM(0x00,    fs,      ft))                \
+        ASM_BEG ASM_OP1(bc1f, lb) ASM_END
+
+#define FJ2(fm, fs, ft, lb)                                                 \
+        EMITW(0x46000034 | (fm) | MXM(0x00,    fs,      ft))                \
+        ASM_BEG ASM_OP1(bc1t, lb) ASM_END
+
+#define FJ3(fm, fs, ft, lb)                                                 \
+        EMITW(0x46000036 | (fm) | MXM(0x00,    fs,      ft))                \
+        ASM_BEG ASM_OP1(bc1t, lb) ASM_END
+
+#define FJ4(fm, fs, ft, lb)                                                 \
+        EMITW(0x46000034 | (fm) | MXM(0x00,    ft,      fs))                \
+        ASM_BEG ASM_OP1(bc1t, lb) ASM_END
+
+#define FJ5(fm, fs, ft, lb)                                                 \
+        EMITW(0x46000036 | (fm) | MXM(0x00,    ft,      fs))                \
+        ASM_BEG ASM_OP1(bc1t, lb) ASM_END
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define FJ0(fm, fs, ft, lb)                                                 \
+        EMITW(0x46800002 | (fm) | MXM(TmmM,    fs,      ft))                \
+        ASM_BEG ASM_OP2(bc1nez, $f31, lb) ASM_END
+
+#define FJ1(fm, fs, ft, lb)                                                 \
+        EMITW(0x46800002 | (fm) | MXM(TmmM,    fs,      ft))                \
+        ASM_BEG ASM_OP2(bc1eqz, $f31, lb) ASM_END
+
+#define FJ2(fm, fs, ft, lb)                                                 \
+        EMITW(0x46800004 | (fm) | MXM(TmmM,    fs,      ft))                \
+        ASM_BEG ASM_OP2(bc1nez, $f31, lb) ASM_END
+
+#define FJ3(fm, fs, ft, lb)                                                 \
+        EMITW(0x46800006 | (fm) | MXM(TmmM,    fs,      ft))                \
+        ASM_BEG ASM_OP2(bc1nez, $f31, lb) ASM_END
+
+#define FJ4(fm, fs, ft, lb)                                                 \
+        EMITW(0x46800004 | (fm) | MXM(TmmM,    ft,      fs))                \
+        ASM_BEG ASM_OP2(bc1nez, $f31, lb) ASM_END
+
+#define FJ5(fm, fs, ft, lb)                                                 \
+        EMITW(0x46800006 | (fm) | MXM(TmmM,    ft,      fs))                \
+        ASM_BEG ASM_OP2(bc1nez, $f31, lb) ASM_END
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define FJ6(fm, fs, ft, lb)                                                 \
+        FJ2(fm, fs, ft, lb)
+
+#define FJ7(fm, fs, ft, lb)                                                 \
+        FJ3(fm, fs, ft, lb)
+
+#define FJ8(fm, fs, ft, lb)                                                 \
+        FJ4(fm, fs, ft, lb)
+
+#define FJ9(fm, fs, ft, lb)                                                 \
+        FJ5(fm, fs, ft, lb)
+
+#define CMF(cc, fm, fs, ft, lb)                                             \
+        F##cc(fm, fs, ft, lb)
+
 /* registers    REG   (check mapping with ASM_ENTER/ASM_LEAVE in rtarch.h) */
 
 #define Tmm0    0x00  /* w0,  internal name for Xmm0 (in mmv) */
@@ -728,10 +799,13 @@
 #define SMF32_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(bnz.w, xs, lb) ASM_END
 
-#define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjix_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##32_128), EMPTY2)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1290,6 +1364,15 @@
     SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x78C0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswix_rr(XD, XS)                                                    \
+        EMITW(0x78000002 | MXM(REG(XD), REG(XS), 0x00) | 0x001B0000)
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1890,6 +1973,14 @@
         EMITW(0xC4000000 | MDM(TmmM,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
         EMITW(0x7980001A | MXM(REG(XD), TmmM,    REG(XS)))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        CMF(cc, 0x00000000, REG(XS), REG(XT), lb)
+
 /******************************************************************************/
 /**********************************   MODE   **********************************/
 /******************************************************************************/
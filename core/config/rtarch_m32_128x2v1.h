@@ -701,10 +701,13 @@
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
         ASM_BEG ASM_OP2(bnz.w, $w31, lb) ASM_END
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##32_256), EMPTY2)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1344,6 +1347,16 @@
     SJF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x78C0000D | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswcx_rr(XD, XS)                                                    \
+        EMITW(0x78000002 | MXM(REG(XD), REG(XS), 0x00) | 0x001B0000)        \
+        EMITW(0x78000002 | MXM(RYG(XD), RYG(XS), 0x00) | 0x001B0000)
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1645,35 +1658,21 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        movcx_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        movcx_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        movcx_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        movcx_st(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        movcx_st(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        movcx_st(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        movcx_st(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        movcx_st(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_256*4*15))                        \
         EMITW(0x78000027 | MXM(TmmZ,    TEax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x78000027 | MXM(TmmM,    TEax,    0x00))
@@ -1682,35 +1681,21 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        movcx_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        movcx_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        movcx_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        movcx_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        movcx_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        movcx_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        movcx_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        movcx_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_256*4*15))                        \
         EMITW(0x78000023 | MXM(TmmZ,    TEax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x78000023 | MXM(TmmM,    TEax,    0x00))
@@ -49,6 +49,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -548,6 +550,17 @@
         EMITW(0x00000027 | MRM(TDxx,    TZxx,    TDxx))                     \
         EMITW(0xFC000000 | MDM(TDxx,    MOD(MG), VAL(DG), B3(DG), P1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswzx_rx(RG)                                                        \
+        EMITW(0x7C0000A4 | MSM(REG(RG), REG(RG), 0x00))                     \
+        EMITW(0x7C000164 | MSM(REG(RG), REG(RG), 0x00))
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        bswzx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1692,6 +1705,22 @@
         EMITW(0xDC000000 | MRM(0x00,    SPxx,    TEax) | (+0x00 & 0xFFFF))  \
         EMITW(0x64000000 | MRM(0x00,    SPxx,    SPxx) | (+0xB0 & 0xFFFF))
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        EMITW(0x00000025 | MRM(TEax,    SPxx,    TZxx))                     \
+        EMITW(0x64000000 | MRM(0x00,    SPxx,    TDxx) |                    \
+                             (-((sz) + 0x08) & 0xFFFF))                     \
+        EMITW(0x64000000 | MRM(0x00,    TZxx,    TPxx) |                    \
+                             (-RT_SIMD_ALIGN & 0xFFFF))                     \
+        EMITW(0x00000024 | MRM(SPxx,    TDxx,    TPxx))                     \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TEax) | (+(sz) & 0xFFFF))
+
+#define stack_fl(sz)                                                        \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    SPxx) | (+(sz) & 0xFFFF))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
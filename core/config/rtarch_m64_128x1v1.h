@@ -574,10 +574,13 @@
 #define SMF64_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(bnz.d, xs, lb) ASM_END
 
-#define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjjx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##64_128), EMPTY2)
 
+#define mkjjx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1118,6 +1121,16 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x78E0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswjx_rr(XD, XS)                                                    \
+        EMITW(0x78000002 | MXM(REG(XD), REG(XS), 0x00) | 0x001B0000)        \
+        EMITW(0x7A000002 | MXM(REG(XD), REG(XD), 0x00) | 0x00B10000)
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1705,6 +1718,14 @@
         EMITW(0xD4000000 | MDM(TmmM,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
         EMITW(0x79A0001A | MXM(REG(XD), TmmM,    REG(XS)))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjts_rr(XS, XT, cc, lb)                                            \
+        CMF(cc, 0x00200000, REG(XS), REG(XT), lb)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -644,10 +644,13 @@
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
         ASM_BEG ASM_OP2(bnz.d, $w31, lb) ASM_END
 
-#define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjdx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##64_256), EMPTY2)
 
+#define mkjdx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjdx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1251,6 +1254,18 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
         EMITW(0x78E0000D | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswdx_rr(XD, XS)                                                    \
+        EMITW(0x78000002 | MXM(REG(XD), REG(XS), 0x00) | 0x001B0000)        \
+        EMITW(0x78000002 | MXM(RYG(XD), RYG(XS), 0x00) | 0x001B0000)        \
+        EMITW(0x7A000002 | MXM(REG(XD), REG(XD), 0x00) | 0x00B10000)        \
+        EMITW(0x7A000002 | MXM(RYG(XD), RYG(XD), 0x00) | 0x00B10000)
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -504,6 +504,16 @@
         EMITW(0x00000027 | MRM(TDxx,    TZxx,    TDxx))                     \
         EMITW(0xA4000000 | MDM(TDxx,    MOD(MG), VAL(DG), B3(DG), P1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: undefined */
+
+#define bswhx_rx(RG)                                                        \
+        EMITW(0x7C0000A0 | MSM(REG(RG), REG(RG), 0x00))
+
+#define bswhx_ld(RD, MS, DS)                                                \
+        movhx_ld(W(RD), W(MS), W(DS))                                       \
+        bswhx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1422,6 +1432,21 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
         EMITW(0xA0000000 | MDM(REG(RS), MOD(MD), VAL(DD), B3(DD), P1(DD)))
 
+/* mvb (D = S), bridges from 8-bit to 16-bit subset
+ * set-flags: no */
+
+#define mvbhn_rr(RD, RS)        /* move  8-bit to 16-bit w/ sign-extend */  \
+        movbn_rr(W(RD), W(RS))
+
+#define mvbhz_rr(RD, RS)        /* move  8-bit to 16-bit w/ zero-extend */  \
+        movbz_rr(W(RD), W(RS))
+
+#define mvbhn_ld(RD, MS, DS)    /* load  8-bit to 16-bit w/ sign-extend */  \
+        movbn_ld(W(RD), W(MS), W(DS))
+
+#define mvbhz_ld(RD, MS, DS)    /* load  8-bit to 16-bit w/ zero-extend */  \
+        movbz_ld(W(RD), W(MS), W(DS))
+
 /* and (G = G & S)
  * set-flags: undefined (*_*), yes (*Z*) */
 
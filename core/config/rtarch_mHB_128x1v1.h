@@ -140,6 +140,19 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A2(DD), EMPTY2)   \
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), P2(DD)))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvugx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TPxx,    MOD(MS), TDxx) | ADS(MOD(MS)))      \
+        EMITW(0x78000020 | MXM(REG(XD), TPxx,    0x00))
+
+#define mvugx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TPxx,    MOD(MD), TDxx) | ADS(MOD(MD)))      \
+        EMITW(0x78000024 | MXM(REG(XS), TPxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -555,6 +568,15 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x78A0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswgx_rr(XD, XS)                                                    \
+        EMITW(0x78000002 | MXM(REG(XD), REG(XS), 0x00) | 0x00B10000)
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -795,10 +817,13 @@
 #define SMF16_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(bnz.h, xs, lb) ASM_END
 
-#define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##16_128), EMPTY2)
 
+#define mkjgx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -1366,10 +1391,30 @@
 #define SMF08_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(bnz.b, xs, lb) ASM_END
 
-#define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##08_128), EMPTY2)
 
+#define mkjgb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 16 if all elems of S are -1,
+ * each 64-bit half counts its trailing ones as popcnt(S & ~(S + 1)) */
+
+#define mlngb_rr(RD, XS)                                                    \
+        EMITW(0x78610006 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x7840001E | MXM(TmmM,    TmmM,    TmmM))                     \
+        EMITW(0x7800001E | MXM(TmmM,    TmmM,    REG(XS)))                  \
+        EMITW(0x7B07001E | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78B00019 | MXM(REG(RD), TmmM,    0x00))                     \
+        EMITW(0x78B20019 | MXM(TMxx,    TmmM,    0x00))                     \
+        EMITW(0x00000182 | MSM(TIxx,    REG(RD), 0x00))                     \
+        EMITW(0x00000023 | MRM(TIxx,    TZxx,    TIxx))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x000000C2 | MSM(REG(RD), REG(RD), 0x00))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
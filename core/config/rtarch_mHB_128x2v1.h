@@ -143,6 +143,21 @@
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x78000027 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvuax_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TPxx,    MOD(MS), TDxx) | ADS(MOD(MS)))      \
+        EMITW(0x78000020 | MXM(REG(XD), TPxx,    0x00))                     \
+        EMITW(0x78100020 | MXM(RYG(XD), TPxx,    0x00))
+
+#define mvuax_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TPxx,    MOD(MD), TDxx) | ADS(MOD(MD)))      \
+        EMITW(0x78000024 | MXM(REG(XS), TPxx,    0x00))                     \
+        EMITW(0x78100024 | MXM(RYG(XS), TPxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -628,6 +643,16 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
         EMITW(0x78A0000D | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswax_rr(XD, XS)                                                    \
+        EMITW(0x78000002 | MXM(REG(XD), REG(XS), 0x00) | 0x00B10000)        \
+        EMITW(0x78000002 | MXM(RYG(XD), RYG(XS), 0x00) | 0x00B10000)
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -909,10 +934,13 @@
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
         ASM_BEG ASM_OP2(bnz.h, $w31, lb) ASM_END
 
-#define mkjax_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjax_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##16_256), EMPTY2)
 
+#define mkjax_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjax_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -1578,10 +1606,38 @@
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
         ASM_BEG ASM_OP2(bnz.b, $w31, lb) ASM_END
 
-#define mkjab_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjab_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##08_256), EMPTY2)
 
+#define mkjab_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjab_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 32 if all elems of S are -1,
+ * each 64-bit half counts its trailing ones as popcnt(S & ~(S + 1)) */
+
+#define mlnab_rr(RD, XS)                                                    \
+        ml1ab_rx(TPxx,    RYG(XS))                                          \
+        ml1ab_rx(REG(RD), REG(XS))                                          \
+        EMITW(0x000001C2 | MSM(TIxx,    REG(RD), 0x00))                     \
+        EMITW(0x00000023 | MRM(TIxx,    TZxx,    TIxx))                     \
+        EMITW(0x00000024 | MRM(TPxx,    TPxx,    TIxx))                     \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TPxx))                     \
+        EMITW(0x000000C2 | MSM(REG(RD), REG(RD), 0x00))
+
+#define ml1ab_rx(rd, xs) /* not portable, do not use outside */             \
+        EMITW(0x78610006 | MXM(TmmM,    xs,      0x00))                     \
+        EMITW(0x7840001E | MXM(TmmM,    TmmM,    TmmM))                     \
+        EMITW(0x7800001E | MXM(TmmM,    TmmM,    xs))                       \
+        EMITW(0x7B07001E | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78B00019 | MXM(rd,      TmmM,    0x00))                     \
+        EMITW(0x78B20019 | MXM(TMxx,    TmmM,    0x00))                     \
+        EMITW(0x00000182 | MSM(TIxx,    rd,      0x00))                     \
+        EMITW(0x00000023 | MRM(TIxx,    TZxx,    TIxx))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000021 | MRM(rd,      rd,      TMxx))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -51,6 +51,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -388,6 +390,7 @@
 /* addressing   REG,  MOD,  SIB */
 
 #define Oeax    TEax, TEax, EMPTY
+#define Meax    TEax, TEax, EMPTY       /* internal (sregs) */
 
 #define Mecx    TEcx, TEcx, EMPTY
 #define Medx    TEdx, TEdx, EMPTY
@@ -403,6 +406,10 @@
 #define MegD    TEgD, TEgD, EMPTY
 #define MegE    TEgE, TEgE, EMPTY
 
+/* section-local frame from ASM_ENTER_S, SP-relative (see rtarch.h) */
+
+#define Mesp    SPxx, SPxx, EMPTY
+
 /* public scalable I/J/K/L*** definitions are now provided in rtbase.h */
 /* public scalable S/T/U/V*** definitions accept any register as index */
 /* fully explicit N*** takes index register and scale (1,2,3) for 2x/4x/8x */
@@ -505,10 +512,30 @@
 #define _DV(dp) ((dp) & 0x7FFFFFFF),    2, 2       /* native x86_64 long mode */
 #define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
 
+/* widest displacement of each TP1/TP2 type, checked in burst ld/st */
+
+#define DL00    0x7FFF
+#define DL11    0xFFFF
+#define DL22    0x7FFFFFFF
+
 /* triplet pass-through wrapper */
 
 #define W(p1, p2, p3)       p1,  p2,  p3
 
+/* displacement pass-through advancer, used in SIMD burst ld/st
+ * keeps TP1/TP2 of the original displacement, DNCHK fails at assembly time
+ * if the advanced value no longer fits the widest displacement of its type */
+
+#define DN(dn, val, tp1, tp2)  ((val) + (dn)), tp1, tp2
+
+#define DNCHK(dn, val, tp1, tp2)                                            \
+        DNERR(((val) + (dn)) > DL##tp1##tp2)
+
+#define DNERR(cond) /* not portable, do not use outside */                  \
+        ASM_BEG ASM_OP1(.if, cond) ASM_END                                  \
+        ASM_BEG ASM_OP1(.error, "burst displacement overflow") ASM_END      \
+        ASM_BEG ASM_OP0(.endif) ASM_END
+
 /******************************************************************************/
 /**********************************   BASE   **********************************/
 /******************************************************************************/
@@ -1027,6 +1054,19 @@
         EMITW(0x7C0000F8 | MSM(TWxx,    TWxx,    TWxx))                     \
         EMITW(0x00000000 | MDM(TWxx,    MOD(MG), VAL(DG), B1(DG), O1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswwx_rx(RG)                                                        \
+        EMITW(0x5400003E | MSM(TMxx,    REG(RG), 0x08))                     \
+        EMITW(0x5000000E | MSM(TMxx,    REG(RG), 0x18))                     \
+        EMITW(0x5000042E | MSM(TMxx,    REG(RG), 0x18))                     \
+        EMITW(0x7C000378 | MSM(REG(RG), TMxx,    TMxx))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -2346,6 +2386,22 @@
         EMITW(0x80000000 | MTM(TEax,    SPxx,    0x00) | (+0x00 & 0xFFFF))  \
         EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (+0x70 & 0xFFFF))
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        EMITW(0x7C000378 | MSM(TEax,    SPxx,    SPxx))                     \
+        EMITW(0x38000000 | MTM(TDxx,    SPxx,    0x00) |                    \
+                             (-((sz) + 0x04) & 0xFFFF))                     \
+        EMITW(0x38000000 | MTM(TPxx,    0x00,    0x00) |                    \
+                             (-RT_SIMD_ALIGN & 0xFFFF))                     \
+        EMITW(0x7C000038 | MSM(SPxx,    TDxx,    TPxx))                     \
+        EMITW(0x90000000 | MTM(TEax,    SPxx,    0x00) | (+(sz) & 0xFFFF))
+
+#define stack_fl(sz)                                                        \
+        EMITW(0x80000000 | MTM(SPxx,    SPxx,    0x00) | (+(sz) & 0xFFFF))
+
 #endif /* (defined RT_P32) */
 
 /******************************************************************************/
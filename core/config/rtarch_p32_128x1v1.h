@@ -186,6 +186,84 @@
 #define U12(dp) (0x7C00052E | TDxx << 11)
 #define V12(dp) (0x7C0005AE | TDxx << 11)
 
+/* internal definitions for fp-compare-jump (cmj), fcmpu/xscmpudp report
+ * unordered (NaN) operands in cr0[SO], LE/GE fold EQ into LT/GT via cror,
+ * vcmp*fp. return all-false on NaN (only NE_x jumps on NaN as in C) */
+
+#define FJ0(lb)                                                             \
+        ASM_BEG ASM_OP1(beq, lb) ASM_END
+
+#define FJ1(lb)                                                             \
+        ASM_BEG ASM_OP1(bne, lb) ASM_END
+
+#define FJ2(lb)                                                             \
+        ASM_BEG ASM_OP1(blt, lb) ASM_END
+
+#define FJ3(lb)                                                             \
+        EMITW(0x4C401382)                                                   \
+        ASM_BEG ASM_OP1(beq, lb) ASM_END
+
+#define FJ4(lb)                                                             \
+        ASM_BEG ASM_OP1(bgt, lb) ASM_END
+
+#define FJ5(lb)                                                             \
+        EMITW(0x4C411382)                                                   \
+        ASM_BEG ASM_OP1(beq, lb) ASM_END
+
+#define FJ6(lb)                                                             \
+        FJ2(lb)
+
+#define FJ7(lb)                                                             \
+        FJ3(lb)
+
+#define FJ8(lb)                                                             \
+        FJ4(lb)
+
+#define FJ9(lb)                                                             \
+        FJ5(lb)
+
+#define CMF(cc, lb)                                                         \
+        F##cc(lb)
+
+#define VJ0(lb)                                                             \
+        EMITW(0x100004C6 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+
+#define VJ1(lb)                                                             \
+        EMITW(0x100004C6 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+
+#define VJ2(lb)                                                             \
+        EMITW(0x100006C6 | MXM(TmmM,    TmmQ,    TmmM))                     \
+        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+
+#define VJ3(lb)                                                             \
+        EMITW(0x100005C6 | MXM(TmmM,    TmmQ,    TmmM))                     \
+        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+
+#define VJ4(lb)                                                             \
+        EMITW(0x100006C6 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+
+#define VJ5(lb)                                                             \
+        EMITW(0x100005C6 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+
+#define VJ6(lb)                                                             \
+        VJ2(lb)
+
+#define VJ7(lb)                                                             \
+        VJ3(lb)
+
+#define VJ8(lb)                                                             \
+        VJ4(lb)
+
+#define VJ9(lb)                                                             \
+        VJ5(lb)
+
+#define CMV(cc, lb)                                                         \
+        V##cc(lb)
+
 /* registers    REG   (check mapping with ASM_ENTER/ASM_LEAVE in rtarch.h) */
 
 #define TmmQ    0x0F  /* v15, internal name for all-ones, not persistent */
@@ -726,12 +804,15 @@
 #define SMF32_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjix_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x10000486 | MXM(REG(XS), REG(XS), TmmQ))                     \
         AUW(EMPTY, EMPTY, EMPTY, EMPTY, lb,                                 \
         S0(RT_SIMD_MASK_##mask##32_128), EMPTY2)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1242,6 +1323,18 @@
         EMITW(0x7C000619 | MXM(TmmM,    TEax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000384 | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswix_rr(XD, XS)                                                    \
+        EMITW(0x7C00000C | MXM(TmmM,    0x00,    TZxx))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x03,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1965,6 +2058,15 @@
         EMITW(0x00000000 | MDM(TmmM,    MOD(MT), VAL(DT), B1(DT), L1(DT)))  \
         EMITW(0xF0000398 | MXM(REG(XD), REG(XS), TmmM))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        EMITW(0xFC000000 | MXM(0x00,    REG(XS), REG(XT)))                  \
+        CMF(cc, lb)
+
 #else  /* RT_ELEM_COMPAT_VMX == 1, -- only if BASE regs are 128bit-aligned -- */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
@@ -2113,6 +2215,16 @@
         EMITW(0x1000028C | MXM(TmmM, SPL(W(DT)), TmmM))                     \
         EMITW(0xF000029F | MXM(REG(XD), REG(XS), TmmM))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        EMITW(0x1000028C | MXM(TmmM,    0x00,    REG(XS)))                  \
+        EMITW(0x1000028C | MXM(TmmQ,    0x00,    REG(XT)))                  \
+        CMV(cc, lb)
+
 #endif /* RT_ELEM_COMPAT_VMX */
 
 /******************************************************************************/
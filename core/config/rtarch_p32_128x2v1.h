@@ -446,12 +446,24 @@
         EMITW(0xF000026B | MXM(REG(XD), 0x00,    REG(XS)))                  \
         EMITW(0xF000026B | MXM(RYG(XD), 0x00,    RYG(XS)))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcscs_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0xF00006CD | MXM(REG(XS), REG(XG), TmmQ))                     \
         EMITW(0xF000020F | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0xF00006CD | MXM(RYG(XS), RYG(XG), TmmQ))                     \
         EMITW(0xF000020F | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcscs_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0xF00006CD | MXM(REG(XS), REG(XG), TmmQ))                     \
+        EMITW(0xF00006CD | MXM(RYG(XS), RYG(XG), TmmQ))                     \
+        EMITW(0xF000020F | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0xF000020F | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RCP */
 
         /* rce, rcs, rcp are defined in rtconf.h
@@ -597,12 +609,24 @@
 #define cnecs_ld(XG, MS, DS)                                                \
         cnecs3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnecs3rr(XD, XS, XT)                                                \
         EMITW(0xF000021F | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0xF000021F | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0xF0000517 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnecs3rr(XD, XS, XT)                                                \
+        EMITW(0xF000021F | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0xF000021F | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0xF0000517 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnecs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -711,11 +735,14 @@
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##32_256), EMPTY2)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1308,6 +1335,19 @@
         EMITW(0x7C000619 | MXM(TmmM,    T1xx,    TPxx))                     \
         EMITW(0x10000384 | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswcx_rr(XD, XS)                                                    \
+        EMITW(0x7C00000C | MXM(TmmM,    0x00,    TZxx))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x03,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)      \
+        EMITW(0x1000002B | MXM(RYG(XD), RYG(XS), RYG(XS)) | TmmM << 6)
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1418,12 +1458,24 @@
 #define cnecx_ld(XG, MS, DS)                                                \
         cnecx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnecx3rr(XD, XS, XT)                                                \
         EMITW(0x10000086 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000086 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnecx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000086 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000086 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1482,12 +1534,24 @@
 #define clecx_ld(XG, MS, DS)                                                \
         clecx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define clecx3rr(XD, XS, XT)                                                \
         EMITW(0x10000286 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000286 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define clecx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000286 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000286 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define clecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1506,12 +1570,24 @@
 #define clecn_ld(XG, MS, DS)                                                \
         clecn3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define clecn3rr(XD, XS, XT)                                                \
         EMITW(0x10000386 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000386 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define clecn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000386 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000386 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define clecn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1570,12 +1646,24 @@
 #define cgecx_ld(XG, MS, DS)                                                \
         cgecx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgecx3rr(XD, XS, XT)                                                \
         EMITW(0x10000286 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000286 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgecx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000286 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000286 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1594,12 +1682,24 @@
 #define cgecn_ld(XG, MS, DS)                                                \
         cgecn3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgecn3rr(XD, XS, XT)                                                \
         EMITW(0x10000386 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000386 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgecn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000386 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000386 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgecn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1616,7 +1716,7 @@
 
 #define RT_SIMD_WIDTH32_512     16
 
-#define movox2ld(XD, MS, DS)                                                \
+#define movo2x_ld(XD, MS, DS)                                               \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
         EMITW(0x7C000619 | MXM(REG(XD), T0xx,    TPxx))                     \
@@ -1624,7 +1724,7 @@
         EMITW(0x7C000618 | MXM(REG(XD), T2xx,    TPxx))                     \
         EMITW(0x7C000618 | MXM(RYG(XD), T3xx,    TPxx))
 
-#define movox2st(XS, MD, DD)                                                \
+#define movo2x_st(XS, MD, DD)                                               \
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0x7C000719 | MXM(REG(XS), T0xx,    TPxx))                     \
@@ -1637,36 +1737,22 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox2st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        movo2x_st(Xmm0, Oeax, PLAIN)                                        \
+        movo2x_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_512*4*1))                  \
+        movo2x_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_512*4*2))                  \
+        movo2x_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_512*4*3))                  \
+        movo2x_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_512*4*4))                  \
+        movo2x_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_512*4*5))                  \
+        movo2x_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_512*4*6))                  \
+        movo2x_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_512*4*7))                  \
+        movo2x_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32_512*4*8))                  \
+        movo2x_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32_512*4*9))                  \
+        movo2x_st(XmmA, Meax, DP(RT_SIMD_WIDTH32_512*4*10))                 \
+        movo2x_st(XmmB, Meax, DP(RT_SIMD_WIDTH32_512*4*11))                 \
+        movo2x_st(XmmC, Meax, DP(RT_SIMD_WIDTH32_512*4*12))                 \
+        movo2x_st(XmmD, Meax, DP(RT_SIMD_WIDTH32_512*4*13))                 \
+        movo2x_st(XmmE, Meax, DP(RT_SIMD_WIDTH32_512*4*14))                 \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_512*4*15))                        \
         EMITW(0x7C000719 | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x7C000719 | MXM(TmmM,    0x00,    TEax))                     \
@@ -1678,36 +1764,22 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox2ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        movo2x_ld(Xmm0, Oeax, PLAIN)                                        \
+        movo2x_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_512*4*1))                  \
+        movo2x_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_512*4*2))                  \
+        movo2x_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_512*4*3))                  \
+        movo2x_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_512*4*4))                  \
+        movo2x_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_512*4*5))                  \
+        movo2x_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_512*4*6))                  \
+        movo2x_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_512*4*7))                  \
+        movo2x_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32_512*4*8))                  \
+        movo2x_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32_512*4*9))                  \
+        movo2x_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32_512*4*10))                 \
+        movo2x_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32_512*4*11))                 \
+        movo2x_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32_512*4*12))                 \
+        movo2x_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32_512*4*13))                 \
+        movo2x_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32_512*4*14))                 \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_512*4*15))                        \
         EMITW(0x7C000619 | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x7C000619 | MXM(TmmM,    0x00,    TEax))                     \
@@ -410,12 +410,24 @@
         EMITW(0xF000026B | MXM(REG(XD), 0x00,    REG(XS)))                  \
         EMITW(0xF0000268 | MXM(REG(XD), 0x00,    REG(XS)))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcscs_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0xF00006CD | MXM(REG(XS), REG(XG), TmmQ))                     \
         EMITW(0xF000020F | MXM(REG(XG), REG(XG), REG(XS)))                  \
         EMITW(0xF00006C8 | MXM(REG(XS), REG(XG), TmmQ))                     \
         EMITW(0xF0000208 | MXM(REG(XG), REG(XG), REG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcscs_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0xF00006CD | MXM(REG(XS), REG(XG), TmmQ))                     \
+        EMITW(0xF00006C8 | MXM(REG(XS), REG(XG), TmmQ))                     \
+        EMITW(0xF000020F | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0xF0000208 | MXM(REG(XG), REG(XG), REG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RCP */
 
         /* rce, rcs, rcp are defined in rtconf.h
@@ -556,12 +568,24 @@
 #define cnecs_ld(XG, MS, DS)                                                \
         cnecs3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnecs3rr(XD, XS, XT)                                                \
         EMITW(0xF000021F | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0xF0000218 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0xF0000510 | MXM(REG(XD), REG(XD), REG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnecs3rr(XD, XS, XT)                                                \
+        EMITW(0xF000021F | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0xF0000218 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0xF0000510 | MXM(REG(XD), REG(XD), REG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnecs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
         EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
@@ -665,11 +689,14 @@
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##32_256), EMPTY2)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1235,6 +1262,16 @@
         EMITW(0x10000384 | MXM(TmmQ,    TmmQ,    TmmM))                     \
         EMITW(0xF0000496 | MXM(REG(XD), TmmQ,    TmmQ))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswcx_rr(XD, XS)                                                    \
+        EMITW(0xF00F076F | MXM(REG(XD), 0x00,    REG(XS)))                  \
+        EMITW(0xF00F076C | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -1245,65 +1282,36 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        movcx_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        movcx_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        movcx_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        movcx_st(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        movcx_st(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        movcx_st(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        movcx_st(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        movcx_st(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        movcx_st(XmmF, Meax, DP(RT_SIMD_WIDTH32_256*4*15))                  \
+        movcx_st(XmmG, Meax, DP(RT_SIMD_WIDTH32_256*4*16))                  \
+        movcx_st(XmmH, Meax, DP(RT_SIMD_WIDTH32_256*4*17))                  \
+        movcx_st(XmmI, Meax, DP(RT_SIMD_WIDTH32_256*4*18))                  \
+        movcx_st(XmmJ, Meax, DP(RT_SIMD_WIDTH32_256*4*19))                  \
+        movcx_st(XmmK, Meax, DP(RT_SIMD_WIDTH32_256*4*20))                  \
+        movcx_st(XmmL, Meax, DP(RT_SIMD_WIDTH32_256*4*21))                  \
+        movcx_st(XmmM, Meax, DP(RT_SIMD_WIDTH32_256*4*22))                  \
+        movcx_st(XmmN, Meax, DP(RT_SIMD_WIDTH32_256*4*23))                  \
+        movcx_st(XmmO, Meax, DP(RT_SIMD_WIDTH32_256*4*24))                  \
+        movcx_st(XmmP, Meax, DP(RT_SIMD_WIDTH32_256*4*25))                  \
+        movcx_st(XmmQ, Meax, DP(RT_SIMD_WIDTH32_256*4*26))                  \
+        movcx_st(XmmR, Meax, DP(RT_SIMD_WIDTH32_256*4*27))                  \
+        movcx_st(XmmS, Meax, DP(RT_SIMD_WIDTH32_256*4*28))                  \
+        movcx_st(XmmT, Meax, DP(RT_SIMD_WIDTH32_256*4*29))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_256*4*30))                        \
         EMITW(0x7C000719 | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x7C000719 | MXM(TmmM,    0x00,    TEax))                     \
@@ -1316,65 +1324,36 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        movcx_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        movcx_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        movcx_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        movcx_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        movcx_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        movcx_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        movcx_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        movcx_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        movcx_ld(XmmF, Meax, DP(RT_SIMD_WIDTH32_256*4*15))                  \
+        movcx_ld(XmmG, Meax, DP(RT_SIMD_WIDTH32_256*4*16))                  \
+        movcx_ld(XmmH, Meax, DP(RT_SIMD_WIDTH32_256*4*17))                  \
+        movcx_ld(XmmI, Meax, DP(RT_SIMD_WIDTH32_256*4*18))                  \
+        movcx_ld(XmmJ, Meax, DP(RT_SIMD_WIDTH32_256*4*19))                  \
+        movcx_ld(XmmK, Meax, DP(RT_SIMD_WIDTH32_256*4*20))                  \
+        movcx_ld(XmmL, Meax, DP(RT_SIMD_WIDTH32_256*4*21))                  \
+        movcx_ld(XmmM, Meax, DP(RT_SIMD_WIDTH32_256*4*22))                  \
+        movcx_ld(XmmN, Meax, DP(RT_SIMD_WIDTH32_256*4*23))                  \
+        movcx_ld(XmmO, Meax, DP(RT_SIMD_WIDTH32_256*4*24))                  \
+        movcx_ld(XmmP, Meax, DP(RT_SIMD_WIDTH32_256*4*25))                  \
+        movcx_ld(XmmQ, Meax, DP(RT_SIMD_WIDTH32_256*4*26))                  \
+        movcx_ld(XmmR, Meax, DP(RT_SIMD_WIDTH32_256*4*27))                  \
+        movcx_ld(XmmS, Meax, DP(RT_SIMD_WIDTH32_256*4*28))                  \
+        movcx_ld(XmmT, Meax, DP(RT_SIMD_WIDTH32_256*4*29))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_256*4*30))                        \
         EMITW(0x7C000619 | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x7C000619 | MXM(TmmM,    0x00,    TEax))                     \
@@ -124,7 +124,7 @@
 
 #if (defined RT_SIMD_CODE)
 
-#if (RT_128X2 == 16) && (RT_SIMD_COMPAT_XMM > 0)
+#if (RT_128X2 == 16)
 
 #ifndef RT_RTARCH_P32_128X1V4_H
 #undef  RT_128X1
@@ -462,6 +462,8 @@
 
 #else /* RT_SIMD_COMPAT_DIV */
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define divcs3rr(XD, XS, XT)                                                \
         EMITW(0x1000010A | MXM(TmmW,    0x00,    REG(XT)))                  \
         EMITW(0x1000002F | MXM(TmmZ,    TmmW,    TmmU) | REG(XT) << 6)      \
@@ -476,6 +478,24 @@
         EMITW(0x1000002F | MXM(RYG(XD), TmmZ, RYG(XS)) | RYG(XT) << 6)      \
         EMITW(0x1000002E | MXM(RYG(XD), RYG(XD), TmmZ) | TmmW << 6)
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define divcs3rr(XD, XS, XT)                                                \
+        EMITW(0x1000010A | MXM(TmmW,    0x00,    REG(XT)))                  \
+        EMITW(0x1000010A | MXM(TmmM,    0x00,    RYG(XT)))                  \
+        EMITW(0x1000002F | MXM(TmmZ,    TmmW,    TmmU) | REG(XT) << 6)      \
+        EMITW(0x1000002F | MXM(TmmT,    TmmM,    TmmU) | RYG(XT) << 6)      \
+        EMITW(0x1000002E | MXM(TmmW,    TmmW,    TmmW) | TmmZ << 6)         \
+        EMITW(0x1000002E | MXM(TmmM,    TmmM,    TmmM) | TmmT << 6)         \
+        EMITW(0x1000002E | MXM(TmmZ,    REG(XS), TmmS) | TmmW << 6)         \
+        EMITW(0x1000002E | MXM(TmmT,    RYG(XS), TmmS) | TmmM << 6)         \
+        EMITW(0x1000002F | MXM(REG(XD), TmmZ, REG(XS)) | REG(XT) << 6)      \
+        EMITW(0x1000002F | MXM(RYG(XD), TmmT, RYG(XS)) | RYG(XT) << 6)      \
+        EMITW(0x1000002E | MXM(REG(XD), REG(XD), TmmZ) | TmmW << 6)         \
+        EMITW(0x1000002E | MXM(RYG(XD), RYG(XD), TmmT) | TmmM << 6)
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define divcs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -500,6 +520,8 @@
 
 #if RT_SIMD_COMPAT_SQR == 1
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define sqrcs_rr(XD, XS)                                                    \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movws_ld(Tff1,  Mebp, inf_SCR01(0x00))                              \
@@ -557,6 +579,67 @@
         movws_st(Tff1,  Mebp, inf_SCR01(0x1C))                              \
         movcx_ld(W(XD), Mebp, inf_SCR01(0))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define sqrcs_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x00))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x10))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x00))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x10))                              \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x04))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x14))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x04))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x14))                              \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x08))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x18))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x08))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x18))                              \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x0C))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x1C))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x0C))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x1C))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define sqrcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x00))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x10))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x00))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x10))                              \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x04))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x14))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x04))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x14))                              \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x08))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x18))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x08))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x18))                              \
+        movws_ld(Tff1,  Mebp, inf_SCR01(0x0C))                              \
+        movws_ld(Tff2,  Mebp, inf_SCR01(0x1C))                              \
+        sqrws_rr(Tff1, Tff1)                                                \
+        sqrws_rr(Tff2, Tff2)                                                \
+        movws_st(Tff1,  Mebp, inf_SCR01(0x0C))                              \
+        movws_st(Tff2,  Mebp, inf_SCR01(0x1C))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #else /* RT_SIMD_COMPAT_SQR */
 
 #define sqrcs_rr(XD, XS)                                                    \
@@ -594,7 +677,7 @@
         EMITW(0x1000002E | MXM(TmmT,    TmmW,    TmmS) | TmmV << 6)         \
         EMITW(0x1000002F | MXM(TmmZ,    TmmZ,    TmmU) | TmmM << 6)         \
         EMITW(0x1000002F | MXM(TmmW,    TmmZ,    TmmW) | TmmT << 6)         \
-        EMITW(0x1000002E | MXM(REG(XD), TmmW,    TmmS) | REG(XS) << 6)      \
+        EMITW(0x1000002E | MXM(REG(XD), TmmW,    TmmS) | TmmM << 6)         \
         EMITW(0x7C0000CE | MXM(TmmM,    T1xx,    TPxx))                     \
         EMITW(0x1000014A | MXM(TmmW,    0x00,    TmmM))                     \
         EMITW(0x1000002E | MXM(TmmZ,    TmmW,    TmmS) | TmmW << 6)         \
@@ -605,7 +688,7 @@
         EMITW(0x1000002E | MXM(TmmT,    TmmW,    TmmS) | TmmV << 6)         \
         EMITW(0x1000002F | MXM(TmmZ,    TmmZ,    TmmU) | TmmM << 6)         \
         EMITW(0x1000002F | MXM(TmmW,    TmmZ,    TmmW) | TmmT << 6)         \
-        EMITW(0x1000002E | MXM(RYG(XD), TmmW,    TmmS) | RYG(XS) << 6)
+        EMITW(0x1000002E | MXM(RYG(XD), TmmW,    TmmS) | TmmM << 6)
 
 #endif /* RT_SIMD_COMPAT_SQR */
 
@@ -643,6 +726,8 @@
         EMITW(0x1000014A | MXM(REG(XD), 0x00,    REG(XS)))                  \
         EMITW(0x1000014A | MXM(RYG(XD), 0x00,    RYG(XS)))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rsscs_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0x1000002E | MXM(TmmZ,    REG(XG), TmmS) | REG(XG) << 6)      \
         EMITW(0x1000002E | MXM(TmmW,    REG(XG), TmmS) | TmmV << 6)         \
@@ -653,6 +738,20 @@
         EMITW(0x1000002F | MXM(TmmZ,    TmmZ,    TmmU) | RYG(XS) << 6)      \
         EMITW(0x1000002F | MXM(RYG(XG), TmmZ,    RYG(XG)) | TmmW << 6)
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rsscs_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0x1000002E | MXM(TmmZ,    REG(XG), TmmS) | REG(XG) << 6)      \
+        EMITW(0x1000002E | MXM(TmmT,    RYG(XG), TmmS) | RYG(XG) << 6)      \
+        EMITW(0x1000002E | MXM(TmmW,    REG(XG), TmmS) | TmmV << 6)         \
+        EMITW(0x1000002E | MXM(TmmM,    RYG(XG), TmmS) | TmmV << 6)         \
+        EMITW(0x1000002F | MXM(TmmZ,    TmmZ,    TmmU) | REG(XS) << 6)      \
+        EMITW(0x1000002F | MXM(TmmT,    TmmT,    TmmU) | RYG(XS) << 6)      \
+        EMITW(0x1000002F | MXM(REG(XG), TmmZ,    REG(XG)) | TmmW << 6)      \
+        EMITW(0x1000002F | MXM(RYG(XG), TmmT,    RYG(XG)) | TmmM << 6)
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RSQ */
 
         /* rse, rss, rsq are defined in rtconf.h
@@ -828,12 +927,24 @@
 #define cnecs_ld(XG, MS, DS)                                                \
         cnecs3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnecs3rr(XD, XS, XT)                                                \
         EMITW(0x100000C6 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x100000C6 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnecs3rr(XD, XS, XT)                                                \
+        EMITW(0x100000C6 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x100000C6 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnecs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -942,11 +1053,14 @@
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##32_256), EMPTY2)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1059,12 +1173,24 @@
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
  * round instructions are only accurate within 32-bit signed int range */
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rndcs_rr(XD, XS)                                                    \
         EMITW(0x1000000A | MXM(REG(XD), TmmR,    REG(XS)))                  \
         EMITW(0x1000020A | MXM(REG(XD), 0x00,    REG(XD)))                  \
         EMITW(0x1000000A | MXM(RYG(XD), TmmR,    RYG(XS)))                  \
         EMITW(0x1000020A | MXM(RYG(XD), 0x00,    RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rndcs_rr(XD, XS)                                                    \
+        EMITW(0x1000000A | MXM(REG(XD), TmmR,    REG(XS)))                  \
+        EMITW(0x1000000A | MXM(RYG(XD), TmmR,    RYG(XS)))                  \
+        EMITW(0x1000020A | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0x1000020A | MXM(RYG(XD), 0x00,    RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define rndcs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
@@ -1260,12 +1386,24 @@
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
  * round instructions are only accurate within 32-bit unsigned int range */
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rudcs_rr(XD, XS)                                                    \
         EMITW(0x1000000A | MXM(REG(XD), TmmR,    REG(XS)))                  \
         EMITW(0x1000020A | MXM(REG(XD), 0x00,    REG(XD)))                  \
         EMITW(0x1000000A | MXM(RYG(XD), TmmR,    RYG(XS)))                  \
         EMITW(0x1000020A | MXM(RYG(XD), 0x00,    RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rudcs_rr(XD, XS)                                                    \
+        EMITW(0x1000000A | MXM(REG(XD), TmmR,    REG(XS)))                  \
+        EMITW(0x1000000A | MXM(RYG(XD), TmmR,    RYG(XS)))                  \
+        EMITW(0x1000020A | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0x1000020A | MXM(RYG(XD), 0x00,    RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define rudcs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
@@ -1523,6 +1661,19 @@
         EMITW(0x7C0000CE | MXM(TmmM,    T1xx,    TPxx))                     \
         EMITW(0x10000384 | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswcx_rr(XD, XS)                                                    \
+        EMITW(0x7C00000C | MXM(TmmM,    0x00,    TZxx))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x03,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)      \
+        EMITW(0x1000002B | MXM(RYG(XD), RYG(XS), RYG(XS)) | TmmM << 6)
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1633,12 +1784,24 @@
 #define cnecx_ld(XG, MS, DS)                                                \
         cnecx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnecx3rr(XD, XS, XT)                                                \
         EMITW(0x10000086 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000086 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnecx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000086 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000086 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1697,12 +1860,24 @@
 #define clecx_ld(XG, MS, DS)                                                \
         clecx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define clecx3rr(XD, XS, XT)                                                \
         EMITW(0x10000286 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000286 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define clecx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000286 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000286 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define clecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1721,12 +1896,24 @@
 #define clecn_ld(XG, MS, DS)                                                \
         clecn3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define clecn3rr(XD, XS, XT)                                                \
         EMITW(0x10000386 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000386 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define clecn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000386 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000386 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define clecn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1785,12 +1972,24 @@
 #define cgecx_ld(XG, MS, DS)                                                \
         cgecx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgecx3rr(XD, XS, XT)                                                \
         EMITW(0x10000286 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000286 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgecx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000286 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000286 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgecx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1809,12 +2008,24 @@
 #define cgecn_ld(XG, MS, DS)                                                \
         cgecn3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgecn3rr(XD, XS, XT)                                                \
         EMITW(0x10000386 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000386 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgecn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000386 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000386 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgecn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1843,35 +2054,21 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        movcx_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        movcx_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        movcx_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        movcx_st(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        movcx_st(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        movcx_st(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        movcx_st(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        movcx_st(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_256*4*15))                        \
         EMITW(0x7C0001CE | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x7C0001CE | MXM(TmmM,    0x00,    TEax))                     \
@@ -1916,35 +2113,21 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        movcx_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        movcx_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        movcx_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        movcx_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        movcx_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        movcx_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        movcx_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        movcx_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_256*4*15))                        \
         EMITW(0x7C0000CE | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0x7C0000CE | MXM(TmmM,    0x00,    TEax))                     \
@@ -530,6 +530,8 @@
         EMITW(0xF0000268 | MXM(REG(XD), 0x00,    REG(XS)))                  \
         EMITW(0xF0000268 | MXM(RYG(XD), 0x00,    RYG(XS)))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define rcsos_rr(XG, XS) /* destroys XS */                                  \
         EMITW(0xF00006CD | MXM(REG(XS), REG(XG), TmmQ))                     \
         EMITW(0xF000020F | MXM(REG(XG), REG(XG), REG(XS)))                  \
@@ -540,6 +542,20 @@
         EMITW(0xF00006C8 | MXM(RYG(XS), RYG(XG), TmmQ))                     \
         EMITW(0xF0000208 | MXM(RYG(XG), RYG(XG), RYG(XS)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define rcsos_rr(XG, XS) /* destroys XS */                                  \
+        EMITW(0xF00006CD | MXM(REG(XS), REG(XG), TmmQ))                     \
+        EMITW(0xF00006CD | MXM(RYG(XS), RYG(XG), TmmQ))                     \
+        EMITW(0xF00006C8 | MXM(REG(XS), REG(XG), TmmQ))                     \
+        EMITW(0xF00006C8 | MXM(RYG(XS), RYG(XG), TmmQ))                     \
+        EMITW(0xF000020F | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0xF000020F | MXM(RYG(XG), RYG(XG), RYG(XS)))                  \
+        EMITW(0xF0000208 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0xF0000208 | MXM(RYG(XG), RYG(XG), RYG(XS)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #endif /* RT_SIMD_COMPAT_RCP */
 
         /* rce, rcs, rcp are defined in rtconf.h
@@ -725,6 +741,8 @@
 #define cneos_ld(XG, MS, DS)                                                \
         cneos3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneos3rr(XD, XS, XT)                                                \
         EMITW(0xF000021F | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
@@ -735,6 +753,20 @@
         EMITW(0xF0000218 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0xF0000510 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneos3rr(XD, XS, XT)                                                \
+        EMITW(0xF000021F | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0xF000021F | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0xF0000218 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0xF0000218 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0xF0000517 | MXM(RYG(XD), RYG(XD), RYG(XD)))                  \
+        EMITW(0xF0000510 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0xF0000510 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneos3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -879,10 +911,13 @@
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##32_512), EMPTY2)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjox_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1735,6 +1770,25 @@
         EMITW(0x10000384 | MXM(TmmQ,    TmmQ,    TmmM))                     \
         EMITW(0xF0000496 | MXM(RYG(XD), TmmQ,    TmmQ))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswox_rr(XD, XS)                                                    \
+        EMITW(0x7C00000C | MXM(TmmM,    0x00,    TZxx))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x03,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)      \
+        EMITW(0x1000002B | MXM(RYG(XD), RYG(XS), RYG(XS)) | TmmM << 6)      \
+        EMITW(0xF0000491 | MXM(TmmQ,    REG(XS), REG(XS)))                  \
+        EMITW(0x1000002B | MXM(TmmQ,    TmmQ,    TmmQ) | TmmM << 6)         \
+        EMITW(0xF0000496 | MXM(REG(XD), TmmQ,    TmmQ))                     \
+        EMITW(0xF0000491 | MXM(TmmQ,    RYG(XS), RYG(XS)))                  \
+        EMITW(0x1000002B | MXM(TmmQ,    TmmQ,    TmmQ) | TmmM << 6)         \
+        EMITW(0xF0000496 | MXM(RYG(XD), TmmQ,    TmmQ))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        bswox_rr(W(XD), W(XD))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -1745,35 +1799,21 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
+        movox_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        movox_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32*4*8))                       \
+        movox_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32*4*9))                       \
+        movox_st(XmmA, Meax, DP(RT_SIMD_WIDTH32*4*10))                      \
+        movox_st(XmmB, Meax, DP(RT_SIMD_WIDTH32*4*11))                      \
+        movox_st(XmmC, Meax, DP(RT_SIMD_WIDTH32*4*12))                      \
+        movox_st(XmmD, Meax, DP(RT_SIMD_WIDTH32*4*13))                      \
+        movox_st(XmmE, Meax, DP(RT_SIMD_WIDTH32*4*14))                      \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*15))                            \
         EMITW(0x7C000719 | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         EMITW(0x7C000719 | MXM(TmmM,    0x00,    TEax))                     \
@@ -1786,35 +1826,21 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
+        movox_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        movox_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32*4*8))                       \
+        movox_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32*4*9))                       \
+        movox_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32*4*10))                      \
+        movox_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32*4*11))                      \
+        movox_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32*4*12))                      \
+        movox_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32*4*13))                      \
+        movox_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32*4*14))                      \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*15))                            \
         EMITW(0x7C000619 | MXM(TmmQ,    0x00,    TEax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         EMITW(0x7C000619 | MXM(TmmM,    0x00,    TEax))                     \
@@ -49,6 +49,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -525,6 +527,23 @@
         EMITW(0x7C0000F8 | MSM(TWxx,    TWxx,    TWxx))                     \
         EMITW(0x00000000 | MDM(TWxx,    MOD(MG), VAL(DG), B1(DG), Q1(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswzx_rx(RG)                                                        \
+        EMITW(0x78000002 | MSM(TMxx,    REG(RG), 0x00))                     \
+        EMITW(0x5400003E | MSM(TIxx,    REG(RG), 0x08))                     \
+        EMITW(0x5000000E | MSM(TIxx,    REG(RG), 0x18))                     \
+        EMITW(0x5000042E | MSM(TIxx,    REG(RG), 0x18))                     \
+        EMITW(0x5400003E | MSM(REG(RG), TMxx,    0x08))                     \
+        EMITW(0x5000000E | MSM(REG(RG), TMxx,    0x18))                     \
+        EMITW(0x5000042E | MSM(REG(RG), TMxx,    0x18))                     \
+        EMITW(0x7800000E | MSM(REG(RG), TIxx,    0x00))
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        bswzx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1649,6 +1668,22 @@
         EMITW(0xE8000000 | MTM(TEax,    SPxx,    0x00) | (+0x00 & 0xFFFF))  \
         EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (+0xD0 & 0xFFFF))
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        EMITW(0x7C000378 | MSM(TEax,    SPxx,    SPxx))                     \
+        EMITW(0x38000000 | MTM(TDxx,    SPxx,    0x00) |                    \
+                             (-((sz) + 0x08) & 0xFFFF))                     \
+        EMITW(0x38000000 | MTM(TPxx,    0x00,    0x00) |                    \
+                             (-RT_SIMD_ALIGN & 0xFFFF))                     \
+        EMITW(0x7C000038 | MSM(SPxx,    TDxx,    TPxx))                     \
+        EMITW(0xF8000000 | MTM(TEax,    SPxx,    0x00) | (+(sz) & 0xFFFF))
+
+#define stack_fl(sz)                                                        \
+        EMITW(0xE8000000 | MTM(SPxx,    SPxx,    0x00) | (+(sz) & 0xFFFF))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
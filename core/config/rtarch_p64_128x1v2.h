@@ -628,12 +628,15 @@
 #define SMF64_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjjx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x100004C7 | MXM(REG(XS), REG(XS), TmmQ))                     \
         AUW(EMPTY, EMPTY, EMPTY, EMPTY, lb,                                 \
         S0(RT_SIMD_MASK_##mask##64_128), EMPTY2)
 
+#define mkjjx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1113,6 +1116,15 @@
     SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
         EMITW(0x100003C4 | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswjx_rr(XD, XS)                                                    \
+        EMITW(0xF017076F | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1655,6 +1667,15 @@
         EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B1(DT), K1(DT)))  \
         EMITW(0xF000039F | MXM(REG(XD), REG(XS), TmmM))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjts_rr(XS, XT, cc, lb)                                            \
+        EMITW(0xF000011E | MXM(0x00,    REG(XS), REG(XT)))                  \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
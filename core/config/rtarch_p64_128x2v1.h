@@ -581,12 +581,24 @@
 #define cneds_ld(XG, MS, DS)                                                \
         cneds3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneds3rr(XD, XS, XT)                                                \
         EMITW(0xF000031F | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0xF000031F | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0xF0000517 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneds3rr(XD, XS, XT)                                                \
+        EMITW(0xF000031F | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0xF000031F | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0xF0000517 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0xF0000517 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneds3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -695,11 +707,14 @@
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjdx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##64_256), EMPTY2)
 
+#define mkjdx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjdx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1540,6 +1555,19 @@
 
 #endif /* RT_SIMD_COMPAT_PW8 == 1 */
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswdx_rr(XD, XS)                                                    \
+        EMITW(0x7C00000C | MXM(TmmM,    0x00,    TZxx))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x07,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)      \
+        EMITW(0x1000002B | MXM(RYG(XD), RYG(XS), RYG(XS)) | TmmM << 6)
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 #if (RT_SIMD_COMPAT_PW8 == 0)
@@ -2370,12 +2398,24 @@
 #define cnedx_ld(XG, MS, DS)                                                \
         cnedx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cnedx3rr(XD, XS, XT)                                                \
         EMITW(0x100000C7 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x100000C7 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cnedx3rr(XD, XS, XT)                                                \
+        EMITW(0x100000C7 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x100000C7 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cnedx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -2434,12 +2474,24 @@
 #define cledx_ld(XG, MS, DS)                                                \
         cledx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cledx3rr(XD, XS, XT)                                                \
         EMITW(0x100002C7 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x100002C7 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cledx3rr(XD, XS, XT)                                                \
+        EMITW(0x100002C7 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x100002C7 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cledx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -2458,12 +2510,24 @@
 #define cledn_ld(XG, MS, DS)                                                \
         cledn3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cledn3rr(XD, XS, XT)                                                \
         EMITW(0x100003C7 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x100003C7 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cledn3rr(XD, XS, XT)                                                \
+        EMITW(0x100003C7 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x100003C7 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cledn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -2522,12 +2586,24 @@
 #define cgedx_ld(XG, MS, DS)                                                \
         cgedx3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgedx3rr(XD, XS, XT)                                                \
         EMITW(0x100002C7 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x100002C7 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgedx3rr(XD, XS, XT)                                                \
+        EMITW(0x100002C7 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x100002C7 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgedx3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -2546,12 +2622,24 @@
 #define cgedn_ld(XG, MS, DS)                                                \
         cgedn3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgedn3rr(XD, XS, XT)                                                \
         EMITW(0x100003C7 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x100003C7 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgedn3rr(XD, XS, XT)                                                \
+        EMITW(0x100003C7 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x100003C7 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgedn3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
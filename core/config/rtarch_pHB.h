@@ -494,6 +494,18 @@
         EMITW(0x7C0000F8 | MSM(TWxx,    TWxx,    TWxx))                     \
         EMITW(0x00000000 | MDM(TWxx,    MOD(MG), VAL(DG), B1(DG), OH(DG)))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: undefined */
+
+#define bswhx_rx(RG)                                                        \
+        EMITW(0x5400042E | MSM(TMxx,    REG(RG), 0x08))                     \
+        EMITW(0x5000063E | MSM(TMxx,    REG(RG), 0x18))                     \
+        EMITW(0x7C000378 | MSM(REG(RG), TMxx,    TMxx))
+
+#define bswhx_ld(RD, MS, DS)                                                \
+        movhx_ld(W(RD), W(MS), W(DS))                                       \
+        bswhx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1289,6 +1301,21 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C1(DD), EMPTY2)   \
         EMITW(0x00000000 | MDM(REG(RS), MOD(MD), VAL(DD), B1(DD), OB(DD)))
 
+/* mvb (D = S), bridges from 8-bit to 16-bit subset
+ * set-flags: no */
+
+#define mvbhn_rr(RD, RS)        /* move  8-bit to 16-bit w/ sign-extend */  \
+        movbn_rr(W(RD), W(RS))
+
+#define mvbhz_rr(RD, RS)        /* move  8-bit to 16-bit w/ zero-extend */  \
+        movbz_rr(W(RD), W(RS))
+
+#define mvbhn_ld(RD, MS, DS)    /* load  8-bit to 16-bit w/ sign-extend */  \
+        movbn_ld(W(RD), W(MS), W(DS))
+
+#define mvbhz_ld(RD, MS, DS)    /* load  8-bit to 16-bit w/ zero-extend */  \
+        movbz_ld(W(RD), W(MS), W(DS))
+
 /* and (G = G & S)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -142,6 +142,49 @@
         EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0x7C0001CE | MXM(REG(XS), TEax & M(MOD(MD) == TPxx), TPxx))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment),
+ * loads merge two aligned lvx with vperm, stores go through SCR01 words */
+
+#if (RT_ENDIAN == 0)
+
+#define mvugx_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x3800000F | MXM(TIxx,    TPxx,    0x00))                     \
+        EMITW(0x7C0000CE | MXM(REG(XD), TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(TmmM,    TEax & M(MOD(MS) == TPxx), TIxx))   \
+        EMITW(0x7C00004C | MXM(TmmQ,    TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), TmmM,    REG(XD)) | TmmQ << 6)
+
+#else /* RT_ENDIAN == 1 */
+
+#define mvugx_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x3800000F | MXM(TIxx,    TPxx,    0x00))                     \
+        EMITW(0x7C0000CE | MXM(REG(XD), TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(TmmM,    TEax & M(MOD(MS) == TPxx), TIxx))   \
+        EMITW(0x7C00000C | MXM(TmmQ,    TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmQ << 6)
+
+#endif /* RT_ENDIAN == 1 */
+
+#define mvugx_st(XS, MD, DD)                                                \
+        movgx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C000214 | MRM(TPxx, TPxx, TEax & M(MOD(MD) == TPxx)))      \
+        mvxgx_st(Mebp, inf_SCR01(0x00), 0x00)                               \
+        mvxgx_st(Mebp, inf_SCR01(0x04), 0x04)                               \
+        mvxgx_st(Mebp, inf_SCR01(0x08), 0x08)                               \
+        mvxgx_st(Mebp, inf_SCR01(0x0C), 0x0C)
+
+#define mvxgx_st(MS, DS, dp) /* not portable, do not use outside */         \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x90000000 | MTM(TMxx,    TPxx,    0x00) | (dp))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -492,6 +535,16 @@
         EMITW(0x7C0000CE | MXM(TmmM,    TEax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000344 | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswgx_rr(XD, XS)                                                    \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000044 | MXM(REG(XD), REG(XS), TmmM))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -756,12 +809,15 @@
 #define SMF16_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x10000446 | MXM(REG(XS), REG(XS), TmmQ))                     \
         AUW(EMPTY, EMPTY, EMPTY, EMPTY, lb,                                 \
         S0(RT_SIMD_MASK_##mask##16_128), EMPTY2)
 
+#define mkjgx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -1339,12 +1395,44 @@
 #define SMF08_128(xs, lb) /* not portable, do not use outside */            \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x10000406 | MXM(REG(XS), REG(XS), TmmQ))                     \
         AUW(EMPTY, EMPTY, EMPTY, EMPTY, lb,                                 \
         S0(RT_SIMD_MASK_##mask##08_128), EMPTY2)
 
+#define mkjgb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 16 if all elems of S are -1,
+ * S is or-ed with memory-order byte indices, then min-reduced over bytes */
+
+#define mlngb_rr(RD, XS)                                                    \
+        EMITW(0x7C00000C | MXM(TmmM,    0x00,    TZxx))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    SP08,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x10000484 | MXM(TmmM,    TmmM,    REG(XS)))                  \
+        EMITW(0x1000030C | MXM(TmmQ,    0x08,    0x00))                     \
+        EMITW(0x10000000 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x08 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x04 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x02 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x01 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        mlxgb_rx(W(RD), Mebp, inf_SCR01(0))
+
+#define mlxgb_rx(RD, MD, DD) /* not portable, do not use outside */         \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C0001CE | MXM(TmmM,    0x00,    TPxx))                     \
+        movwx_ld(W(RD), W(MD), W(DD))                                       \
+        shrwx_ri(W(RD), IB(24))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -145,6 +145,15 @@
         EMITW(0x7C000719 | MXM(REG(XS), T0xx,    TPxx))                     \
         EMITW(0x7C000719 | MXM(RYG(XS), T1xx,    TPxx))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvuax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))
+
+#define mvuax_st(XS, MD, DD)                                                \
+        movax_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -574,6 +583,17 @@
         EMITW(0x7C000619 | MXM(TmmM,    T1xx,    TPxx))                     \
         EMITW(0x10000344 | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswax_rr(XD, XS)                                                    \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000044 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0x10000044 | MXM(RYG(XD), RYG(XS), TmmM))
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -684,12 +704,24 @@
 #define cneax_ld(XG, MS, DS)                                                \
         cneax3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneax3rr(XD, XS, XT)                                                \
         EMITW(0x10000046 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000046 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000046 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000046 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -748,12 +780,24 @@
 #define cleax_ld(XG, MS, DS)                                                \
         cleax3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cleax3rr(XD, XS, XT)                                                \
         EMITW(0x10000246 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000246 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cleax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000246 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000246 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cleax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -772,12 +816,24 @@
 #define clean_ld(XG, MS, DS)                                                \
         clean3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define clean3rr(XD, XS, XT)                                                \
         EMITW(0x10000346 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000346 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define clean3rr(XD, XS, XT)                                                \
+        EMITW(0x10000346 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000346 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define clean3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -836,12 +892,24 @@
 #define cgeax_ld(XG, MS, DS)                                                \
         cgeax3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgeax3rr(XD, XS, XT)                                                \
         EMITW(0x10000246 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000246 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgeax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000246 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000246 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgeax3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -860,12 +928,24 @@
 #define cgean_ld(XG, MS, DS)                                                \
         cgean3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgean3rr(XD, XS, XT)                                                \
         EMITW(0x10000346 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000346 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgean3rr(XD, XS, XT)                                                \
+        EMITW(0x10000346 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000346 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgean3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -894,11 +974,14 @@
         EMITW(0x10000446 | MXM(TmmM,    TmmM,    TmmQ))                     \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjax_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjax_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##16_256), EMPTY2)
 
+#define mkjax_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjax_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -1409,12 +1492,24 @@
 #define cneab_ld(XG, MS, DS)                                                \
         cneab3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cneab3rr(XD, XS, XT)                                                \
         EMITW(0x10000006 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000006 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cneab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000006 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000006 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cneab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1473,12 +1568,24 @@
 #define cleab_ld(XG, MS, DS)                                                \
         cleab3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cleab3rr(XD, XS, XT)                                                \
         EMITW(0x10000206 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000206 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cleab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000206 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000206 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cleab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1497,12 +1604,24 @@
 #define cleac_ld(XG, MS, DS)                                                \
         cleac3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cleac3rr(XD, XS, XT)                                                \
         EMITW(0x10000306 | MXM(REG(XD), REG(XS), REG(XT)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000306 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cleac3rr(XD, XS, XT)                                                \
+        EMITW(0x10000306 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000306 | MXM(RYG(XD), RYG(XS), RYG(XT)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cleac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1561,12 +1680,24 @@
 #define cgeab_ld(XG, MS, DS)                                                \
         cgeab3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgeab3rr(XD, XS, XT)                                                \
         EMITW(0x10000206 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000206 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgeab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000206 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000206 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgeab3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1585,12 +1716,24 @@
 #define cgeac_ld(XG, MS, DS)                                                \
         cgeac3ld(W(XG), W(XG), W(MS), W(DS))
 
+#if RT_SIMD_INTERLEAVE == 0
+
 #define cgeac3rr(XD, XS, XT)                                                \
         EMITW(0x10000306 | MXM(REG(XD), REG(XT), REG(XS)))                  \
         EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
         EMITW(0x10000306 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
         EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
 
+#else  /* RT_SIMD_INTERLEAVE != 0 */
+
+#define cgeac3rr(XD, XS, XT)                                                \
+        EMITW(0x10000306 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(0x10000306 | MXM(RYG(XD), RYG(XT), RYG(XS)))                  \
+        EMITW(0x10000504 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x10000504 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#endif /* RT_SIMD_INTERLEAVE */
+
 #define cgeac3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
@@ -1619,11 +1762,59 @@
         EMITW(0x10000406 | MXM(TmmM,    TmmM,    TmmQ))                     \
         ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
 
-#define mkjab_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjab_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
         S0(RT_SIMD_MASK_##mask##08_256), EMPTY2)
 
+#define mkjab_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjab_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 32 if all elems of S are -1,
+ * S is or-ed with memory-order byte indices, then min-reduced over bytes */
+
+#define mlnab_rr(RD, XS)                                                    \
+        EMITW(0x7C00000C | MXM(TmmM,    0x00,    TZxx))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    SPLT,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x08,    0x00))                     \
+        EMITW(0x10000000 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+        EMITW(0x10000000 | MXM(TmmQ,    TmmM,    TmmQ))                     \
+        EMITW(0x10000484 | MXM(TmmQ,    TmmQ,    RYG(XS)))                  \
+        EMITW(0x10000484 | MXM(TmmM,    TmmM,    REG(XS)))                  \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x08,    0x00))                     \
+        EMITW(0x10000000 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+        EMITW(0x10000000 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x08 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x04 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x02 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002C | MXM(TmmQ,    TmmM,    TmmM) | 0x01 << 6)         \
+        EMITW(0x10000202 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        mlxab_rx(W(RD), Mebp, inf_SCR01(0))
+
+#if (RT_SIMD_COMPAT_PW8 == 0)
+
+#define mlxab_rx(RD, MD, DD) /* not portable, do not use outside */         \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C0001CE | MXM(TmmM,    0x00,    TPxx))                     \
+        movwx_ld(W(RD), W(MD), W(DD))                                       \
+        shrwx_ri(W(RD), IB(24))
+
+#else /* RT_SIMD_COMPAT_PW8 == 1 */
+
+#define mlxab_rx(RD, MD, DD) /* not portable, do not use outside */         \
+        EMITW(0x7C0000E7 | MXM(TmmM,    REG(RD), 0x00))                     \
+        shrwx_ri(W(RD), IB(24))
+
+#endif /* RT_SIMD_COMPAT_PW8 == 1 */
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
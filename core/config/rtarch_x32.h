@@ -51,6 +51,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -180,10 +182,22 @@
 #define RT_X64 RT_BASE_COMPAT_BMI /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
 #endif /* RT_BASE_COMPAT_BMI */
 
+#if (RT_BASE_COMPAT_HEAP != 0) && (RT_ADDRESS == 32)
+
+/* 32-bit in-heap addresses are offsets from per-thread heap base in GS */
+#define ADR                                                                 \
+        EMITB(0x65)
+
+#define x67 1
+
+#else /* RT_BASE_COMPAT_HEAP == 0 || RT_ADDRESS == 64 */
+
 #define ADR
 
 #define x67 0
 
+#endif /* RT_BASE_COMPAT_HEAP */
+
 #endif /* defined (RT_X32, RT_X64) */
 
 /* mandatory escape prefix for some opcodes (must preceed rex) */
@@ -338,6 +352,11 @@
 #define X(reg, mod, sib)  (reg+16), mod, sib
 #define Z(reg, mod, sib)  (reg+24), mod, sib
 
+/* internal BASE register, used in place of Reax in mkj/mxj (SIMD masks)
+ * r15 is reserved (not exposed as RegF), see also jmpxx_xm and stack_sa */
+
+#define RMxx    0x0F, 0x03, EMPTY
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -362,6 +381,7 @@
 /* addressing   REG,  MOD,  SIB */
 
 #define Oeax    0x00, 0x00, EMPTY       /* [eax] */
+#define Meax    0x00, 0x02, EMPTY       /* [eax + DP], internal (sregs) */
 
 #define Mecx    0x01, 0x02, EMPTY       /* [ecx + DP] */
 #define Medx    0x02, 0x02, EMPTY       /* [edx + DP] */
@@ -377,6 +397,24 @@
 #define MegD    0x0D, 0x02, EMPTY       /* [r13d + DP] */
 #define MegE    0x0E, 0x02, EMPTY       /* [r14d + DP] */
 
+/* section-local frame from ASM_ENTER_S, SP-relative (see rtarch.h) */
+/* not available in GS-based heap mode, where ADR rebases all addresses */
+
+#if (RT_BASE_COMPAT_HEAP == 0) || (RT_ADDRESS == 64)
+
+#define FRM     /* frame is available */
+
+#define Mesp    0x04, 0x02, EMITB(0x24) /* [esp + DP] */
+
+#else /* RT_BASE_COMPAT_HEAP != 0 && RT_ADDRESS == 32 */
+
+#define FRM     /* error upon use of Mesp or ASM_ENTER_S/ASM_LEAVE_S */      \
+        _Pragma("GCC error \"no Mesp/ASM_ENTER_S in RT_BASE_COMPAT_HEAP mode\"")
+
+#define Mesp    FRM 0x04, 0x02, EMITB(0x24) /* [esp + DP] */
+
+#endif /* RT_BASE_COMPAT_HEAP */
+
 /* public scalable I/J/K/L*** definitions are now provided in rtbase.h */
 /* public scalable S/T/U/V*** definitions accept any register as index */
 /* fully explicit N*** takes index register and scale (1,2,3) for 2x/4x/8x */
@@ -437,6 +475,12 @@
 
 #define W(p1, p2, p3)       p1,  p2,  p3
 
+/* displacement pass-through advancer, used in SIMD burst ld/st */
+
+#define DN(dn, val, typ, cmd)  ((val) + (dn)), typ, EMITW((val) + (dn))
+
+#define DNCHK(dn, val, typ, cmd)  /* 32-bit displacement always fits */
+
 /******************************************************************************/
 /**********************************   BASE   **********************************/
 /******************************************************************************/
@@ -607,7 +651,7 @@
         MRM(REG(RG), MOD(RS), REG(RS))
 
 #define annwxZld(RG, MS, DS)                                                \
-        VEX(RXB(RG), RXB(MS), REN(RG), 0, 0, 2) EMITB(0xF2)                 \
+    ADR VEX(RXB(RG), RXB(MS), REN(RG), 0, 0, 2) EMITB(0xF2)                 \
         MRM(REG(RG), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
@@ -775,6 +819,27 @@
         MRM(0x02,    MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswwx_rx(RG)                                                        \
+        REX(0,       RXB(RG)) EMITB(0x0F) EMITB(0xC8 + REG(RG))
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rx(W(RD))
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define bswwx_ld(RD, MS, DS)                                                \
+    ADR REX(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0xF0)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -2109,6 +2174,30 @@
         stack_ld(Recx)                                                      \
         stack_ld(Reax)
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        FRM                                                                 \
+        REW(0,             0) EMITB(0x8B)                                   \
+        MRM(0x00,       0x03, 0x04)                                         \
+        REW(0,             0) EMITB(0x81)                                   \
+        MRM(0x05,       0x03, 0x04)                                         \
+        EMITW((sz) + 0x08)                                                  \
+        REW(0,             0) EMITB(0x81)                                   \
+        MRM(0x04,       0x03, 0x04)                                         \
+        EMITW(-RT_SIMD_ALIGN)                                               \
+        REW(0,             0) EMITB(0x89)                                   \
+        MRM(0x00,       0x02, 0x04)                                         \
+        AUX(EMITB(0x24), EMITW(sz), EMPTY)
+
+#define stack_fl(sz)                                                        \
+        FRM                                                                 \
+        REW(0,             0) EMITB(0x8B)                                   \
+        MRM(0x04,       0x02, 0x04)                                         \
+        AUX(EMITB(0x24), EMITW(sz), EMPTY)
+
 /******************************************************************************/
 /**************************   extended double (x87)   *************************/
 /******************************************************************************/
@@ -2370,6 +2459,39 @@ FWT ADR REX(0,       RXB(MD)) EMITB(0xD9)                                   \
 #define CMJ(cc, lb)                                                         \
         cc(lb)
 
+/* internal definitions for fp-compare-jump (cmj), ucomiss/ucomisd report
+ * unordered (NaN) operands as ZF = PF = CF = 1, EQ_x, LT_x, LE_x jump over
+ * their jcc on PF = 1 (to local label 9 right after it), NE_x also jumps
+ * to lb on PF = 1 (only NE_x jumps on NaN as in C, same as compilers do) */
+
+#define Fjeqxx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(jp,  9f) ASM_END                                    \
+        jeqxx_lb(lb)                                                        \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
+#define Fjnexx_lb(lb)                                                       \
+        jnexx_lb(lb)                                                        \
+        ASM_BEG ASM_OP1(jp,  lb) ASM_END
+
+#define Fjltxx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(jp,  9f) ASM_END                                    \
+        jltxx_lb(lb)                                                        \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
+#define Fjlexx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(jp,  9f) ASM_END                                    \
+        jlexx_lb(lb)                                                        \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
+#define Fjgtxx_lb(lb)                                                       \
+        jgtxx_lb(lb)
+
+#define Fjgexx_lb(lb)                                                       \
+        jgexx_lb(lb)
+
+#define CMF(cc, lb)                                                         \
+        F##cc(lb)
+
 #endif /* RT_RTARCH_X32_H */
 
 /******************************************************************************/
@@ -694,12 +694,15 @@
         VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjix_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         ck1ix_rm(W(XS), Mebp, inf_GPC07)                                    \
-        mk1wx_rx(Reax)                                                      \
-        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
+        mk1wx_rx(RMxx)                                                      \
+        cmpwx_ri(RMxx, IB(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1177,6 +1180,29 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * uses pshufb with byte-reverse mask written to SCR02 by imm stores */
+
+#define bswix_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x00010203), IW(0x04050607),                            \
+                 IW(0x08090A0B), IW(0x0C0D0E0F))                            \
+        shbix3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
+#define mskix_mi(I0, I1, I2, I3) /* not portable, do not use outside */     \
+        movwx_mi(Mebp, inf_SCR02(0x00), W(I0))                              \
+        movwx_mi(Mebp, inf_SCR02(0x04), W(I1))                              \
+        movwx_mi(Mebp, inf_SCR02(0x08), W(I2))                              \
+        movwx_mi(Mebp, inf_SCR02(0x0C), W(I3))
+
+#define shbix3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), 0, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1779,6 +1805,16 @@
         AUX(SIB(MT), CMD(DT), EMITB(0x05))                                  \
         mz1rx_ld(W(XD), Mebp, inf_GPC07)
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        EVX(RXB(XS), RXB(XT),    0x00, 0, 0, 1) EMITB(0x2E)                 \
+        MRM(REG(XS), MOD(XT), REG(XT))                                      \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /**********************************   MODE   **********************************/
 /******************************************************************************/
@@ -845,12 +845,15 @@ ADR XF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
 #define RT_SIMD_MASK_NONE32_128    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_128    0x0F     /*  all satisfy the condition */
 
-#define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        REX(0,       RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
-        MRM(0x00,    MOD(XS), REG(XS))                                      \
-        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
+#define mkjix_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        REX(1,       RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(RMxx, IB(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1702,6 +1705,49 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE2)                       \
         stack_ld(Recx)                                                      \
         movix_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * SSE4: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * SSE2: pshuflw/pshufhw swap words, then bswgx_rr (uses SCR01/SCR02) */
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define bswix_rr(XD, XS)                                                    \
+        shwix3ri(W(XD), W(XS), IB(0xB1))                                    \
+        bswgx_rr(W(XD), W(XD))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswix_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x00010203), IW(0x04050607),                            \
+                 IW(0x08090A0B), IW(0x0C0D0E0F))                            \
+        shbix3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#define mskix_mi(I0, I1, I2, I3) /* not portable, do not use outside */     \
+        movwx_mi(Mebp, inf_SCR02(0x00), W(I0))                              \
+        movwx_mi(Mebp, inf_SCR02(0x04), W(I1))                              \
+        movwx_mi(Mebp, inf_SCR02(0x08), W(I2))                              \
+        movwx_mi(Mebp, inf_SCR02(0x0C), W(I3))
+
+#define shbix3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+        movix_rr(W(XD), W(XS))                                              \
+ADR ESC REX(RXB(XD), RXB(MT)) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
+#define shwix3ri(XD, XS, IT) /* not portable, do not use outside */         \
+    XF2 REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+    XF3 REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
 /****************   packed single-precision integer compare   *****************/
 
 #if (RT_SIMD_COMPAT_SSE < 4)
@@ -2708,6 +2754,16 @@ ADR XF3 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
         movrs_rr(W(XD), W(XS))                                              \
         cgers_ld(W(XD), W(MT), W(DT))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        REX(RXB(XS), RXB(XT)) EMITB(0x0F) EMITB(0x2E)                       \
+        MRM(REG(XS), MOD(XT), REG(XT))                                      \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /**********************************   MODE   **********************************/
 /******************************************************************************/
@@ -946,7 +946,8 @@
 #define RT_SIMD_MASK_NONE32_256    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_256    0x0F     /*  all satisfy the condition */
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         REX(0,             0) EMITB(0x0F) EMITB(0x50)                       \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
         REX(1,             1) EMITB(0x0F) EMITB(0x50)                       \
@@ -955,8 +956,12 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##32_256 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_256))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -2006,6 +2011,52 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0xE2)                       \
         stack_ld(Recx)                                                      \
         movcx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * SSE4: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * SSE2: pshuflw/pshufhw swap words, then bswax_rr (uses SCR01/SCR02) */
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define bswcx_rr(XD, XS)                                                    \
+        shwcx3ri(W(XD), W(XS), IB(0xB1))                                    \
+        bswax_rr(W(XD), W(XD))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswcx_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x00010203), IW(0x04050607),                            \
+                 IW(0x08090A0B), IW(0x0C0D0E0F))                            \
+        shbcx3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#define shbcx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+        movcx_rr(W(XD), W(XS))                                              \
+ADR ESC REX(0,       RXB(MT)) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MT)) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
+#define shwcx3ri(XD, XS, IT) /* not portable, do not use outside */         \
+    XF2 REX(0,             0) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+    XF3 REX(0,             0) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+    XF2 REX(1,             1) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+    XF3 REX(1,             1) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
 /****************   packed single-precision integer compare   *****************/
 
 #if (RT_SIMD_COMPAT_SSE < 4)
@@ -2658,39 +2709,25 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x66)                       \
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)
+        movcx_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movcx_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)
+        movcx_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        movcx_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        movcx_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        movcx_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        movcx_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        movcx_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        movcx_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))
 
 #endif /* RT_128X2 */
 
@@ -759,12 +759,15 @@
 #define RT_SIMD_MASK_NONE32_256    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_256    0xFF     /*  all satisfy the condition */
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        VEX(0,       RXB(XS),    0x00, 1, 0, 1) EMITB(0x50)                 \
-        MRM(0x00,    MOD(XS), REG(XS))                                      \
-        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_256))                     \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        VEX(1,       RXB(XS),    0x00, 1, 0, 1) EMITB(0x50)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(RMxx, IB(RT_SIMD_MASK_##mask##32_256))                     \
         jeqxx_lb(lb)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1654,6 +1657,48 @@
 
 #endif /* RT_256X1 >= 2, AVX2 */
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * AVX2: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * AVX1: byte-swaps 128-bit halves with bswix_ld, uses SCR01 as scratch */
+
+#if (RT_256X1 < 2)
+
+#define bswcx_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        bswix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        bswix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+#define bswcx_rr(XD, XS)                                                    \
+        mskcx_mi(IW(0x00010203), IW(0x04050607),                            \
+                 IW(0x08090A0B), IW(0x0C0D0E0F))                            \
+        shbcx3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#define mskcx_mi(I0, I1, I2, I3) /* not portable, do not use outside */     \
+        movwx_mi(Mebp, inf_SCR02(0x00), W(I0))                              \
+        movwx_mi(Mebp, inf_SCR02(0x04), W(I1))                              \
+        movwx_mi(Mebp, inf_SCR02(0x08), W(I2))                              \
+        movwx_mi(Mebp, inf_SCR02(0x0C), W(I3))                              \
+        movwx_mi(Mebp, inf_SCR02(0x10), W(I0))                              \
+        movwx_mi(Mebp, inf_SCR02(0x14), W(I1))                              \
+        movwx_mi(Mebp, inf_SCR02(0x18), W(I2))                              \
+        movwx_mi(Mebp, inf_SCR02(0x1C), W(I3))
+
+#define shbcx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 #if (RT_256X1 < 2)
@@ -2095,71 +2140,41 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         muvcx_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmF, Oeax, PLAIN)
+        muvcx_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        muvcx_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        muvcx_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        muvcx_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        muvcx_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        muvcx_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        muvcx_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        muvcx_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        muvcx_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        muvcx_st(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        muvcx_st(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        muvcx_st(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        muvcx_st(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        muvcx_st(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        muvcx_st(XmmF, Meax, DP(RT_SIMD_WIDTH32_256*4*15))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmF, Oeax, PLAIN)
+        muvcx_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        muvcx_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        muvcx_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        muvcx_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        muvcx_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        muvcx_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        muvcx_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))                   \
+        muvcx_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32_256*4*8))                   \
+        muvcx_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32_256*4*9))                   \
+        muvcx_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32_256*4*10))                  \
+        muvcx_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32_256*4*11))                  \
+        muvcx_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32_256*4*12))                  \
+        muvcx_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32_256*4*13))                  \
+        muvcx_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32_256*4*14))                  \
+        muvcx_ld(XmmF, Meax, DP(RT_SIMD_WIDTH32_256*4*15))
 
 #endif /* RT_256X1 */
 
@@ -647,12 +647,15 @@
         VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjcx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         ck1cx_rm(W(XS), Mebp, inf_GPC07)                                    \
-        mk1wx_rx(Reax)                                                      \
-        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_256))                     \
+        mk1wx_rx(RMxx)                                                      \
+        cmpwx_ri(RMxx, IH(RT_SIMD_MASK_##mask##32_256))                     \
         jeqxx_lb(lb)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1130,6 +1133,33 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * uses pshufb with byte-reverse mask written to SCR02 by imm stores */
+
+#define bswcx_rr(XD, XS)                                                    \
+        mskcx_mi(IW(0x00010203), IW(0x04050607),                            \
+                 IW(0x08090A0B), IW(0x0C0D0E0F))                            \
+        shbcx3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
+#define mskcx_mi(I0, I1, I2, I3) /* not portable, do not use outside */     \
+        movwx_mi(Mebp, inf_SCR02(0x00), W(I0))                              \
+        movwx_mi(Mebp, inf_SCR02(0x04), W(I1))                              \
+        movwx_mi(Mebp, inf_SCR02(0x08), W(I2))                              \
+        movwx_mi(Mebp, inf_SCR02(0x0C), W(I3))                              \
+        movwx_mi(Mebp, inf_SCR02(0x10), W(I0))                              \
+        movwx_mi(Mebp, inf_SCR02(0x14), W(I1))                              \
+        movwx_mi(Mebp, inf_SCR02(0x18), W(I2))                              \
+        movwx_mi(Mebp, inf_SCR02(0x1C), W(I3))
+
+#define shbcx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1422,66 +1452,37 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         muvox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+        muvox_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_512*4*1))                   \
+        muvox_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_512*4*2))                   \
+        muvox_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_512*4*3))                   \
+        muvox_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_512*4*4))                   \
+        muvox_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_512*4*5))                   \
+        muvox_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_512*4*6))                   \
+        muvox_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_512*4*7))                   \
+        muvox_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32_512*4*8))                   \
+        muvox_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32_512*4*9))                   \
+        muvox_st(XmmA, Meax, DP(RT_SIMD_WIDTH32_512*4*10))                  \
+        muvox_st(XmmB, Meax, DP(RT_SIMD_WIDTH32_512*4*11))                  \
+        muvox_st(XmmC, Meax, DP(RT_SIMD_WIDTH32_512*4*12))                  \
+        muvox_st(XmmD, Meax, DP(RT_SIMD_WIDTH32_512*4*13))                  \
+        muvox_st(XmmE, Meax, DP(RT_SIMD_WIDTH32_512*4*14))                  \
+        muvox_st(XmmF, Meax, DP(RT_SIMD_WIDTH32_512*4*15))                  \
+        muvox_st(XmmG, Meax, DP(RT_SIMD_WIDTH32_512*4*16))                  \
+        muvox_st(XmmH, Meax, DP(RT_SIMD_WIDTH32_512*4*17))                  \
+        muvox_st(XmmI, Meax, DP(RT_SIMD_WIDTH32_512*4*18))                  \
+        muvox_st(XmmJ, Meax, DP(RT_SIMD_WIDTH32_512*4*19))                  \
+        muvox_st(XmmK, Meax, DP(RT_SIMD_WIDTH32_512*4*20))                  \
+        muvox_st(XmmL, Meax, DP(RT_SIMD_WIDTH32_512*4*21))                  \
+        muvox_st(XmmM, Meax, DP(RT_SIMD_WIDTH32_512*4*22))                  \
+        muvox_st(XmmN, Meax, DP(RT_SIMD_WIDTH32_512*4*23))                  \
+        muvox_st(XmmO, Meax, DP(RT_SIMD_WIDTH32_512*4*24))                  \
+        muvox_st(XmmP, Meax, DP(RT_SIMD_WIDTH32_512*4*25))                  \
+        muvox_st(XmmQ, Meax, DP(RT_SIMD_WIDTH32_512*4*26))                  \
+        muvox_st(XmmR, Meax, DP(RT_SIMD_WIDTH32_512*4*27))                  \
+        muvox_st(XmmS, Meax, DP(RT_SIMD_WIDTH32_512*4*28))                  \
+        muvox_st(XmmT, Meax, DP(RT_SIMD_WIDTH32_512*4*29))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_512*4*30))                        \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_st(Redx)                                                      \
         stack_st(Recx)                                                      \
@@ -1492,8 +1493,8 @@
         cpuid_xx()                                                          \
         stack_ld(Reax)                                                      \
         andwxZri(Rebx, IV(0x40000000))  /* check AVX512BW extension-bit */  \
-        EMITB(0x74) EMITB(0x05)                                             \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+        EMITB(0x74) EMITB(0x05 + x67)                                       \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_ld(Rebx)                                                      \
         stack_ld(Recx)                                                      \
@@ -1503,66 +1504,37 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         muvox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+        muvox_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_512*4*1))                   \
+        muvox_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_512*4*2))                   \
+        muvox_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_512*4*3))                   \
+        muvox_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_512*4*4))                   \
+        muvox_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_512*4*5))                   \
+        muvox_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_512*4*6))                   \
+        muvox_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_512*4*7))                   \
+        muvox_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32_512*4*8))                   \
+        muvox_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32_512*4*9))                   \
+        muvox_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32_512*4*10))                  \
+        muvox_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32_512*4*11))                  \
+        muvox_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32_512*4*12))                  \
+        muvox_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32_512*4*13))                  \
+        muvox_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32_512*4*14))                  \
+        muvox_ld(XmmF, Meax, DP(RT_SIMD_WIDTH32_512*4*15))                  \
+        muvox_ld(XmmG, Meax, DP(RT_SIMD_WIDTH32_512*4*16))                  \
+        muvox_ld(XmmH, Meax, DP(RT_SIMD_WIDTH32_512*4*17))                  \
+        muvox_ld(XmmI, Meax, DP(RT_SIMD_WIDTH32_512*4*18))                  \
+        muvox_ld(XmmJ, Meax, DP(RT_SIMD_WIDTH32_512*4*19))                  \
+        muvox_ld(XmmK, Meax, DP(RT_SIMD_WIDTH32_512*4*20))                  \
+        muvox_ld(XmmL, Meax, DP(RT_SIMD_WIDTH32_512*4*21))                  \
+        muvox_ld(XmmM, Meax, DP(RT_SIMD_WIDTH32_512*4*22))                  \
+        muvox_ld(XmmN, Meax, DP(RT_SIMD_WIDTH32_512*4*23))                  \
+        muvox_ld(XmmO, Meax, DP(RT_SIMD_WIDTH32_512*4*24))                  \
+        muvox_ld(XmmP, Meax, DP(RT_SIMD_WIDTH32_512*4*25))                  \
+        muvox_ld(XmmQ, Meax, DP(RT_SIMD_WIDTH32_512*4*26))                  \
+        muvox_ld(XmmR, Meax, DP(RT_SIMD_WIDTH32_512*4*27))                  \
+        muvox_ld(XmmS, Meax, DP(RT_SIMD_WIDTH32_512*4*28))                  \
+        muvox_ld(XmmT, Meax, DP(RT_SIMD_WIDTH32_512*4*29))                  \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32_512*4*30))                        \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_st(Redx)                                                      \
         stack_st(Recx)                                                      \
@@ -1573,8 +1545,8 @@
         cpuid_xx()                                                          \
         stack_ld(Reax)                                                      \
         andwxZri(Rebx, IV(0x40000000))  /* check AVX512BW extension-bit */  \
-        EMITB(0x74) EMITB(0x05)                                             \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+        EMITB(0x74) EMITB(0x05 + x67)                                       \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_ld(Rebx)                                                      \
         stack_ld(Recx)                                                      \
@@ -899,7 +899,8 @@
 #define RT_SIMD_MASK_NONE32_512    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL32_512    0xFF     /*  all satisfy the condition */
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x50)                 \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
         VEX(1,             1,    0x00, 1, 0, 1) EMITB(0x50)                 \
@@ -908,8 +909,12 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##32_512 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_512))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjox_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -2607,39 +2612,25 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)
+        movox_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)
+        movox_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))
 
 #endif /* RT_256X2 */
 
@@ -149,7 +149,7 @@
         AUX(SIB(MT), CMD(DT), EMPTY)
 
 #define mmxox_ld(XD, PS, MT, DT) /* not portable, do not use outside */     \
-    ADR EPX(REG(PS),    0x01, RXB(XD), RXB(MT), 0x00, K,1,1) EMITB(0x28)    \
+    ADR EPX(REG(PS),    0x01, RXB(XD), RXB(MT), 0x00, K,0,1) EMITB(0x28)    \
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
@@ -419,9 +419,9 @@
         VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03, REG(PS))
 
-#define mxjox_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        mkxwx_rx(Reax, W(PS))                                               \
-        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_512))                     \
+#define mxjox_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        mkxwx_rx(RMxx, W(PS))                                               \
+        cmpwx_ri(RMxx, IH(RT_SIMD_MASK_##mask##32_512))                     \
         jeqxx_lb(lb)
 
 /* mov (D = S), predicated */
@@ -440,12 +440,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* sel (D = P ? T : S), predicated blend */
+
 #define selox_rr(XD, PS, XS, XT)                                            \
         EPX(REG(PS), 0,       RXB(XD), RXB(XT), REN(XS), K,1,2) EMITB(0x65) \
         MRM(REG(XD), MOD(XT), REG(XT))
 
 #define selox_ld(XD, PS, XS, MT, DT)                                        \
-        EPX(REG(PS), 0,       RXB(XD), RXB(MT), REN(XS), K,1,2) EMITB(0x65) \
+    ADR EPX(REG(PS), 0,       RXB(XD), RXB(MT), REN(XS), K,1,2) EMITB(0x65) \
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
@@ -1073,12 +1075,15 @@
         VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
-        mk1wx_rx(Reax)                                                      \
-        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_512))                     \
+        mk1wx_rx(RMxx)                                                      \
+        cmpwx_ri(RMxx, IH(RT_SIMD_MASK_##mask##32_512))                     \
         jeqxx_lb(lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjox_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1836,84 +1841,55 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+        movox_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        movox_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32*4*8))                       \
+        movox_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32*4*9))                       \
+        movox_st(XmmA, Meax, DP(RT_SIMD_WIDTH32*4*10))                      \
+        movox_st(XmmB, Meax, DP(RT_SIMD_WIDTH32*4*11))                      \
+        movox_st(XmmC, Meax, DP(RT_SIMD_WIDTH32*4*12))                      \
+        movox_st(XmmD, Meax, DP(RT_SIMD_WIDTH32*4*13))                      \
+        movox_st(XmmE, Meax, DP(RT_SIMD_WIDTH32*4*14))                      \
+        movox_st(XmmF, Meax, DP(RT_SIMD_WIDTH32*4*15))                      \
+        movox_st(XmmG, Meax, DP(RT_SIMD_WIDTH32*4*16))                      \
+        movox_st(XmmH, Meax, DP(RT_SIMD_WIDTH32*4*17))                      \
+        movox_st(XmmI, Meax, DP(RT_SIMD_WIDTH32*4*18))                      \
+        movox_st(XmmJ, Meax, DP(RT_SIMD_WIDTH32*4*19))                      \
+        movox_st(XmmK, Meax, DP(RT_SIMD_WIDTH32*4*20))                      \
+        movox_st(XmmL, Meax, DP(RT_SIMD_WIDTH32*4*21))                      \
+        movox_st(XmmM, Meax, DP(RT_SIMD_WIDTH32*4*22))                      \
+        movox_st(XmmN, Meax, DP(RT_SIMD_WIDTH32*4*23))                      \
+        movox_st(XmmO, Meax, DP(RT_SIMD_WIDTH32*4*24))                      \
+        movox_st(XmmP, Meax, DP(RT_SIMD_WIDTH32*4*25))                      \
+        movox_st(XmmQ, Meax, DP(RT_SIMD_WIDTH32*4*26))                      \
+        movox_st(XmmR, Meax, DP(RT_SIMD_WIDTH32*4*27))                      \
+        movox_st(XmmS, Meax, DP(RT_SIMD_WIDTH32*4*28))                      \
+        movox_st(XmmT, Meax, DP(RT_SIMD_WIDTH32*4*29))                      \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*30))                            \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x02,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x03,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x04,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x05,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x06,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x07,       0x00,    0x00)                                      \
         subxx_ri(Reax, IH(RT_SIMD_WIDTH32*4*7))                             \
         stack_st(Redx)                                                      \
@@ -1925,27 +1901,27 @@
         cpuid_xx()                                                          \
         stack_ld(Reax)                                                      \
         andwxZri(Rebx, IV(0x40000000))  /* check AVX512BW extension-bit */  \
-        EMITB(0x74) EMITB(0x54)                                             \
+        EMITB(0x74) EMITB(0x54 + x67*7)                                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x02,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x03,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x04,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x05,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x06,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x07,       0x00,    0x00)                                      \
         stack_ld(Rebx)                                                      \
         stack_ld(Recx)                                                      \
@@ -1955,84 +1931,55 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmG, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmH, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmI, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmJ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmK, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmL, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmM, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmN, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmO, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmP, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmQ, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmR, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmS, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmT, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+        movox_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        movox_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32*4*8))                       \
+        movox_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32*4*9))                       \
+        movox_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32*4*10))                      \
+        movox_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32*4*11))                      \
+        movox_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32*4*12))                      \
+        movox_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32*4*13))                      \
+        movox_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32*4*14))                      \
+        movox_ld(XmmF, Meax, DP(RT_SIMD_WIDTH32*4*15))                      \
+        movox_ld(XmmG, Meax, DP(RT_SIMD_WIDTH32*4*16))                      \
+        movox_ld(XmmH, Meax, DP(RT_SIMD_WIDTH32*4*17))                      \
+        movox_ld(XmmI, Meax, DP(RT_SIMD_WIDTH32*4*18))                      \
+        movox_ld(XmmJ, Meax, DP(RT_SIMD_WIDTH32*4*19))                      \
+        movox_ld(XmmK, Meax, DP(RT_SIMD_WIDTH32*4*20))                      \
+        movox_ld(XmmL, Meax, DP(RT_SIMD_WIDTH32*4*21))                      \
+        movox_ld(XmmM, Meax, DP(RT_SIMD_WIDTH32*4*22))                      \
+        movox_ld(XmmN, Meax, DP(RT_SIMD_WIDTH32*4*23))                      \
+        movox_ld(XmmO, Meax, DP(RT_SIMD_WIDTH32*4*24))                      \
+        movox_ld(XmmP, Meax, DP(RT_SIMD_WIDTH32*4*25))                      \
+        movox_ld(XmmQ, Meax, DP(RT_SIMD_WIDTH32*4*26))                      \
+        movox_ld(XmmR, Meax, DP(RT_SIMD_WIDTH32*4*27))                      \
+        movox_ld(XmmS, Meax, DP(RT_SIMD_WIDTH32*4*28))                      \
+        movox_ld(XmmT, Meax, DP(RT_SIMD_WIDTH32*4*29))                      \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*30))                            \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x02,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x03,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x04,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x05,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x06,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x07,       0x00,    0x00)                                      \
         subxx_ri(Reax, IH(RT_SIMD_WIDTH32*4*7))                             \
         stack_st(Redx)                                                      \
@@ -2044,27 +1991,27 @@
         cpuid_xx()                                                          \
         stack_ld(Reax)                                                      \
         andwxZri(Rebx, IV(0x40000000))  /* check AVX512BW extension-bit */  \
-        EMITB(0x74) EMITB(0x54)                                             \
+        EMITB(0x74) EMITB(0x54 + x67*7)                                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x02,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x03,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x04,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x05,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x06,       0x00,    0x00)                                      \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x07,       0x00,    0x00)                                      \
         stack_ld(Rebx)                                                      \
         stack_ld(Recx)                                                      \
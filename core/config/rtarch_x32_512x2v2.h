@@ -152,10 +152,10 @@
         AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
 
 #define mmxox_ld(XD, PS, MT, DT) /* not portable, do not use outside */     \
-    ADR EPX(REG(PS),    0x01, RXB(XD), RXB(MT), 0x00, K,1,1) EMITB(0x28)    \
+    ADR EPX(REG(PS),    0x01, RXB(XD), RXB(MT), 0x00, K,0,1) EMITB(0x28)    \
         MRM(REG(XD),    0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
-    ADR EPX(REP(PS),    0x01, RMB(XD), RXB(MT), 0x00, K,1,1) EMITB(0x28)    \
+    ADR EPX(REP(PS),    0x01, RMB(XD), RXB(MT), 0x00, K,0,1) EMITB(0x28)    \
         MRM(REG(XD),    0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
 
@@ -517,7 +517,8 @@
         VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03, REG(PS))
 
-#define mxjox_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mxjox_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         mkxwx_rx(Reax, W(PS))                                               \
         REX(1,             0) EMITB(0x8B)                                   \
         MRM(0x07,       0x03, 0x00)                                         \
@@ -526,8 +527,49 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##32_1K4 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_1K4))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+/* mov (D = S), predicated */
+
+#define mxvox_rr(XD, PS, XS)                                                \
+        EPX(REG(PS), 0,       RXB(XD), RXB(XS), 0x00, K,0,1) EMITB(0x28)    \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EPX(REP(PS), 0,       RMB(XD), RMB(XS), 0x00, K,0,1) EMITB(0x28)    \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mxvox_ld(XD, PS, MS, DS)                                            \
+    ADR EPX(REG(PS), 1,       RXB(XD), RXB(MS), 0x00, K,0,1) EMITB(0x28)    \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EPX(REP(PS), 1,       RMB(XD), RXB(MS), 0x00, K,0,1) EMITB(0x28)    \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#define mxvox_st(XS, PS, MD, DD)                                            \
+    ADR EPX(REG(PS), 0,       RXB(XS), RXB(MD), 0x00, K,0,1) EMITB(0x29)    \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EPX(REP(PS), 0,       RMB(XS), RXB(MD), 0x00, K,0,1) EMITB(0x29)    \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
+/* sel (D = P ? T : S), predicated blend */
+
+#define selox_rr(XD, PS, XS, XT)                                            \
+        EPX(REG(PS), 0,       RXB(XD), RXB(XT), REN(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EPX(REP(PS), 0,       RMB(XD), RMB(XT), REM(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define selox_ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPX(REG(PS), 0,       RXB(XD), RXB(MT), REN(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EPX(REP(PS), 0,       RMB(XD), RXB(MT), REM(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
 /******************************************************************************/
 /**********************************   SIMD   **********************************/
 /******************************************************************************/
@@ -1284,7 +1326,8 @@
         VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1wx_rx(Reax)                                                      \
         REX(1,             0) EMITB(0x8B)                                   \
@@ -1295,8 +1338,12 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##32_1K4 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_1K4))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjox_rx(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -2310,38 +2357,23 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+        movox_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        movox_st(Xmm8, Meax, DP(RT_SIMD_WIDTH32*4*8))                       \
+        movox_st(Xmm9, Meax, DP(RT_SIMD_WIDTH32*4*9))                       \
+        movox_st(XmmA, Meax, DP(RT_SIMD_WIDTH32*4*10))                      \
+        movox_st(XmmB, Meax, DP(RT_SIMD_WIDTH32*4*11))                      \
+        movox_st(XmmC, Meax, DP(RT_SIMD_WIDTH32*4*12))                      \
+        movox_st(XmmD, Meax, DP(RT_SIMD_WIDTH32*4*13))                      \
+        movox_st(XmmE, Meax, DP(RT_SIMD_WIDTH32*4*14))                      \
+        movox_st(XmmF, Meax, DP(RT_SIMD_WIDTH32*4*15))                      \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*16))                            \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_st(Redx)                                                      \
         stack_st(Recx)                                                      \
@@ -2352,8 +2384,8 @@
         cpuid_xx()                                                          \
         stack_ld(Reax)                                                      \
         andwxZri(Rebx, IV(0x40000000))  /* check AVX512BW extension-bit */  \
-        EMITB(0x74) EMITB(0x05)                                             \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
+        EMITB(0x74) EMITB(0x05 + x67)                                       \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_ld(Rebx)                                                      \
         stack_ld(Recx)                                                      \
@@ -2363,38 +2395,23 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmF, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+        movox_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        movox_ld(Xmm8, Meax, DP(RT_SIMD_WIDTH32*4*8))                       \
+        movox_ld(Xmm9, Meax, DP(RT_SIMD_WIDTH32*4*9))                       \
+        movox_ld(XmmA, Meax, DP(RT_SIMD_WIDTH32*4*10))                      \
+        movox_ld(XmmB, Meax, DP(RT_SIMD_WIDTH32*4*11))                      \
+        movox_ld(XmmC, Meax, DP(RT_SIMD_WIDTH32*4*12))                      \
+        movox_ld(XmmD, Meax, DP(RT_SIMD_WIDTH32*4*13))                      \
+        movox_ld(XmmE, Meax, DP(RT_SIMD_WIDTH32*4*14))                      \
+        movox_ld(XmmF, Meax, DP(RT_SIMD_WIDTH32*4*15))                      \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*16))                            \
+    ADR VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_st(Redx)                                                      \
         stack_st(Recx)                                                      \
@@ -2405,8 +2422,8 @@
         cpuid_xx()                                                          \
         stack_ld(Reax)                                                      \
         andwxZri(Rebx, IV(0x40000000))  /* check AVX512BW extension-bit */  \
-        EMITB(0x74) EMITB(0x05)                                             \
-        VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
+        EMITB(0x74) EMITB(0x05 + x67)                                       \
+    ADR VEW(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_ld(Rebx)                                                      \
         stack_ld(Recx)                                                      \
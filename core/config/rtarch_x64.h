@@ -49,6 +49,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -310,7 +312,7 @@
         MRM(REG(RG), MOD(RS), REG(RS))
 
 #define annzxZld(RG, MS, DS)                                                \
-        VEW(RXB(RG), RXB(MS), REN(RG), 0, 0, 2) EMITB(0xF2)                 \
+    ADR VEW(RXB(RG), RXB(MS), REN(RG), 0, 0, 2) EMITB(0xF2)                 \
         MRM(REG(RG), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
@@ -478,6 +480,27 @@
         MRM(0x02,    MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswzx_rx(RG)                                                        \
+        REW(0,       RXB(RG)) EMITB(0x0F) EMITB(0xC8 + REG(RG))
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        bswzx_rx(W(RD))
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define bswzx_ld(RD, MS, DS)                                                \
+    ADR REW(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0xF0)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1537,6 +1560,21 @@
         MRM(0x07,    MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* internal definitions for mask-to-index (mln) in SIMD byte subsets,
+ * ctozx_rx: G = count of trailing 1s in zero-extended 32-bit mask G (0..32),
+ * ctozx_rr: G = S + G if S == 32 else S, S is the count of preceding part */
+
+#define ctozx_rx(RG)         /* not portable, do not use outside */         \
+        notzx_rx(W(RG))                                                     \
+        REW(RXB(RG), RXB(RG)) EMITB(0x0F) EMITB(0xBC)                       \
+        MRM(REG(RG), MOD(RG), REG(RG))
+
+#define ctozx_rr(RG, RS)     /* not portable, do not use outside */         \
+        addwx_rr(W(RG), W(RS))                                              \
+        cmpwx_ri(W(RS), IB(32))                                             \
+        REX(RXB(RG), RXB(RS)) EMITB(0x0F) EMITB(0x45)                       \
+        MRM(REG(RG), MOD(RS), REG(RS))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -655,12 +655,15 @@
 
 /* #define mk1wx_rx(RD)                    (defined in 32_128-bit header) */
 
-#define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjjx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         ck1jx_rm(W(XS), Mebp, inf_GPC07)                                    \
-        mk1wx_rx(Reax)                                                      \
-        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##64_128))                     \
+        mk1wx_rx(RMxx)                                                      \
+        cmpwx_ri(RMxx, IB(RT_SIMD_MASK_##mask##64_128))                     \
         jeqxx_lb(lb)
 
+#define mkjjx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1144,6 +1147,18 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * uses pshufb with byte-reverse mask written to SCR02 by imm stores */
+
+#define bswjx_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x04050607), IW(0x00010203),                            \
+                 IW(0x0C0D0E0F), IW(0x08090A0B))                            \
+        shbix3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1740,6 +1755,16 @@
         AUX(SIB(MT), CMD(DT), EMITB(0x05))                                  \
         mz1tx_ld(W(XD), Mebp, inf_GPC07)
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjts_rr(XS, XT, cc, lb)                                            \
+        EVW(RXB(XS), RXB(XT),    0x00, 0, 1, 1) EMITB(0x2E)                 \
+        MRM(REG(XS), MOD(XT), REG(XT))                                      \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -791,12 +791,15 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
 #define RT_SIMD_MASK_NONE64_128    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_128    0x03     /*  all satisfy the condition */
 
-#define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-    ESC REX(0,       RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
-        MRM(0x00,    MOD(XS), REG(XS))                                      \
-        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##64_128))                     \
+#define mkjjx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+    ESC REX(1,       RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(RMxx, IB(RT_SIMD_MASK_##mask##64_128))                     \
         jeqxx_lb(lb)
 
+#define mkjjx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1646,6 +1649,29 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD3)                       \
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * SSE4: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * SSE2: pshuflw/pshufhw reverse words, then bswgx_rr (uses SCR01/SCR02) */
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define bswjx_rr(XD, XS)                                                    \
+        shwix3ri(W(XD), W(XS), IB(0x1B))                                    \
+        bswgx_rr(W(XD), W(XD))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswjx_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x04050607), IW(0x00010203),                            \
+                 IW(0x0C0D0E0F), IW(0x08090A0B))                            \
+        shbix3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -2810,6 +2836,16 @@ ADR XF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
         movts_rr(W(XD), W(XS))                                              \
         cgets_ld(W(XD), W(MT), W(DT))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjts_rr(XS, XT, cc, lb)                                            \
+    ESC REX(RXB(XS), RXB(XT)) EMITB(0x0F) EMITB(0x2E)                       \
+        MRM(REG(XS), MOD(XT), REG(XT))                                      \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
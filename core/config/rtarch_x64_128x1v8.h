@@ -765,12 +765,15 @@
 #define RT_SIMD_MASK_NONE64_128    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_128    0x03     /*  all satisfy the condition */
 
-#define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        VEX(0,       RXB(XS),    0x00, 0, 1, 1) EMITB(0x50)                 \
-        MRM(0x00,    MOD(XS), REG(XS))                                      \
-        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_128))                     \
+#define mkjjx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        VEX(1,       RXB(XS),    0x00, 0, 1, 1) EMITB(0x50)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(RMxx, IH(RT_SIMD_MASK_##mask##64_128))                     \
         jeqxx_lb(lb)
 
+#define mkjjx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -794,10 +797,6 @@
         fpuzt_st(Mebp,  inf_SCR01(0x00))                                    \
         fpuzs_ld(Mebp,  inf_SCR01(0x08))                                    \
         fpuzt_st(Mebp,  inf_SCR01(0x08))                                    \
-        fpuzs_ld(Mebp,  inf_SCR01(0x10))                                    \
-        fpuzt_st(Mebp,  inf_SCR01(0x10))                                    \
-        fpuzs_ld(Mebp,  inf_SCR01(0x18))                                    \
-        fpuzt_st(Mebp,  inf_SCR01(0x18))                                    \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
 #define cvzjs_ld(XD, MS, DS) /* round towards zero */                       \
@@ -871,10 +870,6 @@
         fpuzn_st(Mebp,  inf_SCR01(0x00))                                    \
         fpuzs_ld(Mebp,  inf_SCR01(0x08))                                    \
         fpuzn_st(Mebp,  inf_SCR01(0x08))                                    \
-        fpuzs_ld(Mebp,  inf_SCR01(0x10))                                    \
-        fpuzn_st(Mebp,  inf_SCR01(0x10))                                    \
-        fpuzs_ld(Mebp,  inf_SCR01(0x18))                                    \
-        fpuzn_st(Mebp,  inf_SCR01(0x18))                                    \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
 #define cvnjs_ld(XD, MS, DS) /* round towards near */                       \
@@ -930,10 +925,6 @@
         fpuzs_st(Mebp,  inf_SCR01(0x00))                                    \
         fpuzn_ld(Mebp,  inf_SCR01(0x08))                                    \
         fpuzs_st(Mebp,  inf_SCR01(0x08))                                    \
-        fpuzn_ld(Mebp,  inf_SCR01(0x10))                                    \
-        fpuzs_st(Mebp,  inf_SCR01(0x10))                                    \
-        fpuzn_ld(Mebp,  inf_SCR01(0x18))                                    \
-        fpuzs_st(Mebp,  inf_SCR01(0x18))                                    \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
 #define cvnjn_ld(XD, MS, DS) /* round towards near */                       \
@@ -1428,6 +1419,18 @@
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * uses pshufb with byte-reverse mask written to SCR02 by imm stores */
+
+#define bswjx_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x04050607), IW(0x00010203),                            \
+                 IW(0x0C0D0E0F), IW(0x08090A0B))                            \
+        shbix3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -2213,6 +2216,16 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMITB(0x05))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjts_rr(XS, XT, cc, lb)                                            \
+        VEX(RXB(XS), RXB(XT),    0x00, 0, 1, 1) EMITB(0x2E)                 \
+        MRM(REG(XS), MOD(XT), REG(XT))                                      \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
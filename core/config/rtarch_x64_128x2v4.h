@@ -885,7 +885,8 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
 #define RT_SIMD_MASK_NONE64_256    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_256    0x03     /*  all satisfy the condition */
 
-#define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjdx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
     ESC REX(0,             0) EMITB(0x0F) EMITB(0x50)                       \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
     ESC REX(1,             1) EMITB(0x0F) EMITB(0x50)                       \
@@ -894,8 +895,12 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##64_256 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##64_256))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjdx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjdx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1909,6 +1914,29 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0xD3)                       \
         stack_ld(Recx)                                                      \
         movdx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * SSE4: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * SSE2: pshuflw/pshufhw reverse words, then bswax_rr (uses SCR01/SCR02) */
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define bswdx_rr(XD, XS)                                                    \
+        shwcx3ri(W(XD), W(XS), IB(0x1B))                                    \
+        bswax_rr(W(XD), W(XD))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswdx_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x04050607), IW(0x00010203),                            \
+                 IW(0x0C0D0E0F), IW(0x08090A0B))                            \
+        shbcx3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -770,12 +770,15 @@
 #define RT_SIMD_MASK_NONE64_256    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_256    0x0F     /*  all satisfy the condition */
 
-#define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        VEX(0,       RXB(XS),    0x00, 1, 1, 1) EMITB(0x50)                 \
-        MRM(0x00,    MOD(XS), REG(XS))                                      \
-        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##64_256))                     \
+#define mkjdx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        VEX(1,       RXB(XS),    0x00, 1, 1, 1) EMITB(0x50)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(RMxx, IB(RT_SIMD_MASK_##mask##64_256))                     \
         jeqxx_lb(lb)
 
+#define mkjdx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjdx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1607,6 +1610,33 @@
         stack_ld(Recx)                                                      \
         movdx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * AVX2: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * AVX1: byte-swaps 128-bit halves with bswjx_ld, uses SCR01 as scratch */
+
+#if (RT_256X1 < 2)
+
+#define bswdx_rr(XD, XS)                                                    \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        bswjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        bswjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+#define bswdx_rr(XD, XS)                                                    \
+        mskcx_mi(IW(0x04050607), IW(0x00010203),                            \
+                 IW(0x0C0D0E0F), IW(0x08090A0B))                            \
+        shbcx3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
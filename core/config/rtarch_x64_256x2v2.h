@@ -920,7 +920,8 @@
 #define RT_SIMD_MASK_NONE64_512    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL64_512    0x0F     /*  all satisfy the condition */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjqx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         VEX(0,             0,    0x00, 1, 1, 1) EMITB(0x50)                 \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
         VEX(1,             1,    0x00, 1, 1, 1) EMITB(0x50)                 \
@@ -929,8 +930,12 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##64_512 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##64_512))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjqx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjqx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -386,9 +386,9 @@
 
 /* #define mkxwx_rx(RD)                    (defined in 32_512-bit header) */
 
-#define mxjqx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        mkxwx_rx(Reax, W(PS))                                               \
-        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_512))                     \
+#define mxjqx_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        mkxwx_rx(RMxx, W(PS))                                               \
+        cmpwx_ri(RMxx, IH(RT_SIMD_MASK_##mask##64_512))                     \
         jeqxx_lb(lb)
 
 /* mov (D = S), predicated */
@@ -407,12 +407,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* sel (D = P ? T : S), predicated blend */
+
 #define selqx_rr(XD, PS, XS, XT)                                            \
         EPW(REG(PS), 0,       RXB(XD), RXB(XT), REN(XS), K,1,2) EMITB(0x65) \
         MRM(REG(XD), MOD(XT), REG(XT))
 
 #define selqx_ld(XD, PS, XS, MT, DT)                                        \
-        EPW(REG(PS), 0,       RXB(XD), RXB(MT), REN(XS), K,1,2) EMITB(0x65) \
+    ADR EPW(REG(PS), 0,       RXB(XD), RXB(MT), REN(XS), K,1,2) EMITB(0x65) \
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
@@ -1038,12 +1040,15 @@
 
 /* #define mk1wx_rx(RD)                    (defined in 32_512-bit header) */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjqx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
-        mk1wx_rx(Reax)                                                      \
-        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_512))                     \
+        mk1wx_rx(RMxx)                                                      \
+        cmpwx_ri(RMxx, IH(RT_SIMD_MASK_##mask##64_512))                     \
         jeqxx_lb(lb)
 
+#define mkjqx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjqx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -488,7 +488,8 @@
 
 /* #define mkxwx_rx(RD)                    (defined in 32_512-bit header) */
 
-#define mxjqx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mxjqx_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         mkxwx_rx(Reax, W(PS))                                               \
         REX(1,             0) EMITB(0x8B)                                   \
         MRM(0x07,       0x03, 0x00)                                         \
@@ -497,8 +498,49 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##64_1K4 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_1K4))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+/* mov (D = S), predicated */
+
+#define mxvqx_rr(XD, PS, XS)                                                \
+        EPW(REG(PS), 0,       RXB(XD), RXB(XS), 0x00, K,1,1) EMITB(0x28)    \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EPW(REP(PS), 0,       RMB(XD), RMB(XS), 0x00, K,1,1) EMITB(0x28)    \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mxvqx_ld(XD, PS, MS, DS)                                            \
+    ADR EPW(REG(PS), 1,       RXB(XD), RXB(MS), 0x00, K,1,1) EMITB(0x28)    \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EPW(REP(PS), 1,       RMB(XD), RXB(MS), 0x00, K,1,1) EMITB(0x28)    \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#define mxvqx_st(XS, PS, MD, DD)                                            \
+    ADR EPW(REG(PS), 0,       RXB(XS), RXB(MD), 0x00, K,1,1) EMITB(0x29)    \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EPW(REP(PS), 0,       RMB(XS), RXB(MD), 0x00, K,1,1) EMITB(0x29)    \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
+/* sel (D = P ? T : S), predicated blend */
+
+#define selqx_rr(XD, PS, XS, XT)                                            \
+        EPW(REG(PS), 0,       RXB(XD), RXB(XT), REN(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EPW(REP(PS), 0,       RMB(XD), RMB(XT), REM(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define selqx_ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPW(REG(PS), 0,       RXB(XD), RXB(MT), REN(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EPW(REP(PS), 0,       RMB(XD), RXB(MT), REM(XS), K,1,2) EMITB(0x65) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
 /******************************************************************************/
 /**********************************   SIMD   **********************************/
 /******************************************************************************/
@@ -1253,7 +1295,8 @@
 
 /* #define mk1wx_rx(RD)                    (defined in 32_1K4-bit header) */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjqx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1wx_rx(Reax)                                                      \
         REX(1,             0) EMITB(0x8B)                                   \
@@ -1264,8 +1307,12 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##64_1K4 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_1K4))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjqx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjqx_rx(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
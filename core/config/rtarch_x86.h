@@ -51,6 +51,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_fa - applies [sub] to stack to allocate section-local frame
+ * stack_fl - applies [mov] to stack to free section-local frame
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -233,6 +235,7 @@
 /* addressing   REG,  MOD,  SIB */
 
 #define Oeax    0x00, 0x00, EMPTY       /* [eax] */
+#define Meax    0x00, 0x02, EMPTY       /* [eax + DP], internal (sregs) */
 
 #define Mecx    0x01, 0x02, EMPTY       /* [ecx + DP] */
 #define Medx    0x02, 0x02, EMPTY       /* [edx + DP] */
@@ -241,6 +244,10 @@
 #define Mesi    0x06, 0x02, EMPTY       /* [esi + DP] */
 #define Medi    0x07, 0x02, EMPTY       /* [edi + DP] */
 
+/* section-local frame from ASM_ENTER_S, SP-relative (see rtarch.h) */
+
+#define Mesp    0x04, 0x02, EMITB(0x24) /* [esp + DP] */
+
 /* public scalable I/J/K/L*** definitions are now provided in rtbase.h */
 /* public scalable S/T/U/V*** definitions accept any register as index */
 /* fully explicit N*** takes index register and scale (1,2,3) for 2x/4x/8x */
@@ -287,6 +294,12 @@
 
 #define W(p1, p2, p3)       p1,  p2,  p3
 
+/* displacement pass-through advancer, used in SIMD burst ld/st */
+
+#define DN(dn, val, typ, cmd)  ((val) + (dn)), typ, EMITW((val) + (dn))
+
+#define DNCHK(dn, val, typ, cmd)  /* 32-bit displacement always fits */
+
 /******************************************************************************/
 /**********************************   BASE   **********************************/
 /******************************************************************************/
@@ -625,6 +638,27 @@
         MRM(0x02,    MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswwx_rx(RG)                                                        \
+        EMITB(0x0F) EMITB(0xC8 + REG(RG))
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rx(W(RD))
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        EMITB(0x0F) EMITB(0x38) EMITB(0xF0)                                 \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -1856,6 +1890,28 @@
 #define stack_la()   /* load all [Redi - Reax], 8 regs in total */          \
         EMITB(0x61)
 
+/* frame (allocate/free section-local stack frame, see ASM_ENTER_S)
+ * set-flags: undefined (Reax is destroyed, sz must be a multiple of 16)
+ * frame is aligned to RT_SIMD_ALIGN at Mesp, original SP is kept past sz */
+
+#define stack_fa(sz)                                                        \
+        EMITB(0x8B)                                                         \
+        MRM(0x00,       0x03, 0x04)                                         \
+        EMITB(0x81)                                                         \
+        MRM(0x05,       0x03, 0x04)                                         \
+        EMITW((sz) + 0x04)                                                  \
+        EMITB(0x81)                                                         \
+        MRM(0x04,       0x03, 0x04)                                         \
+        EMITW(-RT_SIMD_ALIGN)                                               \
+        EMITB(0x89)                                                         \
+        MRM(0x00,       0x02, 0x04)                                         \
+        AUX(EMITB(0x24), EMITW(sz), EMPTY)
+
+#define stack_fl(sz)                                                        \
+        EMITB(0x8B)                                                         \
+        MRM(0x04,       0x02, 0x04)                                         \
+        AUX(EMITB(0x24), EMITW(sz), EMPTY)
+
 /************************* 16-bit subset instructions *************************/
 
 /* mov (D = S)
@@ -2144,6 +2200,18 @@
         MRM(0x02,    MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: undefined */
+
+#define bswhx_rx(RG)                                                        \
+    ESC EMITB(0xC1)                                                         \
+        MRM(0x00,    MOD(RG), REG(RG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))
+
+#define bswhx_ld(RD, MS, DS)                                                \
+        movhx_ld(W(RD), W(MS), W(DS))                                       \
+        bswhx_rx(W(RD))
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -2814,6 +2882,21 @@
         MRM(REG(RS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvb (D = S), bridges from 8-bit to 16-bit subset
+ * set-flags: no */
+
+#define mvbhn_rr(RD, RS)      /* move  8-bit to 16-bit with sign-extend */  \
+        movbn_rr(W(RD), W(RS))
+
+#define mvbhz_rr(RD, RS)      /* move  8-bit to 16-bit with zero-extend */  \
+        movbz_rr(W(RD), W(RS))
+
+#define mvbhn_ld(RD, MS, DS)  /* load  8-bit to 16-bit with sign-extend */  \
+        movbn_ld(W(RD), W(MS), W(DS))
+
+#define mvbhz_ld(RD, MS, DS)  /* load  8-bit to 16-bit with zero-extend */  \
+        movbz_ld(W(RD), W(MS), W(DS))
+
 /* and (G = G & S)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -3948,6 +4031,24 @@
 #define fpurn_xx()       /* not portable, do not use outside */             \
         fpucw_ld(Mebp,  inf_SCR02(4))
 
+/* internal definitions for mask-to-index (mln) in SIMD byte subsets,
+ * ctowx_rx: G = count of trailing 1s in 32-bit mask G (0..32),
+ * ctowx_ld: G = G + S if G == 32 else G, S is the count of following part */
+
+#define ctowx_rx(RG)         /* not portable, do not use outside */         \
+        notwx_rx(W(RG))                                                     \
+        EMITB(0x0F) EMITB(0xBC)                                             \
+        MRM(REG(RG), MOD(RG), REG(RG))                                      \
+        ASM_BEG ASM_OP1(jnz, 9f) ASM_END                                    \
+        movwx_ri(W(RG), IB(32))                                             \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
+#define ctowx_ld(RG, MS, DS) /* not portable, do not use outside */         \
+        cmpwx_ri(W(RG), IB(32))                                             \
+        ASM_BEG ASM_OP1(jne, 9f) ASM_END                                    \
+        addwx_ld(W(RG), W(MS), W(DS))                                       \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -3983,6 +4084,39 @@
 #define CMJ(cc, lb)                                                         \
         cc(lb)
 
+/* internal definitions for fp-compare-jump (cmj), ucomiss/ucomisd report
+ * unordered (NaN) operands as ZF = PF = CF = 1, EQ_x, LT_x, LE_x jump over
+ * their jcc on PF = 1 (to local label 9 right after it), NE_x also jumps
+ * to lb on PF = 1 (only NE_x jumps on NaN as in C, same as compilers do) */
+
+#define Fjeqxx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(jp,  9f) ASM_END                                    \
+        jeqxx_lb(lb)                                                        \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
+#define Fjnexx_lb(lb)                                                       \
+        jnexx_lb(lb)                                                        \
+        ASM_BEG ASM_OP1(jp,  lb) ASM_END
+
+#define Fjltxx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(jp,  9f) ASM_END                                    \
+        jltxx_lb(lb)                                                        \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
+#define Fjlexx_lb(lb)                                                       \
+        ASM_BEG ASM_OP1(jp,  9f) ASM_END                                    \
+        jlexx_lb(lb)                                                        \
+        ASM_BEG ASM_OP0(9:) ASM_END
+
+#define Fjgtxx_lb(lb)                                                       \
+        jgtxx_lb(lb)
+
+#define Fjgexx_lb(lb)                                                       \
+        jgexx_lb(lb)
+
+#define CMF(cc, lb)                                                         \
+        F##cc(lb)
+
 #endif /* RT_RTARCH_X86_H */
 
 /******************************************************************************/
@@ -1093,6 +1093,14 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        EMITB(0x0F) EMITB(0x50)                                             \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 #if (RT_128X1 < 2)
@@ -2844,6 +2852,19 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvugx_ld(XD, MS, DS)                                                \
+        EMITB(0x0F) EMITB(0x10)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvugx_st(XS, MD, DD)                                                \
+        EMITB(0x0F) EMITB(0x11)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -4029,6 +4050,23 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_128))                     \
         jeqxx_lb(lb)
 
+#define mkjgx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movgx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Rebp)                                                      \
+        EMITB(0x0F) EMITB(0x50)                                             \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        shlix_ri(W(XS), IB(16))                                             \
+        EMITB(0x0F) EMITB(0x50)                                             \
+        MRM(0x05,    MOD(XS), REG(XS))                                      \
+        EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##16_128 & 0x1) << 1)))  \
+        MRM(0x00,       0x03, 0x05)                                         \
+        stack_ld(Rebp)                                                      \
+        movgx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_128))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -5129,6 +5167,32 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_128))                     \
         jeqxx_lb(lb)
 
+#define mkjgb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movgx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Rebp)                                                      \
+        EMITB(0x0F) EMITB(0x50)                                             \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        shlix_ri(W(XS), IB(8))                                              \
+        bsnix_rx(W(XS), mask)                                               \
+        shlix_ri(W(XS), IB(8))                                              \
+        bsnix_rx(W(XS), mask)                                               \
+        shlix_ri(W(XS), IB(8))                                              \
+        bsnix_rx(W(XS), mask)                                               \
+        stack_ld(Rebp)                                                      \
+        movgx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_128))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 16 if all elems of S are -1 */
+
+#define mlngb_rr(RD, XS)                                                    \
+    ESC EMITB(0x0F) EMITB(0xD7)                                             \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctowx_rx(W(RD))
+
 /******************************************************************************/
 /**********************************   ELEM   **********************************/
 /******************************************************************************/
@@ -5587,6 +5651,16 @@
         movrs_rr(W(XD), W(XS))                                              \
         cgers_ld(W(XD), W(MT), W(DT))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        EMITB(0x0F) EMITB(0x2E)                                             \
+        MRM(REG(XS), MOD(XT), REG(XT))                                      \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /**********************************   MODE   **********************************/
 /******************************************************************************/
@@ -5659,39 +5733,25 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movix_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm7, Oeax, PLAIN)
+        movix_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_128*4*1))                   \
+        movix_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_128*4*2))                   \
+        movix_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_128*4*3))                   \
+        movix_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_128*4*4))                   \
+        movix_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_128*4*5))                   \
+        movix_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_128*4*6))                   \
+        movix_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_128*4*7))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movix_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm7, Oeax, PLAIN)
+        movix_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_128*4*1))                   \
+        movix_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_128*4*2))                   \
+        movix_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_128*4*3))                   \
+        movix_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_128*4*4))                   \
+        movix_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_128*4*5))                   \
+        movix_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_128*4*6))                   \
+        movix_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_128*4*7))
 
 #endif /* RT_128X1 */
 
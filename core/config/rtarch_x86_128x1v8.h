@@ -933,6 +933,14 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+#define mkjix_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        V2X(0x00,    0, 0) EMITB(0x50)                                      \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_128))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1828,6 +1836,19 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvugx_ld(XD, MS, DS)                                                \
+        V2X(0x00,    0, 0) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvugx_st(XS, MD, DD)                                                \
+        V2X(0x00,    0, 0) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -2495,6 +2516,23 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_128))                     \
         jeqxx_lb(lb)
 
+#define mkjgx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movgx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Rebp)                                                      \
+        V2X(0x00,    0, 0) EMITB(0x50)                                      \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        shlix_ri(W(XS), IB(16))                                             \
+        V2X(0x00,    0, 0) EMITB(0x50)                                      \
+        MRM(0x05,    MOD(XS), REG(XS))                                      \
+        EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##16_128 & 0x1) << 1)))  \
+        MRM(0x00,       0x03, 0x05)                                         \
+        stack_ld(Rebp)                                                      \
+        movgx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_128))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -3254,6 +3292,32 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_128))                     \
         jeqxx_lb(lb)
 
+#define mkjgb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movgx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Rebp)                                                      \
+        V2X(0x00,    0, 0) EMITB(0x50)                                      \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        shlix_ri(W(XS), IB(8))                                              \
+        bsnix_rx(W(XS), mask)                                               \
+        shlix_ri(W(XS), IB(8))                                              \
+        bsnix_rx(W(XS), mask)                                               \
+        shlix_ri(W(XS), IB(8))                                              \
+        bsnix_rx(W(XS), mask)                                               \
+        stack_ld(Rebp)                                                      \
+        movgx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_128))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 16 if all elems of S are -1 */
+
+#define mlngb_rr(RD, XS)                                                    \
+        V2X(0x00,    0, 1) EMITB(0xD7)                                      \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctowx_rx(W(RD))
+
 /******************************************************************************/
 /**********************************   ELEM   **********************************/
 /******************************************************************************/
@@ -3728,6 +3792,16 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMITB(0x05))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjrs_rr(XS, XT, cc, lb)                                            \
+        V2X(0x00,    0, 0) EMITB(0x2E)                                      \
+        MRM(REG(XS), MOD(XT), REG(XT))                                      \
+        CMF(cc, lb)
+
 /******************************************************************************/
 /**********************************   MODE   **********************************/
 /******************************************************************************/
@@ -986,6 +986,14 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_256))                     \
         jeqxx_lb(lb)
 
+#define mkjcx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        V2X(0x00,    1, 0) EMITB(0x50)                                      \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_256))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -2292,6 +2300,19 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvuax_ld(XD, MS, DS)                                                \
+        V2X(0x00,    1, 0) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvuax_st(XS, MD, DD)                                                \
+        V2X(0x00,    1, 0) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -3556,6 +3577,23 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_256))                     \
         jeqxx_lb(lb)
 
+#define mkjax_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Rebp)                                                      \
+        V2X(0x00,    1, 0) EMITB(0x50)                                      \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        shlcx_ri(W(XS), IB(16))                                             \
+        V2X(0x00,    1, 0) EMITB(0x50)                                      \
+        MRM(0x05,    MOD(XS), REG(XS))                                      \
+        EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##16_256 & 0x1) << 1)))  \
+        MRM(0x00,       0x03, 0x05)                                         \
+        stack_ld(Rebp)                                                      \
+        movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_256))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -4855,6 +4893,51 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_256))                     \
         jeqxx_lb(lb)
 
+#define mkjab_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Rebp)                                                      \
+        V2X(0x00,    1, 0) EMITB(0x50)                                      \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        shlcx_ri(W(XS), IB(8))                                              \
+        bsncx_rx(W(XS), mask)                                               \
+        shlcx_ri(W(XS), IB(8))                                              \
+        bsncx_rx(W(XS), mask)                                               \
+        shlcx_ri(W(XS), IB(8))                                              \
+        bsncx_rx(W(XS), mask)                                               \
+        stack_ld(Rebp)                                                      \
+        movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_256))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 32 if all elems of S are -1 */
+
+#if (RT_256X1 < 2)
+
+#define mlnab_rr(RD, XS)                                                    \
+        movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        V2X(0x00,    0, 1) EMITB(0xD7)                                      \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        movwx_st(W(RD), Mebp, inf_SCR02(0))                                 \
+        movgx_ld(W(XS), Mebp, inf_SCR01(0x10))                              \
+        V2X(0x00,    0, 1) EMITB(0xD7)                                      \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        shlwx_ri(W(RD), IB(16))                                             \
+        orrwx_ld(W(RD), Mebp, inf_SCR02(0))                                 \
+        movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        ctowx_rx(W(RD))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+#define mlnab_rr(RD, XS)                                                    \
+        V2X(0x00,    1, 1) EMITB(0xD7)                                      \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctowx_rx(W(RD))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -4891,39 +4974,25 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         muvcx_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)
+        muvcx_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        muvcx_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        muvcx_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        muvcx_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        muvcx_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        muvcx_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        muvcx_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)
+        muvcx_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32_256*4*1))                   \
+        muvcx_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32_256*4*2))                   \
+        muvcx_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32_256*4*3))                   \
+        muvcx_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32_256*4*4))                   \
+        muvcx_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32_256*4*5))                   \
+        muvcx_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32_256*4*6))                   \
+        muvcx_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32_256*4*7))
 
 #endif /* RT_256X1 */
 
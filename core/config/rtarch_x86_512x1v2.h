@@ -1160,6 +1160,14 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_512))                     \
         jeqxx_lb(lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(Reax)                                                      \
+        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_512))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1922,6 +1930,19 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+        EVX(0x00,    K, 0, 1) EMITB(0x10)                                   \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvumx_st(XS, MD, DD)                                                \
+        EVX(0x00,    K, 0, 1) EMITB(0x11)                                   \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -3166,6 +3187,19 @@
         cmpwx_mi(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##16_512))       \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        adpax3ld(W(XS), W(XS), Mebp, inf_SCR01(0x20))                       \
+        adpax3rr(W(XS), W(XS), W(XS))                                       \
+        adpax3rr(W(XS), W(XS), W(XS))                                       \
+        adpax3rr(W(XS), W(XS), W(XS))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movmx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_mi(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##16_512))       \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 #else /* RT_512X1 >= 2 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -3451,6 +3485,14 @@
         cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##16_512))                     \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        ck1mx_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1hx_rx(Reax)                                                      \
+        cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##16_512))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
 #endif /* RT_512X1 >= 2 */
 
 /****************   packed byte-precision generic move/logic   ****************/
@@ -5062,6 +5104,47 @@
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_512))                     \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Rebp)                                                      \
+        V2X(0x00,    1, 0) EMITB(0x50)                                      \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        prmox_rx(W(XS))                                                     \
+        bsncx_rx(W(XS), mask)                                               \
+        shlox_ri(W(XS), IB(8))                                              \
+        bsncx_rx(W(XS), mask)                                               \
+        prmox_rx(W(XS))                                                     \
+        bsncx_rx(W(XS), mask)                                               \
+        shlox_ri(W(XS), IB(8))                                              \
+        bsncx_rx(W(XS), mask)                                               \
+        prmox_rx(W(XS))                                                     \
+        bsncx_rx(W(XS), mask)                                               \
+        shlox_ri(W(XS), IB(8))                                              \
+        bsncx_rx(W(XS), mask)                                               \
+        prmox_rx(W(XS))                                                     \
+        bsncx_rx(W(XS), mask)                                               \
+        stack_ld(Rebp)                                                      \
+        movmx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_512))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 64 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        prmox_rx(W(XS))                                                     \
+        V2X(0x00,    1, 1) EMITB(0xD7)                                      \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctowx_rx(W(RD))                                                     \
+        movwx_st(W(RD), Mebp, inf_SCR02(0))                                 \
+        prmox_rx(W(XS))                                                     \
+        V2X(0x00,    1, 1) EMITB(0xD7)                                      \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctowx_rx(W(RD))                                                     \
+        ctowx_ld(W(RD), Mebp, inf_SCR02(0))
+
 #else /* RT_512X1 >= 2 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -5354,6 +5437,34 @@
         cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##08_512))                     \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
+        ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
+        stack_st(Rebp)                                                      \
+        mk1hx_rx(Reax)                                                      \
+        sh1hx_xx()                                                          \
+        mk1hx_rx(Rebp)                                                      \
+        EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##08_512 & 0x1) << 1)))  \
+        MRM(0x00,       0x03, 0x05)                                         \
+        stack_ld(Rebp)                                                      \
+        cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##08_512))                     \
+        stack_ld(Reax)                                                      \
+        jeqxx_lb(lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 64 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
+        sh1hx_xx()                                                          \
+        mk1hx_rx(W(RD))                                                     \
+        ctowx_rx(W(RD))                                                     \
+        movwx_st(W(RD), Mebp, inf_SCR02(0))                                 \
+        ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1hx_rx(W(RD))                                                     \
+        ctowx_rx(W(RD))                                                     \
+        ctowx_ld(W(RD), Mebp, inf_SCR02(0))
+
 #endif /* RT_512X1 >= 2 */
 
 /******************************************************************************/
@@ -5366,21 +5477,14 @@
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_st(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
+        movox_st(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_st(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_st(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_st(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_st(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_st(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_st(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*8))                             \
         VEX(0x00, 0, 0, 1) EMITB(0x91)                                      \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_st(Redx)                                                      \
@@ -5403,21 +5507,14 @@
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
         movox_ld(Xmm0, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
-        addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
+        movox_ld(Xmm1, Meax, DP(RT_SIMD_WIDTH32*4*1))                       \
+        movox_ld(Xmm2, Meax, DP(RT_SIMD_WIDTH32*4*2))                       \
+        movox_ld(Xmm3, Meax, DP(RT_SIMD_WIDTH32*4*3))                       \
+        movox_ld(Xmm4, Meax, DP(RT_SIMD_WIDTH32*4*4))                       \
+        movox_ld(Xmm5, Meax, DP(RT_SIMD_WIDTH32*4*5))                       \
+        movox_ld(Xmm6, Meax, DP(RT_SIMD_WIDTH32*4*6))                       \
+        movox_ld(Xmm7, Meax, DP(RT_SIMD_WIDTH32*4*7))                       \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4*8))                             \
         VEX(0x00, 0, 0, 1) EMITB(0x90)                                      \
         MRM(0x01,       0x00,    0x00)                                      \
         stack_st(Redx)                                                      \
@@ -143,6 +143,19 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvugx_ld(XD, MS, DS)                                                \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvugx_st(XS, MD, DD)                                                \
+    ADR REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -588,6 +601,34 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE1)                       \
         stack_ld(Recx)                                                      \
         movgx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * SSE4: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * SSE2: rotate 16-bit elements by 8 bits with shifts,
+ * uses SCR02 to keep S and SCR01 to hold (S << 8) */
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define bswgx_rr(XD, XS)                                                    \
+        movgx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shlgx3ri(W(XD), W(XS), IB(8))                                       \
+        movgx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movgx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrgx_ri(W(XD), IB(8))                                              \
+        orrgx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswgx_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x02030001), IW(0x06070405),                            \
+                 IW(0x0A0B0809), IW(0x0E0F0C0D))                            \
+        shbix3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 #if (RT_SIMD_COMPAT_SSE < 4)
@@ -971,7 +1012,8 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x65)                       \
 #define RT_SIMD_MASK_NONE16_128    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_128    0x0F     /*  all satisfy the condition */
 
-#define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movgx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         REX(0,       RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -983,8 +1025,12 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x65)                       \
         MRM(0x00,       0x03, 0x07)                                         \
         movgx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_128))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjgx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -1952,7 +1998,8 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x64)                       \
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##08_128 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)
 
-#define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjgb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movgx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         REX(0,       RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -1964,8 +2011,20 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x64)                       \
         bsnix_rx(W(XS), mask)                                               \
         movgx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_128))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjgb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 16 if all elems of S are -1 */
+
+#define mlngb_rr(RD, XS)                                                    \
+    ESC REX(RXB(RD), RXB(XS)) EMITB(0x0F) EMITB(0xD7)                       \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctozx_rx(W(RD))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
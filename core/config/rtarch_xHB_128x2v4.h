@@ -151,6 +151,25 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvuax_ld(XD, MS, DS)                                                \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#define mvuax_st(XS, MD, DD)                                                \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -717,6 +736,34 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0xE1)                       \
         stack_ld(Recx)                                                      \
         movax_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * SSE4: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * SSE2: rotate 16-bit elements by 8 bits with shifts,
+ * uses SCR02 to keep S and SCR01 to hold (S << 8) */
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define bswax_rr(XD, XS)                                                    \
+        movax_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shlax3ri(W(XD), W(XS), IB(8))                                       \
+        movax_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movax_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrax_ri(W(XD), IB(8))                                              \
+        orrax_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswax_rr(XD, XS)                                                    \
+        mskix_mi(IW(0x02030001), IW(0x06070405),                            \
+                 IW(0x0A0B0809), IW(0x0E0F0C0D))                            \
+        shbcx3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 #if (RT_SIMD_COMPAT_SSE < 4)
@@ -1194,7 +1241,8 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x65)                       \
 #define RT_SIMD_MASK_NONE16_256    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_256    0x0F     /*  all satisfy the condition */
 
-#define mkjax_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjax_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
         REX(0,             0) EMITB(0x0F) EMITB(0x50)                       \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -1216,8 +1264,12 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x65)                       \
         MRM(0x00,       0x03, 0x07)                                         \
         movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_256))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjax_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjax_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -2570,7 +2622,8 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x64)                       \
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##08_256 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)
 
-#define mkjab_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjab_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
         REX(0,             0) EMITB(0x0F) EMITB(0x50)                       \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -2587,8 +2640,24 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x64)                       \
         bsncx_rx(W(XS), mask)                                               \
         movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_256))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjab_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjab_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 32 if all elems of S are -1 */
+
+#define mlnab_rr(RD, XS)                                                    \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0xD7)                       \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+    ESC REX(RXB(RD),       0) EMITB(0x0F) EMITB(0xD7)                       \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        shlwx_ri(RMxx, IB(16))                                              \
+        orrwx_rr(W(RD), RMxx)                                               \
+        ctozx_rx(W(RD))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -143,6 +143,19 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvuax_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvuax_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -982,6 +995,33 @@
         stack_ld(Recx)                                                      \
         movax_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * AVX2: pshufb with byte-reverse mask written to SCR02 by imm stores,
+ * AVX1: byte-swaps 128-bit halves with bswgx_ld, uses SCR01 as scratch */
+
+#if (RT_256X1 < 2)
+
+#define bswax_rr(XD, XS)                                                    \
+        movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        bswgx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movgx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        bswgx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movgx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movax_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+#define bswax_rr(XD, XS)                                                    \
+        mskcx_mi(IW(0x02030001), IW(0x06070405),                            \
+                 IW(0x0A0B0809), IW(0x0E0F0C0D))                            \
+        shbcx3ld(W(XD), W(XS), Mebp, inf_SCR02(0))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 #if (RT_256X1 < 2)
@@ -1392,7 +1432,8 @@
 #define RT_SIMD_MASK_NONE16_256    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_256    0xFF     /*  all satisfy the condition */
 
-#define mkjax_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjax_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
         VEX(0,       RXB(XS),    0x00, 1, 0, 1) EMITB(0x50)                 \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -1404,8 +1445,12 @@
         MRM(0x00,       0x03, 0x07)                                         \
         movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_256))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjax_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjax_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -2690,7 +2735,8 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##08_256 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)
 
-#define mkjab_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjab_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
         VEX(0,       RXB(XS),    0x00, 1, 0, 1) EMITB(0x50)                 \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -2702,8 +2748,40 @@
         bsncx_rx(W(XS), mask)                                               \
         movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_256))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjab_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjab_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 32 if all elems of S are -1 */
+
+#if (RT_256X1 < 2)
+
+#define mlnab_rr(RD, XS)                                                    \
+        VEX(RXB(RD), RXB(XS),    0x00, 0, 1, 1) EMITB(0xD7)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        VEX(RXB(XS), RXB(XS),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(1,       RXB(XS),    0x00, 0, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        movax_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        shlwx_ri(RMxx, IB(16))                                              \
+        orrwx_rr(W(RD), RMxx)                                               \
+        ctozx_rx(W(RD))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+#define mlnab_rr(RD, XS)                                                    \
+        VEX(RXB(RD), RXB(XS),    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctozx_rx(W(RD))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -151,6 +151,25 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+    ADR VEX(0,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VXL(DS)), EMPTY)
+
+#define mvumx_st(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1733,7 +1752,8 @@
 #define RT_SIMD_MASK_NONE16_512    0x00     /* none satisfy the condition */
 #define RT_SIMD_MASK_FULL16_512    0xFF     /*  all satisfy the condition */
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x50)                 \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -1755,8 +1775,12 @@
         MRM(0x00,       0x03, 0x07)                                         \
         movmx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##16_512))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 /****************   packed byte-precision generic move/logic   ****************/
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
@@ -3562,7 +3586,8 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##08_512 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x50)                 \
         MRM(0x00,    MOD(XS), REG(XS))                                      \
@@ -3579,8 +3604,53 @@
         bsnox_rx(W(XS), mask)                                               \
         movmx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_512))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 64 if all elems of S are -1 */
+
+#if (RT_256X2 < 2)
+
+#define mlnmb_rr(RD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        VEX(1,             0,    0x00, 0, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        movgx_ld(W(XS), Mebp, inf_SCR01(0x10))                              \
+        VEX(RXB(RD),       0,    0x00, 0, 1, 1) EMITB(0xD7)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        shlwx_ri(W(RD), IB(16))                                             \
+        orrwx_rr(RMxx, W(RD))                                               \
+        ctozx_rx(RMxx)                                                      \
+        stack_st(RMxx)                                                      \
+        VEX(RXB(RD),       1,    0x00, 0, 1, 1) EMITB(0xD7)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        movgx_ld(W(XS), Mebp, inf_SCR01(0x30))                              \
+        VEX(1,             0,    0x00, 0, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        shlwx_ri(RMxx, IB(16))                                              \
+        orrwx_rr(W(RD), RMxx)                                               \
+        ctozx_rx(W(RD))                                                     \
+        stack_ld(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        movmx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#else /* RT_256X2 >= 2, AVX2 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        ctozx_rx(RMxx)                                                      \
+        VEX(RXB(RD),       1,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        ctozx_rx(W(RD))                                                     \
+        ctozx_rr(W(RD), RMxx)
+
+#endif /* RT_256X2 >= 2, AVX2 */
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
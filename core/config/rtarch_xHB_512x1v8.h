@@ -185,6 +185,19 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvumx_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1414,11 +1427,12 @@
         MRM(REG(XD), MOD(XT), REG(XT))
 
 #define adpax3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
-        VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x01)                 \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x01)                 \
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         adpax3ld(W(XS), W(XS), Mebp, inf_SCR01(0x20))                       \
         adpax3rr(W(XS), W(XS), W(XS))                                       \
@@ -1427,8 +1441,12 @@
         movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
         movmx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_mi(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##16_512))       \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 #else /* RT_512X1 == 2, 8 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1708,12 +1726,15 @@
         VEX(RXB(RD),       0,    0x00, 0, 3, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         ck1mx_rm(W(XS), Mebp, inf_GPC07)                                    \
-        mk1hx_rx(Reax)                                                      \
-        cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##16_512))                     \
+        mk1hx_rx(RMxx)                                                      \
+        cmpwx_ri(RMxx, IW(RT_SIMD_MASK_##mask##16_512))                     \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 #endif /* RT_512X1 == 2, 8 */
 
 /****************   packed byte-precision generic move/logic   ****************/
@@ -3301,7 +3322,8 @@
 
 /* #define bsncx_rx(XS, mask)              (defined in HB_256-bit header) */
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movmx_st(Xmm0, Mebp, inf_SCR01(0))                                  \
         movmx_rr(Xmm0, W(XS))                                               \
         VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x50)                 \
@@ -3322,8 +3344,28 @@
         bsncx_rx(Xmm0, mask)                                                \
         movmx_ld(Xmm0, Mebp, inf_SCR01(0))                                  \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_512))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 64 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        movmx_st(Xmm0, Mebp, inf_SCR01(0))                                  \
+        movmx_rr(Xmm0, W(XS))                                               \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,       0x03,    0x00)                                      \
+        ctozx_rx(RMxx)                                                      \
+        prmox_rx(Xmm0)                                                      \
+        VEX(RXB(RD),       0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(REG(RD),    0x03,    0x00)                                      \
+        ctozx_rx(W(RD))                                                     \
+        ctozx_rr(W(RD), RMxx)                                               \
+        movmx_ld(Xmm0, Mebp, inf_SCR01(0))
+
 #else /* RT_512X1 == 2, 8 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -3603,14 +3645,31 @@
         VEW(RXB(RD),       0,    0x00, 0, 3, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1bx_rx(Reax)                                                      \
         movzx_mj(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##08_512),       \
                                      IW(RT_SIMD_MASK_##mask##08_512))       \
         cmpzx_rm(Reax, Mebp, inf_SCR02(0))                                  \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 64 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1bx_rx(W(RD))                                                     \
+        movwx_rr(RMxx, W(RD))                                               \
+        ctozx_rx(RMxx)                                                      \
+        shrzx_ri(W(RD), IB(32))                                             \
+        ctozx_rx(W(RD))                                                     \
+        ctozx_rr(W(RD), RMxx)
+
 #endif /* RT_512X1 == 2, 8 */
 
 /******************************************************************************/
@@ -193,6 +193,25 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#define mvumx_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(RMB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1827,11 +1846,12 @@
         MRM(REG(XD), MOD(XT), REG(XT))
 
 #define adpax3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
-        VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x01)                 \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x01)                 \
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         adpax3ld(W(XS), W(XS), Mebp, inf_SCR01(0x20))                       \
         movax_st(W(XS), Mebp, inf_SCR02(0x00))                              \
@@ -1844,8 +1864,12 @@
         movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
         movmx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_mi(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##16_1K4))       \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 #else /* RT_512X2 >= 2 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -2225,7 +2249,8 @@
         VEX(RXB(RD),       0,    0x00, 0, 3, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         ck1mx_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1hx_rx(Reax)                                                      \
         REX(1,             0) EMITB(0x8B)                                   \
@@ -2236,8 +2261,12 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##16_1K4 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##16_1K4))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 #endif /* RT_512X2 >= 2 */
 
 /****************   packed byte-precision generic move/logic   ****************/
@@ -4728,7 +4757,8 @@
 
 /* #define bsncx_rx(XS, mask)              (defined in HB_256-bit header) */
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movov_st(Xmm0, Mebp, inf_SCR01(0x00))                               \
         movov_st(Xmm1, Mebp, inf_SCR01(0x40))                               \
         movov_rr(Xmm0, W(XS))                                               \
@@ -4767,8 +4797,41 @@
         movov_ld(Xmm0, Mebp, inf_SCR01(0x00))                               \
         movov_ld(Xmm1, Mebp, inf_SCR01(0x40))                               \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_1K4))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 128 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        movov_st(Xmm0, Mebp, inf_SCR01(0x00))                               \
+        movov_st(W(XS), Mebp, inf_SCR01(0x40))                              \
+        movov_rr(Xmm0, X(XS))                                               \
+        prmov_rx(Xmm0)                                                      \
+        VEX(RXB(RD),       0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(REG(RD),    0x03,    0x00)                                      \
+        ctozx_rx(W(RD))                                                     \
+        prmov_rx(Xmm0)                                                      \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,       0x03,    0x00)                                      \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        movov_ld(Xmm0, Mebp, inf_SCR01(0x40))                               \
+        prmov_rx(Xmm0)                                                      \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,       0x03,    0x00)                                      \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        prmov_rx(Xmm0)                                                      \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,       0x03,    0x00)                                      \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        movov_ld(Xmm0, Mebp, inf_SCR01(0x00))
+
 #else /* RT_512X2 >= 2 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -5148,7 +5211,8 @@
         VEW(RXB(RD),       0,    0x00, 0, 3, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1bx_rx(Reax)                                                      \
         REW(1,             0) EMITB(0x8B)                                   \
@@ -5161,8 +5225,34 @@
         movzx_mj(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##08_1K4),       \
                                      IW(RT_SIMD_MASK_##mask##08_1K4))       \
         cmpzx_rm(Reax, Mebp, inf_SCR02(0))                                  \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 128 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        ck1mb_rm(X(XS), Mebp, inf_GPC07)                                    \
+        mk1bx_rx(W(RD))                                                     \
+        shrzx_ri(W(RD), IB(32))                                             \
+        ctozx_rx(W(RD))                                                     \
+        mk1bx_rx(RMxx)                                                      \
+        movwx_rr(RMxx, RMxx)                                                \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1bx_rx(RMxx)                                                      \
+        shrzx_ri(RMxx, IB(32))                                              \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        mk1bx_rx(RMxx)                                                      \
+        movwx_rr(RMxx, RMxx)                                                \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)
+
 #endif /* RT_512X2 >= 2 */
 
 /******************************************************************************/
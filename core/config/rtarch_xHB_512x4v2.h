@@ -209,6 +209,37 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VTL(DD)), EMPTY)
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+    ADR EVX(0,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVX(1,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)                                 \
+    ADR EVX(2,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VSL(DS)), EMPTY)                                 \
+    ADR EVX(3,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VTL(DS)), EMPTY)
+
+#define mvumx_st(XS, MD, DD)                                                \
+    ADR EVX(0,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(1,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)                                 \
+    ADR EVX(2,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VSL(DD)), EMPTY)                                 \
+    ADR EVX(3,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VTL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -2653,11 +2684,12 @@
         MRM(REG(XD), MOD(XT), REG(XT))
 
 #define adpax3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
-        VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x01)                 \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x01)                 \
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         adpax3ld(W(XS), W(XS), Mebp, inf_SCR01(0x20))                       \
         movax_st(W(XS), Mebp, inf_SCR02(0x00))                              \
@@ -2678,8 +2710,12 @@
         movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
         movmx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         cmpwx_mi(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##16_2K8))       \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 #else /* RT_512X4 >= 2 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -3259,7 +3295,8 @@
         VEX(RXB(RD),       0,    0x00, 0, 3, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         ck1mx_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1hx_rx(Reax)                                                      \
         REX(1,             0) EMITB(0x8B)                                   \
@@ -3280,8 +3317,12 @@
         EMITB(0x03 | (0x08 << ((RT_SIMD_MASK_##mask##16_2K8 & 0x1) << 1)))  \
         MRM(0x00,       0x03, 0x07)                                         \
         cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##16_2K8))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmx_rx(W(XS), mask, lb)
+
 #endif /* RT_512X4 >= 2 */
 
 /****************   packed byte-precision generic move/logic   ****************/
@@ -7534,7 +7575,8 @@
 
 /* #define bsncx_rx(XS, mask)              (defined in HB_256-bit header) */
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         movov_st(Xmm0, Mebp, inf_SCR01(0x00))                               \
         movov_st(Xmm1, Mebp, inf_SCR01(0x40))                               \
         movov_st(Xmm2, Mebp, inf_SCR01(0x80))                               \
@@ -7609,8 +7651,41 @@
         movov_ld(Xmm2, Mebp, inf_SCR01(0x80))                               \
         movov_ld(Xmm3, Mebp, inf_SCR01(0xC0))                               \
         cmpwx_ri(Reax, IB(RT_SIMD_MASK_##mask##08_2K8))                     \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 256 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        movov_st(Xmm0, Mebp, inf_SCR01(0x00))                               \
+        movov_st(W(XS), Mebp, inf_SCR01(0x40))                              \
+        movwx_ri(W(RD), IB(0))                                              \
+        movov_rr(Xmm0, Z(XS))                                               \
+        ml1mb_rx(W(RD))                                                     \
+        movov_rr(Xmm0, X(XS))                                               \
+        ml1mb_rx(W(RD))                                                     \
+        movov_rr(Xmm0, V(XS))                                               \
+        ml1mb_rx(W(RD))                                                     \
+        movov_ld(Xmm0, Mebp, inf_SCR01(0x40))                               \
+        ml1mb_rx(W(RD))                                                     \
+        movov_ld(Xmm0, Mebp, inf_SCR01(0x00))
+
+#define ml1mb_rx(RD)         /* not portable, do not use outside */         \
+        prmov_rx(Xmm0)                                                      \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,       0x03,    0x00)                                      \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        prmov_rx(Xmm0)                                                      \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0xD7)                 \
+        MRM(0x07,       0x03,    0x00)                                      \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)
+
 #else /* RT_512X4 >= 2 */
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -8190,7 +8265,8 @@
         VEW(RXB(RD),       0,    0x00, 0, 3, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
+        stack_st(Reax)                                                      \
         ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1bx_rx(Reax)                                                      \
         REW(1,             0) EMITB(0x8B)                                   \
@@ -8213,8 +8289,33 @@
         movzx_mj(Mebp, inf_SCR02(0), IW(RT_SIMD_MASK_##mask##08_2K8),       \
                                      IW(RT_SIMD_MASK_##mask##08_2K8))       \
         cmpzx_rm(Reax, Mebp, inf_SCR02(0))                                  \
+        stack_ld(Reax)                                                      \
         jeqxx_lb(lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjmb_rx(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = 256 if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        movwx_ri(W(RD), IB(0))                                              \
+        ml1mb_rx(W(RD), Z(XS))                                              \
+        ml1mb_rx(W(RD), X(XS))                                              \
+        ml1mb_rx(W(RD), V(XS))                                              \
+        ml1mb_rx(W(RD), W(XS))
+
+#define ml1mb_rx(RD, XS)     /* not portable, do not use outside */         \
+        ck1mb_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1bx_rx(RMxx)                                                      \
+        shrzx_ri(RMxx, IB(32))                                              \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)                                               \
+        mk1bx_rx(RMxx)                                                      \
+        movwx_rr(RMxx, RMxx)                                                \
+        ctozx_rx(RMxx)                                                      \
+        ctozx_rr(W(RD), RMxx)
+
 #endif /* RT_512X4 >= 2 */
 
 /******************************************************************************/
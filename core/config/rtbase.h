@@ -62,6 +62,10 @@
 /**** 256-bit **** (cbr/cbe/cbs/...) with fixed-64-bit element ****************/
 /**** 128-bit **** (cbr/cbe/cbs/...) with fixed-64-bit element ****************/
 
+/**** var-len **** (bsw) with fixed-16/32/64-bit element **********************/
+/**** 256-bit **** (bsw) with fixed-16/32/64-bit element **********************/
+/**** 128-bit **** (bsw) with fixed-16/32/64-bit element **********************/
+
 /**** var-len **** (horizontal SIMD) with fixed-32-bit element ****************/
 /**** 2K8-bit **** (vertical-int-div/rem SIMD) with fixed-32-bit element ******/
 /**** 1K4-bit **** (vertical-int-div/rem SIMD) with fixed-32-bit element ******/
@@ -80,9 +84,14 @@
 /**** 128-bit **** (horizontal SIMD) with fixed-64-bit element ****************/
 /**** 128-bit **** (vertical-int-div/rem SIMD) with fixed-64-bit element ******/
 
+/**** scalar ***** (fp-to-int/int-to-fp) with fixed-32-bit element ************/
+/**** scalar ***** (fp-to-int/int-to-fp) with fixed-64-bit element ************/
+
 /************************   COMMON BASE INSTRUCTIONS   ************************/
 
 /***************** original forms of one-operand instructions *****************/
+/**************** tile walkers (2D blocks with runtime pitch) *****************/
+/**************** jump tables (computed dispatch by index) ********************/
 
 /*********************************   CONFIG   *********************************/
 
@@ -193,6 +202,29 @@
 #define DV(dp) _DV(dp)
 #endif /* O: 16, 8, 4, 2, 1 */
 
+/*
+ * Displacement windows (base-register rebasing) for large data structures.
+ * On ARM/MIPS/POWER displacements past native range (DP at a given RT_DATA
+ * level, or DE/DF/DG/DH/DV) are materialized on every access, which costs
+ * 2-3 extra instructions per load/store. When a group of such fields is used
+ * repeatedly, load a secondary base register once with window's origin
+ *     adrxx_ld(Resi, Mebp, DH(org))
+ * and then address fields inside the window relative to that origin
+ *     movxx_ld(Reax, Mesi, DW(org, dp))
+ * where dp is the field's absolute offset within the structure (same as
+ * would be passed to DH/DV) and (dp - org) fits native DP range for Q and
+ * RT_DATA in use. Both org and dp should be multiples of the access size.
+ * Debug builds (RT_DEBUG >= 1) check that (dp - org) is within DP range:
+ * a window out of range makes the assembler report a division by zero
+ * (a warning in GNU as, turned into an error by -Wa,--fatal-warnings).
+ */
+#if RT_DEBUG >= 1
+#define DW(org, dp) DP(((dp)-(org)) / (((dp)-(org) >= 0) &&                \
+                                       ((dp)-(org) < 0x1000*O)))
+#else  /* RT_DEBUG == 0 */
+#define DW(org, dp) DP((dp)-(org))
+#endif /* RT_DEBUG */
+
 /*
  * Map existing scalable addressing modes to a fully customizable ones.
  */
@@ -960,6 +992,11 @@ struct rt_SIMD_INFO
     rt_ui32 fctrl[R-3];     /* reserved, do not use! */
 #define inf_FCTRL(nx)       DP(0x00C + nx)
 
+    /* fctrl[] holds MXCSR images for FCTRL blocks on x86 targets only,
+     * on AArch64 256-bit NEON pairs with RT_SIMD_COMPAT_XMM=0 its 16 bytes
+     * at 0x010 (present if Q >= 2) are reserved for temps spilled by STT/LDT,
+     * layout is checked in rtarch_a32_128x1v1.h, keep gpc01_32 at Q*0x010 */
+
     /* general purpose constants (32-bit) */
 
     rt_fp32 gpc01_32[R];    /* +1.0f */
@@ -1797,6 +1834,184 @@ rt_si32 from_mask(rt_si32 mask)
         muljs_rr(W(X2), W(X1))                                              \
         subjs_rr(W(XG), W(X2))
 
+/******************************************************************************/
+/**** var-len **** (bsw) with fixed-16/32/64-bit element **********************/
+/******************************************************************************/
+
+#if (RT_SIMD >= 512) && (defined RT_X32 || defined RT_X64 || defined RT_X86)
+
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * RISC targets and x86 128/256-bit subsets map it to native byte-reverse
+ * or byte-shuffle ops in their backends, x86 var-len subsets swap element
+ * halves with shift/xor steps through SCR02 (emulated shifts clobber SCR01) */
+
+#define bswmx_rr(XD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shlmx3ri(W(XD), W(XS), IB(8))                                       \
+        xormx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movmx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrmx_ri(W(XD), IB(8))                                              \
+        xormx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movmx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlmx_ri(W(XD), IB(8))                                              \
+        xormx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        bswmx_rr(W(XD), W(XD))
+
+#define bswox_rr(XD, XS)                                                    \
+        bswmx_rr(W(XD), W(XS))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlox_ri(W(XD), IB(16))                                             \
+        xorox_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrox_ri(W(XD), IB(16))                                             \
+        xorox_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlox_ri(W(XD), IB(16))                                             \
+        xorox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        bswox_rr(W(XD), W(XD))
+
+#define bswqx_rr(XD, XS)                                                    \
+        bswox_rr(W(XD), W(XS))                                              \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlqx_ri(W(XD), IB(32))                                             \
+        xorqx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrqx_ri(W(XD), IB(32))                                             \
+        xorqx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlqx_ri(W(XD), IB(32))                                             \
+        xorqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        bswqx_rr(W(XD), W(XD))
+
+#endif /* RT_X32, RT_X64, RT_X86 */
+
+/******************************************************************************/
+/**** 256-bit **** (bsw) with fixed-16/32/64-bit element **********************/
+/******************************************************************************/
+
+#if (defined RT_X86)
+
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * x32/x64 targets map it to native byte-shuffle ops in their backends,
+ * legacy x86 swaps element halves with shift/xor steps through SCR02 */
+
+#define bswax_rr(XD, XS)                                                    \
+        movax_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shlax3ri(W(XD), W(XS), IB(8))                                       \
+        xorax_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movax_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrax_ri(W(XD), IB(8))                                              \
+        xorax_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movax_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlax_ri(W(XD), IB(8))                                              \
+        xorax_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax_rr(W(XD), W(XD))
+
+#define bswcx_rr(XD, XS)                                                    \
+        bswax_rr(W(XD), W(XS))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlcx_ri(W(XD), IB(16))                                             \
+        xorcx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrcx_ri(W(XD), IB(16))                                             \
+        xorcx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlcx_ri(W(XD), IB(16))                                             \
+        xorcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
+#define bswdx_rr(XD, XS)                                                    \
+        bswcx_rr(W(XD), W(XS))                                              \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shldx_ri(W(XD), IB(32))                                             \
+        xordx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrdx_ri(W(XD), IB(32))                                             \
+        xordx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shldx_ri(W(XD), IB(32))                                             \
+        xordx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
+
+#endif /* RT_X86 */
+
+/******************************************************************************/
+/**** 128-bit **** (bsw) with fixed-16/32/64-bit element **********************/
+/******************************************************************************/
+
+#if (defined RT_X86)
+
+/* bsw (D = byte-swap S), reverse byte order within each element
+ * x32/x64 targets map it to native byte-shuffle ops in their backends,
+ * legacy x86 swaps element halves with shift/xor steps through SCR02 */
+
+#define bswgx_rr(XD, XS)                                                    \
+        movgx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shlgx3ri(W(XD), W(XS), IB(8))                                       \
+        xorgx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movgx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrgx_ri(W(XD), IB(8))                                              \
+        xorgx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movgx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlgx_ri(W(XD), IB(8))                                              \
+        xorgx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
+
+#define bswix_rr(XD, XS)                                                    \
+        bswgx_rr(W(XD), W(XS))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlix_ri(W(XD), IB(16))                                             \
+        xorix_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrix_ri(W(XD), IB(16))                                             \
+        xorix_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shlix_ri(W(XD), IB(16))                                             \
+        xorix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
+#define bswjx_rr(XD, XS)                                                    \
+        bswix_rr(W(XD), W(XS))                                              \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shljx_ri(W(XD), IB(32))                                             \
+        xorjx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shrjx_ri(W(XD), IB(32))                                             \
+        xorjx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shljx_ri(W(XD), IB(32))                                             \
+        xorjx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
+#endif /* RT_X86 */
+
 /******************************************************************************/
 /**** var-len **** (horizontal SIMD) with fixed-32-bit element ****************/
 /******************************************************************************/
@@ -10273,6 +10488,335 @@ rt_si32 from_mask(rt_si32 mask)
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
+/******************************************************************************/
+/**** scalar ***** (fp-to-int/int-to-fp) with fixed-32-bit element ************/
+/******************************************************************************/
+
+/*
+ * Scalar converters apply to the 1st element of SIMD registers (ELEM subset)
+ * and are mapped to 128-bit packed converters on targets where scalars share
+ * the 1st element with vectors, so scalar tails and reductions are converted
+ * without leaving the SIMD register file. Other elements of the destination
+ * are left undefined. POWER keeps scalars detached from vectors (FPRs), thus
+ * its scalars are bridged via the SIMD scratch area (inf_SCR01) instead.
+ */
+
+#if (defined RT_P32) || (defined RT_P64)
+
+#define cvsrs_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        op(W(XD), W(XD))                                                    \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movrs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define cvkrs_rx(XD, XS, op, mode) /* not portable, do not use outside */   \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        op(W(XD), W(XD), mode)                                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movrs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_P32, RT_P64 */
+
+#define cvsrs_rx(XD, XS, op) /* not portable, do not use outside */         \
+        op(W(XD), W(XS))
+
+#define cvkrs_rx(XD, XS, op, mode) /* not portable, do not use outside */   \
+        op(W(XD), W(XS), mode)
+
+#endif /* RT_P32, RT_P64 */
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnzrs_rr(XD, XS)     /* round towards zero */                       \
+        cvsrs_rx(W(XD), W(XS), rnzis_rr)
+
+#define rnzrs_ld(XD, MS, DS) /* round towards zero */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        rnzrs_rr(W(XD), W(XD))
+
+#define cvzrs_rr(XD, XS)     /* round towards zero */                       \
+        cvsrs_rx(W(XD), W(XS), cvzis_rr)
+
+#define cvzrs_ld(XD, MS, DS) /* round towards zero */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        cvzrs_rr(W(XD), W(XD))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnprs_rr(XD, XS)     /* round towards +inf */                       \
+        cvsrs_rx(W(XD), W(XS), rnpis_rr)
+
+#define rnprs_ld(XD, MS, DS) /* round towards +inf */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        rnprs_rr(W(XD), W(XD))
+
+#define cvprs_rr(XD, XS)     /* round towards +inf */                       \
+        cvsrs_rx(W(XD), W(XS), cvpis_rr)
+
+#define cvprs_ld(XD, MS, DS) /* round towards +inf */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        cvprs_rr(W(XD), W(XD))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnmrs_rr(XD, XS)     /* round towards -inf */                       \
+        cvsrs_rx(W(XD), W(XS), rnmis_rr)
+
+#define rnmrs_ld(XD, MS, DS) /* round towards -inf */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        rnmrs_rr(W(XD), W(XD))
+
+#define cvmrs_rr(XD, XS)     /* round towards -inf */                       \
+        cvsrs_rx(W(XD), W(XS), cvmis_rr)
+
+#define cvmrs_ld(XD, MS, DS) /* round towards -inf */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        cvmrs_rr(W(XD), W(XD))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnnrs_rr(XD, XS)     /* round towards near */                       \
+        cvsrs_rx(W(XD), W(XS), rnnis_rr)
+
+#define rnnrs_ld(XD, MS, DS) /* round towards near */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        rnnrs_rr(W(XD), W(XD))
+
+#define cvnrs_rr(XD, XS)     /* round towards near */                       \
+        cvsrs_rx(W(XD), W(XS), cvnis_rr)
+
+#define cvnrs_ld(XD, MS, DS) /* round towards near */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        cvnrs_rr(W(XD), W(XD))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX POWER systems, use cvz
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rndrs_rr(XD, XS)                                                    \
+        cvsrs_rx(W(XD), W(XS), rndis_rr)
+
+#define rndrs_ld(XD, MS, DS)                                                \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        rndrs_rr(W(XD), W(XD))
+
+#define cvtrs_rr(XD, XS)                                                    \
+        cvsrs_rx(W(XD), W(XS), cvtis_rr)
+
+#define cvtrs_ld(XD, MS, DS)                                                \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        cvtrs_rr(W(XD), W(XD))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnrrs_rr(XD, XS, mode)                                              \
+        cvkrs_rx(W(XD), W(XS), rnris_rr, mode)
+
+#define cvrrs_rr(XD, XS, mode)                                              \
+        cvkrs_rx(W(XD), W(XS), cvris_rr, mode)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnrn_rr(XD, XS)     /* round towards near */                       \
+        cvsrs_rx(W(XD), W(XS), cvnin_rr)
+
+#define cvnrn_ld(XD, MS, DS) /* round towards near */                       \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        cvnrn_rr(W(XD), W(XD))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX POWER systems */
+
+#define cvtrn_rr(XD, XS)                                                    \
+        cvsrs_rx(W(XD), W(XS), cvtin_rr)
+
+#define cvtrn_ld(XD, MS, DS)                                                \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        cvtrn_rr(W(XD), W(XD))
+
+/******************************************************************************/
+/**** scalar ***** (fp-to-int/int-to-fp) with fixed-64-bit element ************/
+/******************************************************************************/
+
+#if (defined RT_P32) || (defined RT_P64)
+
+#define cvsts_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        op(W(XD), W(XD))                                                    \
+        movjx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movts_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define cvkts_rx(XD, XS, op, mode) /* not portable, do not use outside */   \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        op(W(XD), W(XD), mode)                                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movts_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_P32, RT_P64 */
+
+#define cvsts_rx(XD, XS, op) /* not portable, do not use outside */         \
+        op(W(XD), W(XS))
+
+#define cvkts_rx(XD, XS, op, mode) /* not portable, do not use outside */   \
+        op(W(XD), W(XS), mode)
+
+#endif /* RT_P32, RT_P64 */
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnzts_rr(XD, XS)     /* round towards zero */                       \
+        cvsts_rx(W(XD), W(XS), rnzjs_rr)
+
+#define rnzts_ld(XD, MS, DS) /* round towards zero */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        rnzts_rr(W(XD), W(XD))
+
+#define cvzts_rr(XD, XS)     /* round towards zero */                       \
+        cvsts_rx(W(XD), W(XS), cvzjs_rr)
+
+#define cvzts_ld(XD, MS, DS) /* round towards zero */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        cvzts_rr(W(XD), W(XD))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnpts_rr(XD, XS)     /* round towards +inf */                       \
+        cvsts_rx(W(XD), W(XS), rnpjs_rr)
+
+#define rnpts_ld(XD, MS, DS) /* round towards +inf */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        rnpts_rr(W(XD), W(XD))
+
+#define cvpts_rr(XD, XS)     /* round towards +inf */                       \
+        cvsts_rx(W(XD), W(XS), cvpjs_rr)
+
+#define cvpts_ld(XD, MS, DS) /* round towards +inf */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        cvpts_rr(W(XD), W(XD))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnmts_rr(XD, XS)     /* round towards -inf */                       \
+        cvsts_rx(W(XD), W(XS), rnmjs_rr)
+
+#define rnmts_ld(XD, MS, DS) /* round towards -inf */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        rnmts_rr(W(XD), W(XD))
+
+#define cvmts_rr(XD, XS)     /* round towards -inf */                       \
+        cvsts_rx(W(XD), W(XS), cvmjs_rr)
+
+#define cvmts_ld(XD, MS, DS) /* round towards -inf */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        cvmts_rr(W(XD), W(XD))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnnts_rr(XD, XS)     /* round towards near */                       \
+        cvsts_rx(W(XD), W(XS), rnnjs_rr)
+
+#define rnnts_ld(XD, MS, DS) /* round towards near */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        rnnts_rr(W(XD), W(XD))
+
+#define cvnts_rr(XD, XS)     /* round towards near */                       \
+        cvsts_rx(W(XD), W(XS), cvnjs_rr)
+
+#define cvnts_ld(XD, MS, DS) /* round towards near */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        cvnts_rr(W(XD), W(XD))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX POWER systems, use cvz
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rndts_rr(XD, XS)                                                    \
+        cvsts_rx(W(XD), W(XS), rndjs_rr)
+
+#define rndts_ld(XD, MS, DS)                                                \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        rndts_rr(W(XD), W(XD))
+
+#define cvtts_rr(XD, XS)                                                    \
+        cvsts_rx(W(XD), W(XS), cvtjs_rr)
+
+#define cvtts_ld(XD, MS, DS)                                                \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        cvtts_rr(W(XD), W(XD))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnrts_rr(XD, XS, mode)                                              \
+        cvkts_rx(W(XD), W(XS), rnrjs_rr, mode)
+
+#define cvrts_rr(XD, XS, mode)                                              \
+        cvkts_rx(W(XD), W(XS), cvrjs_rr, mode)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvntn_rr(XD, XS)     /* round towards near */                       \
+        cvsts_rx(W(XD), W(XS), cvnjn_rr)
+
+#define cvntn_ld(XD, MS, DS) /* round towards near */                       \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        cvntn_rr(W(XD), W(XD))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX POWER systems */
+
+#define cvttn_rr(XD, XS)                                                    \
+        cvsts_rx(W(XD), W(XS), cvtjn_rr)
+
+#define cvttn_ld(XD, MS, DS)                                                \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        cvttn_rr(W(XD), W(XD))
+
 #endif /* RT_SIMD_CODE */
 
 /******************************************************************************/
@@ -10432,6 +10976,76 @@ rt_si32 from_mask(rt_si32 mask)
 #define jmpxx_mm(MS, DS)                                                    \
         jmpxx_xm(W(MS), W(DS))
 
+/******************************************************************************/
+/**************** tile walkers (2D blocks with runtime pitch) *****************/
+/******************************************************************************/
+
+/*
+ * Tile walkers keep the state of a 2D block (image or matrix tile) in BASE
+ * registers: row pointer (B), row pitch in bytes (P), row counter (C) and
+ * wrap step (W), where P and W are loop-invariant and set up before the loop.
+ * Columns of the current row are addressed as (M***, DP) from B, while rows
+ * 1/2/4/8 ahead are reachable with scaled-indexed modes using P as index:
+ * S***(P), T***(P), U***(P), V***(P) respectively (no BASE ops on x86, one
+ * hidden add per access on RISC targets). Any other row, or a row which is
+ * accessed multiple times per iteration, is best hoisted out of the loop
+ * with rwaxx_ri into a spare register. Inner loops of 2D kernels are then
+ * left with SIMD ops and a single row-advance (addxx_rr B, P) per row.
+ */
+
+/* row-advance-jump (B = B + P, C = C - 1, if C != 0 then jump lb) */
+
+#define rwjxx_rr(RG, RS, RT, lb)                                            \
+        addxx_rr(W(RG), W(RS))                                              \
+        arjxx_ri(W(RT), IB(1), sub_x, NZ_x, lb)
+
+/* row-address (D = B + P * IT), D must differ from both B and P */
+
+#define rwaxx_ri(RD, RS, RT, IT)                                            \
+        movxx_rr(W(RD), W(RT))                                              \
+        mulxx_ri(W(RD), W(IT))                                              \
+        addxx_rr(W(RD), W(RS))
+
+/* wrap-step (W = IT - P * IS), where IS - rows in tile, IT - tile width
+ * in bytes, W must differ from P, addxx_rr(B, W) then moves B from past
+ * the last row of the current tile to the first row of the next tile */
+
+#define wstxx_ri(RD, RS, IS, IT)                                            \
+        movxx_rr(W(RD), W(RS))                                              \
+        mulxx_ri(W(RD), W(IS))                                              \
+        negxx_rx(W(RD))                                                     \
+        addxx_ri(W(RD), W(IT))
+
+/******************************************************************************/
+/**************** jump tables (computed dispatch by index) ********************/
+/******************************************************************************/
+
+/*
+ * Jump tables replace chains of compare-jumps (cmjxx) in interpreters and
+ * state machines with one bounds check and one indirect jump per dispatch.
+ * A table is an array of pointer-size (P) entries placed in data (heap),
+ * which is filled from within the same ASM section (labels are local to it)
+ * with label_st(lb, MD, DJ(dp, i)) before the dispatch loop, where dp is
+ * the table's offset from base register in MD. Entries are then indexed
+ * with fully explicit scaled-index mode N***(R, JS) from the table's base,
+ * where R is the index register (no BASE ops on x86, one hidden add on RISC).
+ * Label addresses are position-independent on all targets, so the table
+ * can't be a static constant and is re-filled in every ASM section using it.
+ */
+
+#define JS          (P+1)       /* scale for N***(R, JS) on P-size entries */
+
+#define DJ(dp, i)   DP((dp)+(i)*P*4)    /* entry i of the table at dp */
+
+/* jump-table dispatch (if S < IT then jump to table[S], else jump lb)
+ * S is an unsigned A-size index, IT is the number of entries in the table,
+ * MT is N***(RS, JS) based on the table's register, DT is its offset DP */
+
+#define jtbxx_xm(RS, IT, MT, DT, lb)                                        \
+        cmjxx_ri(W(RS), W(IT),                                              \
+        /* if */ GE_x, lb)                                                  \
+        jmpxx_xm(W(MT), W(DT))
+
 /******************************************************************************/
 /*********************************   CONFIG   *********************************/
 /******************************************************************************/
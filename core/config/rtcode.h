@@ -0,0 +1,331 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2025 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTCODE_H
+#define RT_RTCODE_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtcode.h: byte-stream coding kernels (LZ77 match length/copy, base64/hex,
+ * macros only).
+ * Include after rtbase.h in sources with ASM sections working on byte streams.
+ *
+ * LZ77 match length and copy compare/move one SIMD vector (J bytes) per step
+ * at arbitrary byte offsets with mvumx_ld/mvumx_st (rtconf.h), which map to
+ * native unaligned byte-vector loads/stores where available (x86, AArch64,
+ * ARMv7, MSA, VSX) and to aligned loads merged with a byte permute on VMX.
+ * Match length of two strings is found by comparing vectors with ceqmb_rr
+ * until not all bytes are equal, the index of the first mismatching byte
+ * in memory order is then taken from the compare mask with mlnmb_rr
+ * (movemask/ctz or the target's nearest equivalent), giving J on no mismatch.
+ * Length is clamped to the limit in BASE, as vectors may run past the end.
+ *
+ * Overlapping copy (LZ77 match from distance d) copies vectors from D-d to D,
+ * which is only valid if d is at least J. For shorter d the source is kept
+ * at the pattern's start and each vector is written at the end of valid data,
+ * doubling the distance every step (d, 2d, 4d, ...), until it reaches J
+ * and regular vector copies take over. Both literal and match copies overrun
+ * the end by up to J-1 bytes, which are overwritten by subsequent copies
+ * ("wild copy"), so buffers need at least J bytes of slack.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+/* mvu (D = S), unaligned 32-bit word at MS (no displacement)
+ * native on all targets except pre-r6 MIPS32 (byte loads/stores there)
+ * RD and RT must not be the base register of MS */
+
+#if (defined RT_BASE_COMPAT_REV) && (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#if RT_ENDIAN == 0
+
+#define mvuwx_ld(RD, RT, MS) /* destroys RT */                              \
+        movbx_ld(W(RD), W(MS), DP(0x003))                                   \
+        MVUWX(W(RD), W(RT), W(MS), 0x002)                                   \
+        MVUWX(W(RD), W(RT), W(MS), 0x001)                                   \
+        MVUWX(W(RD), W(RT), W(MS), 0x000)
+
+#define mvuwx_st(RS, MD) /* destroys RS */                                  \
+        movbx_st(W(RS), W(MD), DP(0x000))                                   \
+        shrwx_ri(W(RS), IB(8))                                              \
+        movbx_st(W(RS), W(MD), DP(0x001))                                   \
+        shrwx_ri(W(RS), IB(8))                                              \
+        movbx_st(W(RS), W(MD), DP(0x002))                                   \
+        shrwx_ri(W(RS), IB(8))                                              \
+        movbx_st(W(RS), W(MD), DP(0x003))
+
+#else /* RT_ENDIAN == 1 */
+
+#define mvuwx_ld(RD, RT, MS) /* destroys RT */                              \
+        movbx_ld(W(RD), W(MS), DP(0x000))                                   \
+        MVUWX(W(RD), W(RT), W(MS), 0x001)                                   \
+        MVUWX(W(RD), W(RT), W(MS), 0x002)                                   \
+        MVUWX(W(RD), W(RT), W(MS), 0x003)
+
+#define mvuwx_st(RS, MD) /* destroys RS */                                  \
+        movbx_st(W(RS), W(MD), DP(0x003))                                   \
+        shrwx_ri(W(RS), IB(8))                                              \
+        movbx_st(W(RS), W(MD), DP(0x002))                                   \
+        shrwx_ri(W(RS), IB(8))                                              \
+        movbx_st(W(RS), W(MD), DP(0x001))                                   \
+        shrwx_ri(W(RS), IB(8))                                              \
+        movbx_st(W(RS), W(MD), DP(0x000))
+
+#endif /* RT_ENDIAN */
+
+/* internal helper (next byte), not for direct use */
+
+#define MVUWX(RD, RT, MS, k)                                                \
+        shlwx_ri(W(RD), IB(8))                                              \
+        movbx_ld(W(RT), W(MS), DP(k))                                       \
+        orrwx_rr(W(RD), W(RT))
+
+#else /* native unaligned word access */
+
+#define mvuwx_ld(RD, RT, MS) /* destroys RT */                              \
+        movwx_ld(W(RD), W(MS), DP(0x000))
+
+#define mvuwx_st(RS, MD) /* destroys RS */                                  \
+        movwx_st(W(RS), W(MD), DP(0x000))
+
+#endif /* native unaligned word access */
+
+/*
+ * Base64 and hex coding (cmdm*, cmdo* subsets), one SIMD vector per step:
+ * J characters correspond to R lanes of 3 (base64) or 2 (hex) raw bytes,
+ * which are moved between byte streams and lanes in BASE, lane at a time
+ * (mvuwx_ld/movhx_ld into lanes, movwx_ld to mvuwx_st/movhx_st from lanes),
+ * as the common subset has no shuffles to regroup bytes across lanes.
+ * Splitting raw bytes into 6-bit (4-bit) values and packing them back
+ * is done in 32-bit lanes (e64ox_rr/d64ox_rr, ehxox_rr/dhxox_rr),
+ * values are translated to/from ASCII on bytes (a64mb_rr/v64mb_rr,
+ * ahxmb_rr/vhxmb_rr) with range compares and per-range offsets,
+ * decoding also returns a mask of valid characters (0xFF valid, 0 invalid).
+ * Invalid characters are decoded as their own lower 6 (4) bits.
+ * Byte and 32-bit subsets are not register-compatible on all targets,
+ * thus switch between them via memory (movmx_st/movox_ld and vice versa).
+ *
+ * Constants table (RT_CODE_FLD fields of Q*16 bytes) set by RT_CODE_SET:
+ * field 0 - scratch vector for the caller, fields 1-24 - byte constants,
+ * fields 25-43 - 32-bit lane masks for bit splitting/packing.
+ */
+#define RT_CODE_FLD         44 /* fields in constants table */
+
+#define RT_CODE_SET(__Tab__)                                                \
+    {                                                                       \
+        static const rt_byte __b[24] =                                      \
+        {                                                                   \
+            0x41, 0x19, 0x06, 0x33, 0xB5, 0x3E, 0xF1, 0x3F,                 \
+            0xF4, 0x61, 0xBF, 0xB9, 0x30, 0x09, 0x04, 0x2B,                 \
+            0x13, 0x2F, 0x10, 0x27, 0xD0, 0x05, 0xC9, 0xA9,                 \
+        };                                                                  \
+        static const rt_ui32 __w[19] =                                      \
+        {                                                                   \
+            0x0000003F, 0x00003F00, 0x003F0000, 0x3F000000,                 \
+            0x00003000, 0x00000F00, 0x003C0000, 0x00030000,                 \
+            0x000000FC, 0x00000003, 0x0000F000, 0x00C00000,                 \
+            0xFC000000, 0x03F00000, 0x000FC000, 0x0000000F,                 \
+            0x000F0000, 0x0F000000, 0x000000F0,                             \
+        };                                                                  \
+        rt_si32 __i, __k;                                                   \
+        for (__k = 0; __k < 24; __k++)                                      \
+        {                                                                   \
+            for (__i = 0; __i < J; __i++)                                   \
+            {                                                               \
+                ((rt_byte *)(__Tab__))[(__k + 0x01)*J + __i] = __b[__k];    \
+            }                                                               \
+        }                                                                   \
+        for (__k = 0; __k < 19; __k++)                                      \
+        {                                                                   \
+            for (__i = 0; __i < R; __i++)                                   \
+            {                                                               \
+                ((rt_ui32 *)(__Tab__))[(__k + 0x19)*R + __i] = __w[__k];    \
+            }                                                               \
+        }                                                                   \
+    }
+
+/* internal helpers (lane bit-field terms), not for direct use
+ * D = (S sh n) & mask, G |= (S sh n) & mask, G = ((G sh n) & mask) | T */
+
+#define CDTOX(XD, XS, MC, sh, n, k)                                         \
+        movox_rr(W(XD), W(XS))                                              \
+        sh(W(XD), IB(n))                                                    \
+        andox_ld(W(XD), W(MC), DH(Q*(k)))
+
+#define CDTOR(XG, XT, XS, MC, sh, n, k)                                     \
+        CDTOX(W(XT), W(XS), W(MC), sh, n, k)                                \
+        orrox_rr(W(XG), W(XT))
+
+#define CDTOL(XG, XT, MC, sh, n, k)                                         \
+        sh(W(XG), IB(n))                                                    \
+        andox_ld(W(XG), W(MC), DH(Q*(k)))                                   \
+        orrox_rr(W(XG), W(XT))
+
+/* internal helpers (byte ranges), not for direct use
+ * O += (G cmp S) & offset, V |= in-range(G), O |= in-range(G) & offset */
+
+#define CDGMB(XO, XT, XG, MC, cmp, v, o)                                    \
+        movmx_rr(W(XT), W(XG))                                              \
+        cmp(W(XT), W(MC), DH(Q*(v)))                                        \
+        andmx_ld(W(XT), W(MC), DH(Q*(o)))                                   \
+        addmb_rr(W(XO), W(XT))
+
+#define CDRMB(XO, XV, XT, XG, MC, lo, sp, o)                                \
+        movmx_rr(W(XT), W(XG))                                              \
+        submb_ld(W(XT), W(MC), DH(Q*(lo)))                                  \
+        clemb_ld(W(XT), W(MC), DH(Q*(sp)))                                  \
+        orrmx_rr(W(XV), W(XT))                                              \
+        andmx_ld(W(XT), W(MC), DH(Q*(o)))                                   \
+        orrmx_rr(W(XO), W(XT))
+
+#define CDEMB(XO, XV, XT, XG, MC, ch, o)                                    \
+        movmx_rr(W(XT), W(XG))                                              \
+        ceqmb_ld(W(XT), W(MC), DH(Q*(ch)))                                  \
+        orrmx_rr(W(XV), W(XT))                                              \
+        andmx_ld(W(XT), W(MC), DH(Q*(o)))                                   \
+        orrmx_rr(W(XO), W(XT))
+
+#if RT_ENDIAN == 0
+
+/* e64 (G = split 3 bytes to 4 6-bit values), lane-wise, bytes in memory order
+ * C is the constants table */
+
+#define e64ox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shrox_ri,  2, 0x190)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri, 12, 0x1D0)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  4, 0x1E0)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri, 10, 0x1F0)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  6, 0x200)              \
+        CDTOL(W(XG), W(XT), W(MC), shlox_ri,  8, 0x1C0)
+
+/* d64 (G = pack 4 6-bit values to 3 bytes), lane-wise, for mvuwx_st
+ * C is the constants table */
+
+#define d64ox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shlox_ri,  2, 0x210)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri, 12, 0x220)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  4, 0x230)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri, 10, 0x1E0)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  6, 0x240)              \
+        CDTOL(W(XG), W(XT), W(MC), shrox_ri,  8, 0x1B0)
+
+/* ehx (G = split 2 bytes to 4 nibbles), lane-wise, from movhx_ld
+ * C is the constants table */
+
+#define ehxox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shrox_ri,  4, 0x280)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  8, 0x1E0)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  4, 0x290)              \
+        CDTOL(W(XG), W(XT), W(MC), shlox_ri, 16, 0x2A0)
+
+/* dhx (G = pack 4 nibbles to 2 bytes), lane-wise, for movhx_st
+ * C is the constants table */
+
+#define dhxox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shlox_ri,  4, 0x2B0)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  8, 0x280)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  4, 0x230)              \
+        CDTOL(W(XG), W(XT), W(MC), shrox_ri, 16, 0x1E0)
+
+#else /* RT_ENDIAN == 1 */
+
+/* e64 (G = split 3 bytes to 4 6-bit values), lane-wise, bytes in memory order
+ * C is the constants table */
+
+#define e64ox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shrox_ri,  2, 0x1C0)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  4, 0x1B0)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  6, 0x1A0)              \
+        CDTOL(W(XG), W(XT), W(MC), shrox_ri,  8, 0x190)
+
+/* d64 (G = pack 4 6-bit values to 3 bytes), lane-wise, for mvuwx_st
+ * C is the constants table */
+
+#define d64ox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shlox_ri,  2, 0x250)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  4, 0x260)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  6, 0x270)              \
+        CDTOL(W(XG), W(XT), W(MC), shlox_ri,  8, 0x1A0)
+
+/* ehx (G = split 2 bytes to 4 nibbles), lane-wise, from movhx_ld
+ * C is the constants table */
+
+#define ehxox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shlox_ri, 12, 0x2A0)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  8, 0x290)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shlox_ri,  4, 0x1E0)              \
+        andox_ld(W(XG), W(MC), DH(Q*0x280))                                 \
+        orrox_rr(W(XG), W(XT))
+
+/* dhx (G = pack 4 nibbles to 2 bytes), lane-wise, for movhx_st
+ * C is the constants table */
+
+#define dhxox_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        CDTOX(W(XT), W(XG), W(MC), shrox_ri, 12, 0x230)                     \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  8, 0x1E0)              \
+        CDTOR(W(XT), W(XU), W(XG), W(MC), shrox_ri,  4, 0x2B0)              \
+        andox_ld(W(XG), W(MC), DH(Q*0x280))                                 \
+        orrox_rr(W(XG), W(XT))
+
+#endif /* RT_ENDIAN */
+
+/* a64 (G = base64 characters from 6-bit values), byte-wise
+ * C is the constants table */
+
+#define a64mb_rr(XG, XT, XU, MC) /* destroys XT, XU */                      \
+        movmx_ld(W(XU), W(MC), DH(Q*0x010))                                 \
+        CDGMB(W(XU), W(XT), W(XG), W(MC), cgtmb_ld, 0x020, 0x030)           \
+        CDGMB(W(XU), W(XT), W(XG), W(MC), cgtmb_ld, 0x040, 0x050)           \
+        CDGMB(W(XU), W(XT), W(XG), W(MC), ceqmb_ld, 0x060, 0x070)           \
+        CDGMB(W(XU), W(XT), W(XG), W(MC), ceqmb_ld, 0x080, 0x090)           \
+        addmb_rr(W(XG), W(XU))
+
+/* v64 (G = 6-bit values from base64 characters), byte-wise
+ * V is the mask of valid characters, C is the constants table */
+
+#define v64mb_rr(XG, XV, XT, XU, MC) /* destroys XT, XU */                  \
+        xormx_rr(W(XV), W(XV))                                              \
+        xormx_rr(W(XU), W(XU))                                              \
+        CDRMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x010, 0x020, 0x0B0)       \
+        CDRMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x0A0, 0x020, 0x0C0)       \
+        CDRMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x0D0, 0x0E0, 0x0F0)       \
+        CDEMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x100, 0x110)              \
+        CDEMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x120, 0x130)              \
+        addmb_rr(W(XG), W(XU))
+
+/* ahx (G = lowercase hex characters from nibbles), byte-wise
+ * C is the constants table */
+
+#define ahxmb_rr(XG, XT, MC) /* destroys XT */                              \
+        movmx_rr(W(XT), W(XG))                                              \
+        cgtmb_ld(W(XT), W(MC), DH(Q*0x0E0))                                 \
+        andmx_ld(W(XT), W(MC), DH(Q*0x140))                                 \
+        addmb_rr(W(XG), W(XT))                                              \
+        addmb_ld(W(XG), W(MC), DH(Q*0x0D0))
+
+/* vhx (G = nibbles from hex characters, either case), byte-wise
+ * V is the mask of valid characters, C is the constants table */
+
+#define vhxmb_rr(XG, XV, XT, XU, MC) /* destroys XT, XU */                  \
+        xormx_rr(W(XV), W(XV))                                              \
+        xormx_rr(W(XU), W(XU))                                              \
+        CDRMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x0D0, 0x0E0, 0x150)       \
+        CDRMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x010, 0x160, 0x170)       \
+        CDRMB(W(XU), W(XV), W(XT), W(XG), W(MC), 0x0A0, 0x160, 0x180)       \
+        addmb_rr(W(XG), W(XU))
+
+#endif /* RT_RTCODE_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -1010,6 +1010,123 @@
 #define fmsts3ld(XG, XS, MT, DT)                                            \
         fmsts_ld(W(XG), W(XS), W(MT), W(DT))
 
+/******************************************************************************/
+/**** var-len **** SIMD burst ld/st with fixed-32/64-bit element **************/
+/******************************************************************************/
+
+/* mov (D = S), burst of 2/4 registers from/to consecutive full-width slots
+ * [M + D], [M + D + width], ..., all addressed off the same base register,
+ * last slot's displacement must still fit into the type (DP, DF, ...) of D
+ * (unrolled bursts check it at assembly time with DNCHK on RISC targets),
+ * only [base + D] addressing modes (not Oeax with PLAIN) are supported,
+ * 4-register bursts with consecutive register numbers in order (like Xmm4,
+ * Xmm5, Xmm6, Xmm7) map to one ld1/st1 on AArch64, others to two ldp/stp,
+ * burst ld/st are element-agnostic, movqx** map to the same native ops */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined RT_SIMD_BURST_256)
+
+#define movox2ld(XD, XE, MS, DS)                                            \
+        movcx2ld(W(XD), W(XE), W(MS), W(DS))
+
+#define movox2st(XS, XT, MD, DD)                                            \
+        movcx2st(W(XS), W(XT), W(MD), W(DD))
+
+#define movox4ld(XD, XE, XF, XG, MS, DS)                                    \
+        movcx4ld(W(XD), W(XE), W(XF), W(XG), W(MS), W(DS))
+
+#define movox4st(XS, XT, XU, XV, MD, DD)                                    \
+        movcx4st(W(XS), W(XT), W(XU), W(XV), W(MD), W(DD))
+
+#define movqx2ld(XD, XE, MS, DS)                                            \
+        movcx2ld(W(XD), W(XE), W(MS), W(DS))
+
+#define movqx2st(XS, XT, MD, DD)                                            \
+        movcx2st(W(XS), W(XT), W(MD), W(DD))
+
+#define movqx4ld(XD, XE, XF, XG, MS, DS)                                    \
+        movcx4ld(W(XD), W(XE), W(XF), W(XG), W(MS), W(DS))
+
+#define movqx4st(XS, XT, XU, XV, MD, DD)                                    \
+        movcx4st(W(XS), W(XT), W(XU), W(XV), W(MD), W(DD))
+
+#elif (RT_SIMD == 128) && (defined RT_SIMD_BURST_128)
+
+#define movox2ld(XD, XE, MS, DS)                                            \
+        movix2ld(W(XD), W(XE), W(MS), W(DS))
+
+#define movox2st(XS, XT, MD, DD)                                            \
+        movix2st(W(XS), W(XT), W(MD), W(DD))
+
+#define movox4ld(XD, XE, XF, XG, MS, DS)                                    \
+        movix4ld(W(XD), W(XE), W(XF), W(XG), W(MS), W(DS))
+
+#define movox4st(XS, XT, XU, XV, MD, DD)                                    \
+        movix4st(W(XS), W(XT), W(XU), W(XV), W(MD), W(DD))
+
+#define movqx2ld(XD, XE, MS, DS)                                            \
+        movix2ld(W(XD), W(XE), W(MS), W(DS))
+
+#define movqx2st(XS, XT, MD, DD)                                            \
+        movix2st(W(XS), W(XT), W(MD), W(DD))
+
+#define movqx4ld(XD, XE, XF, XG, MS, DS)                                    \
+        movix4ld(W(XD), W(XE), W(XF), W(XG), W(MS), W(DS))
+
+#define movqx4st(XS, XT, XU, XV, MD, DD)                                    \
+        movix4st(W(XS), W(XT), W(XU), W(XV), W(MD), W(DD))
+
+#else  /* unrolled off the same base without pointer bumps in between */
+
+#define movox2ld(XD, XE, MS, DS)                                            \
+        DNCHK(RT_SIMD_WIDTH32*4*1, DS)                                      \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        movox_ld(W(XE), W(MS), DN(RT_SIMD_WIDTH32*4*1, DS))
+
+#define movox2st(XS, XT, MD, DD)                                            \
+        DNCHK(RT_SIMD_WIDTH32*4*1, DD)                                      \
+        movox_st(W(XS), W(MD), W(DD))                                       \
+        movox_st(W(XT), W(MD), DN(RT_SIMD_WIDTH32*4*1, DD))
+
+#define movox4ld(XD, XE, XF, XG, MS, DS)                                    \
+        DNCHK(RT_SIMD_WIDTH32*4*3, DS)                                      \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        movox_ld(W(XE), W(MS), DN(RT_SIMD_WIDTH32*4*1, DS))                 \
+        movox_ld(W(XF), W(MS), DN(RT_SIMD_WIDTH32*4*2, DS))                 \
+        movox_ld(W(XG), W(MS), DN(RT_SIMD_WIDTH32*4*3, DS))
+
+#define movox4st(XS, XT, XU, XV, MD, DD)                                    \
+        DNCHK(RT_SIMD_WIDTH32*4*3, DD)                                      \
+        movox_st(W(XS), W(MD), W(DD))                                       \
+        movox_st(W(XT), W(MD), DN(RT_SIMD_WIDTH32*4*1, DD))                 \
+        movox_st(W(XU), W(MD), DN(RT_SIMD_WIDTH32*4*2, DD))                 \
+        movox_st(W(XV), W(MD), DN(RT_SIMD_WIDTH32*4*3, DD))
+
+#define movqx2ld(XD, XE, MS, DS)                                            \
+        DNCHK(RT_SIMD_WIDTH64*8*1, DS)                                      \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        movqx_ld(W(XE), W(MS), DN(RT_SIMD_WIDTH64*8*1, DS))
+
+#define movqx2st(XS, XT, MD, DD)                                            \
+        DNCHK(RT_SIMD_WIDTH64*8*1, DD)                                      \
+        movqx_st(W(XS), W(MD), W(DD))                                       \
+        movqx_st(W(XT), W(MD), DN(RT_SIMD_WIDTH64*8*1, DD))
+
+#define movqx4ld(XD, XE, XF, XG, MS, DS)                                    \
+        DNCHK(RT_SIMD_WIDTH64*8*3, DS)                                      \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        movqx_ld(W(XE), W(MS), DN(RT_SIMD_WIDTH64*8*1, DS))                 \
+        movqx_ld(W(XF), W(MS), DN(RT_SIMD_WIDTH64*8*2, DS))                 \
+        movqx_ld(W(XG), W(MS), DN(RT_SIMD_WIDTH64*8*3, DS))
+
+#define movqx4st(XS, XT, XU, XV, MD, DD)                                    \
+        DNCHK(RT_SIMD_WIDTH64*8*3, DD)                                      \
+        movqx_st(W(XS), W(MD), W(DD))                                       \
+        movqx_st(W(XT), W(MD), DN(RT_SIMD_WIDTH64*8*1, DD))                 \
+        movqx_st(W(XU), W(MD), DN(RT_SIMD_WIDTH64*8*2, DD))                 \
+        movqx_st(W(XV), W(MD), DN(RT_SIMD_WIDTH64*8*3, DD))
+
+#endif /* RT_SIMD_BURST */
+
 /******************************************************************************/
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 256-bit ***/
 /******************************************************************************/
@@ -1035,6 +1152,15 @@
 #define movmx_st(XS, MD, DD)                                                \
         movax_st(W(XS), W(MD), W(DD))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+        mvuax_ld(W(XD), W(MS), W(DS))
+
+#define mvumx_st(XS, MD, DD)                                                \
+        mvuax_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1875,6 +2001,14 @@
 #define shrmc3ld(XD, XS, MT, DT)                                            \
         shrac3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswmx_rr(XD, XS)                                                    \
+        bswax_rr(W(XD), W(XS))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        bswax_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -2341,12 +2475,24 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjax_rx(W(XS), mask, lb)
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjax_rk(W(XS), mask, lb)
+
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjab_rx(W(XS), mask, lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjab_rk(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = J if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        mlnab_rr(W(RD), W(XS))
+
 /******************************************************************************/
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 128-bit ***/
 /******************************************************************************/
@@ -2372,6 +2518,15 @@
 #define movmx_st(XS, MD, DD)                                                \
         movgx_st(W(XS), W(MD), W(DD))
 
+/* mvu (D = S), unaligned, base in MS/MD can point to any byte in memory,
+ * DS/DD have the same restrictions as in regular mov (natural alignment) */
+
+#define mvumx_ld(XD, MS, DS)                                                \
+        mvugx_ld(W(XD), W(MS), W(DS))
+
+#define mvumx_st(XS, MD, DD)                                                \
+        mvugx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -3212,6 +3367,14 @@
 #define shrmc3ld(XD, XS, MT, DT)                                            \
         shrgc3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswmx_rr(XD, XS)                                                    \
+        bswgx_rr(W(XD), W(XS))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        bswgx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -3678,12 +3841,24 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjgx_rx(W(XS), mask, lb)
 
-#define mkjmb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjmx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgx_rk(W(XS), mask, lb)
+
+#define mkjmb_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjgb_rx(W(XS), mask, lb)
 
+#define mkjmb_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjgb_rk(W(XS), mask, lb)
+
+/* mln (D = number of leading -1 elems of S in memory order), D is BASE reg,
+ * S elems are 0 or -1 (as from ceq/cne), D = J if all elems of S are -1 */
+
+#define mlnmb_rr(RD, XS)                                                    \
+        mlngb_rr(W(RD), W(XS))
+
 #endif /* RT_SIMD: 256, 128 */
 
 /******************************************************************************/
@@ -4130,9 +4305,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjcx_rx(W(XS), mask, lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rk(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -4516,6 +4694,14 @@
 #define shron3ld(XD, XS, MT, DT)                                            \
         shrcn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswox_rr(XD, XS)                                                    \
+        bswcx_rr(W(XD), W(XS))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        bswcx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -5203,9 +5389,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjox_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjix_rx(W(XS), mask, lb)
 
+#define mkjox_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rk(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -5589,6 +5778,14 @@
 #define shron3ld(XD, XS, MT, DT)                                            \
         shrin3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswox_rr(XD, XS)                                                    \
+        bswix_rr(W(XD), W(XS))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        bswix_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -6278,9 +6475,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjqx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjdx_rx(W(XS), mask, lb)
 
+#define mkjqx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjdx_rk(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -6664,6 +6864,14 @@
 #define shrqn3ld(XD, XS, MT, DT)                                            \
         shrdn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswqx_rr(XD, XS)                                                    \
+        bswdx_rr(W(XD), W(XS))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        bswdx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -7351,9 +7559,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjqx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjjx_rx(W(XS), mask, lb)
 
+#define mkjqx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rk(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -7737,6 +7948,14 @@
 #define shrqn3ld(XD, XS, MT, DT)                                            \
         shrjn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswqx_rr(XD, XS)                                                    \
+        bswjx_rr(W(XD), W(XS))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        bswjx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -8134,16 +8353,35 @@
 /* mxx (D = mask-from-predicate S), (D = predicate-from-mask S) */
 
 #define mmxpx_rr(XD, PS)                                                    \
-        mmxox_rx(W(XD), W(PS))
+        mmxox_rr(W(XD), W(PS))
 
 #define mxmpx_rr(PD, XS)                                                    \
-        mxmox_rx(W(PD), W(XS))
+        mxmox_rr(W(PD), W(XS))
 
 /* mxj (jump to lb) if (S satisfies mask condition) */
 
-#define mxjpx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mxjpx_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
         mxjox_rx(W(PS), mask, lb)
 
+/* mov (D = S), predicated */
+
+#define mxvpx_rr(XD, PS, XS)                                                \
+        mxvox_rr(W(XD), W(PS), W(XS))
+
+#define mxvpx_ld(XD, PS, MS, DS)                                            \
+        mxvox_ld(W(XD), W(PS), W(MS), W(DS))
+
+#define mxvpx_st(XS, PS, MD, DD)                                            \
+        mxvox_st(W(XS), W(PS), W(MD), W(DD))
+
+/* sel (D = P ? T : S), predicated blend */
+
+#define selpx_rr(XD, PS, XS, XT)                                            \
+        selox_rr(W(XD), W(PS), W(XS), W(XT))
+
+#define selpx_ld(XD, PS, XS, MT, DT)                                        \
+        selox_ld(W(XD), W(PS), W(XS), W(MT), W(DT))
+
 /**********************************   SIMD   **********************************/
 
 /* elm (D = S), store first SIMD element with natural alignment
@@ -8165,6 +8403,20 @@
 #define movpx_st(XS, MD, DD)                                                \
         movox_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), burst of 2/4 registers to/from consecutive memory slots */
+
+#define movpx2ld(XD, XE, MS, DS)                                            \
+        movox2ld(W(XD), W(XE), W(MS), W(DS))
+
+#define movpx2st(XS, XT, MD, DD)                                            \
+        movox2st(W(XS), W(XT), W(MD), W(DD))
+
+#define movpx4ld(XD, XE, XF, XG, MS, DS)                                    \
+        movox4ld(W(XD), W(XE), W(XF), W(XG), W(MS), W(DS))
+
+#define movpx4st(XS, XT, XU, XV, MD, DD)                                    \
+        movox4st(W(XS), W(XT), W(XU), W(XV), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -8584,9 +8836,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjpx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjpx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjox_rx(W(XS), mask, lb)
 
+#define mkjpx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjox_rk(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -8970,6 +9225,14 @@
 #define shrpn3ld(XD, XS, MT, DT)                                            \
         shron3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswpx_rr(XD, XS)                                                    \
+        bswox_rr(W(XD), W(XS))
+
+#define bswpx_ld(XD, MS, DS)                                                \
+        bswox_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -9655,9 +9918,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjfx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjfx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjcx_rx(W(XS), mask, lb)
 
+#define mkjfx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjcx_rk(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -10041,6 +10307,14 @@
 #define shrfn3ld(XD, XS, MT, DT)                                            \
         shrcn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswfx_rr(XD, XS)                                                    \
+        bswcx_rr(W(XD), W(XS))
+
+#define bswfx_ld(XD, MS, DS)                                                \
+        bswcx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -10726,9 +11000,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjlx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjlx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjix_rx(W(XS), mask, lb)
 
+#define mkjlx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjix_rk(W(XS), mask, lb)
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -11112,6 +11389,14 @@
 #define shrln3ld(XD, XS, MT, DT)                                            \
         shrin3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswlx_rr(XD, XS)                                                    \
+        bswix_rr(W(XD), W(XS))
+
+#define bswlx_ld(XD, MS, DS)                                                \
+        bswix_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -11606,6 +11891,134 @@
 #define cgess3ld(XD, XS, MT, DT)                                            \
         cgers3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjss_rr(XS, XT, cc, lb)                                            \
+        cmjrs_rr(W(XS), W(XT), cc, lb)
+
+/*************   scalar single-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnzss_rr(XD, XS)     /* round towards zero */                       \
+        rnzrs_rr(W(XD), W(XS))
+
+#define rnzss_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzrs_ld(W(XD), W(MS), W(DS))
+
+#define cvzss_rr(XD, XS)     /* round towards zero */                       \
+        cvzrs_rr(W(XD), W(XS))
+
+#define cvzss_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzrs_ld(W(XD), W(MS), W(DS))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnpss_rr(XD, XS)     /* round towards +inf */                       \
+        rnprs_rr(W(XD), W(XS))
+
+#define rnpss_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnprs_ld(W(XD), W(MS), W(DS))
+
+#define cvpss_rr(XD, XS)     /* round towards +inf */                       \
+        cvprs_rr(W(XD), W(XS))
+
+#define cvpss_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvprs_ld(W(XD), W(MS), W(DS))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnmss_rr(XD, XS)     /* round towards -inf */                       \
+        rnmrs_rr(W(XD), W(XS))
+
+#define rnmss_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmrs_ld(W(XD), W(MS), W(DS))
+
+#define cvmss_rr(XD, XS)     /* round towards -inf */                       \
+        cvmrs_rr(W(XD), W(XS))
+
+#define cvmss_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmrs_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnnss_rr(XD, XS)     /* round towards near */                       \
+        rnnrs_rr(W(XD), W(XS))
+
+#define rnnss_ld(XD, MS, DS) /* round towards near */                       \
+        rnnrs_ld(W(XD), W(MS), W(DS))
+
+#define cvnss_rr(XD, XS)     /* round towards near */                       \
+        cvnrs_rr(W(XD), W(XS))
+
+#define cvnss_ld(XD, MS, DS) /* round towards near */                       \
+        cvnrs_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX POWER systems, use cvz
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rndss_rr(XD, XS)                                                    \
+        rndrs_rr(W(XD), W(XS))
+
+#define rndss_ld(XD, MS, DS)                                                \
+        rndrs_ld(W(XD), W(MS), W(DS))
+
+#define cvtss_rr(XD, XS)                                                    \
+        cvtrs_rr(W(XD), W(XS))
+
+#define cvtss_ld(XD, MS, DS)                                                \
+        cvtrs_ld(W(XD), W(MS), W(DS))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnrss_rr(XD, XS, mode)                                              \
+        rnrrs_rr(W(XD), W(XS), mode)
+
+#define cvrss_rr(XD, XS, mode)                                              \
+        cvrrs_rr(W(XD), W(XS), mode)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnsn_rr(XD, XS)     /* round towards near */                       \
+        cvnrn_rr(W(XD), W(XS))
+
+#define cvnsn_ld(XD, MS, DS) /* round towards near */                       \
+        cvnrn_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX POWER systems */
+
+#define cvtsn_rr(XD, XS)                                                    \
+        cvtrn_rr(W(XD), W(XS))
+
+#define cvtsn_ld(XD, MS, DS)                                                \
+        cvtrn_ld(W(XD), W(MS), W(DS))
+
 /******************************************************************************/
 /**** var-len **** SIMD instructions with configurable element **** 64-bit ****/
 /******************************************************************************/
@@ -11758,16 +12171,35 @@
 /* mxx (D = mask-from-predicate S), (D = predicate-from-mask S) */
 
 #define mmxpx_rr(XD, PS)                                                    \
-        mmxqx_rx(W(XD), W(PS))
+        mmxqx_rr(W(XD), W(PS))
 
 #define mxmpx_rr(PD, XS)                                                    \
-        mxmqx_rx(W(PD), W(XS))
+        mxmqx_rr(W(PD), W(XS))
 
 /* mxj (jump to lb) if (S satisfies mask condition) */
 
-#define mxjpx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mxjpx_rx(PS, mask, lb)                  /* if S == mask jump lb */  \
         mxjqx_rx(W(PS), mask, lb)
 
+/* mov (D = S), predicated */
+
+#define mxvpx_rr(XD, PS, XS)                                                \
+        mxvqx_rr(W(XD), W(PS), W(XS))
+
+#define mxvpx_ld(XD, PS, MS, DS)                                            \
+        mxvqx_ld(W(XD), W(PS), W(MS), W(DS))
+
+#define mxvpx_st(XS, PS, MD, DD)                                            \
+        mxvqx_st(W(XS), W(PS), W(MD), W(DD))
+
+/* sel (D = P ? T : S), predicated blend */
+
+#define selpx_rr(XD, PS, XS, XT)                                            \
+        selqx_rr(W(XD), W(PS), W(XS), W(XT))
+
+#define selpx_ld(XD, PS, XS, MT, DT)                                        \
+        selqx_ld(W(XD), W(PS), W(XS), W(MT), W(DT))
+
 /**********************************   SIMD   **********************************/
 
 /* elm (D = S), store first SIMD element with natural alignment
@@ -11789,6 +12221,20 @@
 #define movpx_st(XS, MD, DD)                                                \
         movqx_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), burst of 2/4 registers to/from consecutive memory slots */
+
+#define movpx2ld(XD, XE, MS, DS)                                            \
+        movqx2ld(W(XD), W(XE), W(MS), W(DS))
+
+#define movpx2st(XS, XT, MD, DD)                                            \
+        movqx2st(W(XS), W(XT), W(MD), W(DD))
+
+#define movpx4ld(XD, XE, XF, XG, MS, DS)                                    \
+        movqx4ld(W(XD), W(XE), W(XF), W(XG), W(MS), W(DS))
+
+#define movpx4st(XS, XT, XU, XV, MD, DD)                                    \
+        movqx4st(W(XS), W(XT), W(XU), W(XV), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -12208,9 +12654,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjpx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjpx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjqx_rx(W(XS), mask, lb)
 
+#define mkjpx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjqx_rk(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -12594,6 +13043,14 @@
 #define shrpn3ld(XD, XS, MT, DT)                                            \
         shrqn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswpx_rr(XD, XS)                                                    \
+        bswqx_rr(W(XD), W(XS))
+
+#define bswpx_ld(XD, MS, DS)                                                \
+        bswqx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -13279,9 +13736,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjfx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjfx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjdx_rx(W(XS), mask, lb)
 
+#define mkjfx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjdx_rk(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -13665,6 +14125,14 @@
 #define shrfn3ld(XD, XS, MT, DT)                                            \
         shrdn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswfx_rr(XD, XS)                                                    \
+        bswdx_rr(W(XD), W(XS))
+
+#define bswfx_ld(XD, MS, DS)                                                \
+        bswdx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -14350,9 +14818,12 @@
 
 /* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define mkjlx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+#define mkjlx_rx(XS, mask, lb)                  /* if S == mask jump lb */  \
         mkjjx_rx(W(XS), mask, lb)
 
+#define mkjlx_rk(XS, mask, lb)      /* keeps Reax, if S == mask jump lb */  \
+        mkjjx_rk(W(XS), mask, lb)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -14736,6 +15207,14 @@
 #define shrln3ld(XD, XS, MT, DT)                                            \
         shrjn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* bsw (D = byte-swap S), reverse byte order within each element */
+
+#define bswlx_rr(XD, XS)                                                    \
+        bswjx_rr(W(XD), W(XS))
+
+#define bswlx_ld(XD, MS, DS)                                                \
+        bswjx_ld(W(XD), W(MS), W(DS))
+
 /* svl (G = G << S), (D = S << T) if (#D != #T) - variable, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -15230,6 +15709,134 @@
 #define cgess3ld(XD, XS, MT, DT)                                            \
         cgets3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined
+ * NOTE: only EQ_x, NE_x, LT_x, LE_x, GT_x, GE_x are valid for cc,
+ * unordered (NaN) operands only satisfy NE_x (same as in C) */
+
+#define cmjss_rr(XS, XT, cc, lb)                                            \
+        cmjts_rr(W(XS), W(XT), cc, lb)
+
+/*************   scalar double-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnzss_rr(XD, XS)     /* round towards zero */                       \
+        rnzts_rr(W(XD), W(XS))
+
+#define rnzss_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzts_ld(W(XD), W(MS), W(DS))
+
+#define cvzss_rr(XD, XS)     /* round towards zero */                       \
+        cvzts_rr(W(XD), W(XS))
+
+#define cvzss_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzts_ld(W(XD), W(MS), W(DS))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnpss_rr(XD, XS)     /* round towards +inf */                       \
+        rnpts_rr(W(XD), W(XS))
+
+#define rnpss_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpts_ld(W(XD), W(MS), W(DS))
+
+#define cvpss_rr(XD, XS)     /* round towards +inf */                       \
+        cvpts_rr(W(XD), W(XS))
+
+#define cvpss_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpts_ld(W(XD), W(MS), W(DS))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnmss_rr(XD, XS)     /* round towards -inf */                       \
+        rnmts_rr(W(XD), W(XS))
+
+#define rnmss_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmts_ld(W(XD), W(MS), W(DS))
+
+#define cvmss_rr(XD, XS)     /* round towards -inf */                       \
+        cvmts_rr(W(XD), W(XS))
+
+#define cvmss_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmts_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnnss_rr(XD, XS)     /* round towards near */                       \
+        rnnts_rr(W(XD), W(XS))
+
+#define rnnss_ld(XD, MS, DS) /* round towards near */                       \
+        rnnts_ld(W(XD), W(MS), W(DS))
+
+#define cvnss_rr(XD, XS)     /* round towards near */                       \
+        cvnts_rr(W(XD), W(XS))
+
+#define cvnss_ld(XD, MS, DS) /* round towards near */                       \
+        cvnts_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX POWER systems, use cvz
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rndss_rr(XD, XS)                                                    \
+        rndts_rr(W(XD), W(XS))
+
+#define rndss_ld(XD, MS, DS)                                                \
+        rndts_ld(W(XD), W(MS), W(DS))
+
+#define cvtss_rr(XD, XS)                                                    \
+        cvtts_rr(W(XD), W(XS))
+
+#define cvtss_ld(XD, MS, DS)                                                \
+        cvtts_ld(W(XD), W(MS), W(DS))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnrss_rr(XD, XS, mode)                                              \
+        rnrts_rr(W(XD), W(XS), mode)
+
+#define cvrss_rr(XD, XS, mode)                                              \
+        cvrts_rr(W(XD), W(XS), mode)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnsn_rr(XD, XS)     /* round towards near */                       \
+        cvntn_rr(W(XD), W(XS))
+
+#define cvnsn_ld(XD, MS, DS) /* round towards near */                       \
+        cvntn_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX POWER systems */
+
+#define cvtsn_rr(XD, XS)                                                    \
+        cvttn_rr(W(XD), W(XS))
+
+#define cvtsn_ld(XD, MS, DS)                                                \
+        cvttn_ld(W(XD), W(MS), W(DS))
+
 #endif /* RT_ELEMENT */
 
 #endif /* RT_SIMD_CODE */
@@ -15603,6 +16210,16 @@
 #define notxx_mx(MG, DG)                                                    \
         notwx_mx(W(MG), W(DG))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswxx_rx(RG)                                                        \
+        bswwx_rx(W(RG))
+
+#define bswxx_ld(RD, MS, DS)                                                \
+        bswwx_ld(W(RD), W(MS), W(DS))
+
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -16396,6 +17013,16 @@
 #define notxx_mx(MG, DG)                                                    \
         notzx_mx(W(MG), W(DG))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswxx_rx(RG)                                                        \
+        bswzx_rx(W(RG))
+
+#define bswxx_ld(RD, MS, DS)                                                \
+        bswzx_ld(W(RD), W(MS), W(DS))
+
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -17191,6 +17818,16 @@
 #define notyx_mx(MG, DG)                                                    \
         notwx_mx(W(MG), W(DG))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswyx_rx(RG)                                                        \
+        bswwx_rx(W(RG))
+
+#define bswyx_ld(RD, MS, DS)                                                \
+        bswwx_ld(W(RD), W(MS), W(DS))
+
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
@@ -17943,6 +18580,16 @@
 #define notyx_mx(MG, DG)                                                    \
         notzx_mx(W(MG), W(DG))
 
+/* bsw (G = byte-swap G), reverse byte order
+ * set-flags: no */
+
+#define bswyx_rx(RG)                                                        \
+        bswzx_rx(W(RG))
+
+#define bswyx_ld(RD, MS, DS)                                                \
+        bswzx_ld(W(RD), W(MS), W(DS))
+
+
 /* neg (G = -G)
  * set-flags: undefined (*_*), yes (*Z*) */
 
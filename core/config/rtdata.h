@@ -0,0 +1,669 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2025 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTDATA_H
+#define RT_RTDATA_H
+
+#include <string.h>
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtdata.h: SIMD data layout containers (header-only, requires C++11).
+ * Include after rtbase.h in C++ sources preparing data for ASM sections.
+ *
+ * rt_Soa<...> keeps each field in its own SIMD-aligned array (SoA), while
+ * rt_AoSoa<...> interleaves fields in SIMD-aligned blocks of tile-width
+ * elements (AoSoA). Tile width is derived from Q (maximal total-quads),
+ * thus it equals S for rt_real/rt_elem fields and R/T for rt_fp32/rt_fp64.
+ * Capacity is always kept at a whole number of tiles with padding zeroed,
+ * so that ASM loops can process full SIMD registers without tail handling.
+ *
+ * Field pointers are ready to be passed to rt_SIMD_INFOX array fields.
+ * Pointers are only stable until the next growth of the container.
+ * Memory is requested from app-provided sys_alloc/sys_free-like functions
+ * to respect address-range constraints of 64/32-bit hybrid modes (RT_ADDRESS).
+ * Field types are expected to be trivially copyable (rt_real, rt_elem, ...).
+ * If allocation fails (f_alloc returns RT_NULL) the container is left intact
+ * at its previous size and capacity, check size() after any growing call.
+ *
+ * Bulk AoS <-> SoA/AoSoA copy routines are plain C++ loops, as the common
+ * SIMD ISA has no shuffle subset to express them in ASM sections. Constant
+ * field counts and tile widths let compilers vectorize them where possible,
+ * yet wide records (8 fields) copy at 1/4 to 1/2 of memcpy bandwidth, thus
+ * convert data layouts once, outside of compute loops, not per ASM call.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+/*
+ * Alignment (in bytes) and tile width (in elements) for SIMD data layouts.
+ * Sized from Q to match SIMD structs in builds with runtime target selection.
+ */
+#define RT_DATA_ALIGN       (Q*16)
+#define RT_DATA_WIDTH(t)    (RT_DATA_ALIGN/(rt_size)sizeof(t))
+
+/*
+ * Memory allocation function types (sys_alloc/sys_free in the test).
+ */
+typedef rt_pntr (*rt_FUNC_ALLOC)(rt_size size);
+typedef rt_void (*rt_FUNC_FREE)(rt_pntr ptr, rt_size size);
+
+/*
+ * Field type selector for rt_Soa (k-th type of the parameter pack).
+ */
+template <rt_size k, typename rt_F, typename... rt_G>
+struct rt_DATA_TYPE
+{
+    typedef typename rt_DATA_TYPE<k-1, rt_G...>::type type;
+};
+
+template <typename rt_F, typename... rt_G>
+struct rt_DATA_TYPE<0, rt_F, rt_G...>
+{
+    typedef rt_F type;
+};
+
+/*
+ * Field type checker for rt_Soa AoS copies (all types of the pack are rt_F).
+ */
+template <typename rt_F, typename... rt_G>
+struct rt_DATA_SAME
+{
+    static const rt_bool value = RT_TRUE;
+};
+
+template <typename rt_F, typename rt_G, typename... rt_H>
+struct rt_DATA_SAME<rt_F, rt_G, rt_H...>
+{
+    static const rt_bool value = RT_FALSE;
+};
+
+template <typename rt_F, typename... rt_H>
+struct rt_DATA_SAME<rt_F, rt_F, rt_H...>
+{
+    static const rt_bool value = rt_DATA_SAME<rt_F, rt_H...>::value;
+};
+
+/******************************************************************************/
+/**************************   AOS <-> SOA TRANSPOSE   *************************/
+/******************************************************************************/
+
+/*
+ * Copy "num" AoS records of "rt_NF" fields from "src"
+ * to "rt_NF" separate arrays "dst" starting at element "pos".
+ */
+template <rt_size rt_NF, typename rt_F>
+rt_void copy_aos2soa(rt_F *const *dst, rt_size pos,
+                     const rt_F *src, rt_size num)
+{
+    rt_F *d[rt_NF];
+    rt_size i, k;
+
+    for (k = 0; k < rt_NF; k++)
+    {
+        d[k] = dst[k] + pos;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        for (k = 0; k < rt_NF; k++)
+        {
+            d[k][i] = src[i*rt_NF + k];
+        }
+    }
+}
+
+/*
+ * Copy "num" elements starting at "pos" from "rt_NF" separate arrays "src"
+ * to AoS records of "rt_NF" fields in "dst".
+ */
+template <rt_size rt_NF, typename rt_F>
+rt_void copy_soa2aos(rt_F *dst, const rt_F *const *src, rt_size pos,
+                     rt_size num)
+{
+    const rt_F *s[rt_NF];
+    rt_size i, k;
+
+    for (k = 0; k < rt_NF; k++)
+    {
+        s[k] = src[k] + pos;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        for (k = 0; k < rt_NF; k++)
+        {
+            dst[i*rt_NF + k] = s[k][i];
+        }
+    }
+}
+
+/*
+ * Copy "rt_W" AoS records of "rt_NF" fields from "src"
+ * to one AoSoA block "dst" (rt_NF rows of rt_W elements).
+ */
+template <rt_size rt_NF, rt_size rt_W, typename rt_F>
+rt_void copy_aos2blk(rt_F *dst, const rt_F *src)
+{
+    rt_size i, k;
+
+    for (i = 0; i < rt_W; i++)
+    {
+        for (k = 0; k < rt_NF; k++)
+        {
+            dst[k*rt_W + i] = src[i*rt_NF + k];
+        }
+    }
+}
+
+/*
+ * Copy one AoSoA block "src" (rt_NF rows of rt_W elements)
+ * to "rt_W" AoS records of "rt_NF" fields in "dst".
+ */
+template <rt_size rt_NF, rt_size rt_W, typename rt_F>
+rt_void copy_blk2aos(rt_F *dst, const rt_F *src)
+{
+    rt_size i, k;
+
+    for (i = 0; i < rt_W; i++)
+    {
+        for (k = 0; k < rt_NF; k++)
+        {
+            dst[i*rt_NF + k] = src[k*rt_W + i];
+        }
+    }
+}
+
+/******************************************************************************/
+/*********************************   SOA   ************************************/
+/******************************************************************************/
+
+/*
+ * Structure-of-arrays container, each field is stored in a separate
+ * RT_DATA_ALIGN-aligned array within a single allocation.
+ * Tile width is the widest RT_DATA_WIDTH of all fields times "mult".
+ * Growth is geometric (at least 2x), thus appending elements one by one
+ * leads to a logarithmic number of reallocations.
+ */
+template <typename... rt_F>
+class rt_Soa
+{
+/*  fields */
+
+    protected:
+
+    rt_FUNC_ALLOC       f_alloc;
+    rt_FUNC_FREE        f_free;
+
+    rt_pntr             mem;
+    rt_size             mem_size;
+
+    rt_size             num;
+    rt_size             cap;
+    rt_size             wid;
+
+    rt_pntr             ptr[sizeof...(rt_F)];
+    rt_size             len[sizeof...(rt_F)];
+
+/*  methods */
+
+    public:
+
+    rt_Soa(rt_FUNC_ALLOC f_alloc, rt_FUNC_FREE f_free,
+           rt_size num = 0, rt_size mult = 1) :
+
+        f_alloc(f_alloc), f_free(f_free),
+        mem(RT_NULL), mem_size(0), num(0), cap(0), wid(0),
+        len{(rt_size)sizeof(rt_F)...}
+    {
+        rt_size k;
+
+        for (k = 0; k < (rt_size)sizeof...(rt_F); k++)
+        {
+            ptr[k] = RT_NULL;
+            wid = RT_MAX(wid, RT_DATA_ALIGN / len[k]);
+        }
+
+        wid *= RT_MAX(mult, 1);
+
+        resize(num);
+    }
+
+   ~rt_Soa()
+    {
+        if (mem != RT_NULL)
+        {
+            f_free(mem, mem_size);
+        }
+    }
+
+    /* number of fields */
+    static rt_size fields()
+    {
+        return sizeof...(rt_F);
+    }
+
+    /* number of valid elements */
+    rt_size size() const
+    {
+        return num;
+    }
+
+    /* number of allocated elements, multiple of tile width */
+    rt_size capacity() const
+    {
+        return cap;
+    }
+
+    /* tile width in elements */
+    rt_size width() const
+    {
+        return wid;
+    }
+
+    /* number of tiles covering valid elements */
+    rt_size tiles() const
+    {
+        return (num + wid - 1) / wid;
+    }
+
+    /* aligned pointer to field "k" (valid until next growth) */
+    template <rt_size k>
+    typename rt_DATA_TYPE<k, rt_F...>::type *field()
+    {
+        return (typename rt_DATA_TYPE<k, rt_F...>::type *)ptr[k];
+    }
+
+    /* aligned pointer to field "k" as untyped array (k < fields()) */
+    rt_pntr array(rt_size k)
+    {
+        return ptr[k];
+    }
+
+    /* make room for at least "n" elements */
+    rt_void reserve(rt_size n)
+    {
+        if (n <= cap)
+        {
+            return;
+        }
+
+        rt_size c = RT_MAX(n, cap * 2);
+        c = ((c + wid - 1) / wid) * wid;
+
+        rt_size offs[sizeof...(rt_F)], k, s = 0;
+
+        for (k = 0; k < (rt_size)sizeof...(rt_F); k++)
+        {
+            offs[k] = s;
+            s += ((c * len[k] + RT_DATA_ALIGN - 1) / RT_DATA_ALIGN)
+                                                   * RT_DATA_ALIGN;
+        }
+
+        rt_pntr m = f_alloc(s + RT_DATA_ALIGN - 1);
+
+        if (m == RT_NULL)
+        {
+            return;
+        }
+
+        rt_byte *b = (rt_byte *)(((rt_word)m + RT_DATA_ALIGN - 1)
+                                        & ~((rt_word)RT_DATA_ALIGN - 1));
+
+        for (k = 0; k < (rt_size)sizeof...(rt_F); k++)
+        {
+            if (num > 0)
+            {
+                memcpy(b + offs[k], ptr[k], num * len[k]);
+            }
+            memset(b + offs[k] + num * len[k], 0, (c - num) * len[k]);
+            ptr[k] = b + offs[k];
+        }
+
+        if (mem != RT_NULL)
+        {
+            f_free(mem, mem_size);
+        }
+
+        mem = m;
+        mem_size = s + RT_DATA_ALIGN - 1;
+        cap = c;
+    }
+
+    /* set number of valid elements, new elements and padding are zeroed */
+    rt_void resize(rt_size n)
+    {
+        reserve(n);
+
+        if (n > cap)
+        {
+            return;
+        }
+
+        if (n < num)
+        {
+            rt_size k;
+
+            for (k = 0; k < (rt_size)sizeof...(rt_F); k++)
+            {
+                memset((rt_byte *)ptr[k] + n * len[k], 0, (num - n) * len[k]);
+            }
+        }
+
+        num = n;
+    }
+
+    /* append one element given all of its fields */
+    rt_void push_back(const rt_F&... v)
+    {
+        reserve(num + 1);
+
+        if (num == cap)
+        {
+            return;
+        }
+
+        rt_size k = 0;
+        rt_cell l[] = {(memcpy((rt_byte *)ptr[k] + num * len[k], &v,
+                                                   len[k]), k++, 0)...};
+        (rt_void)l;
+
+        num++;
+    }
+
+    /* append "n" AoS records, all fields must be of the same type rt_G */
+    template <typename rt_G>
+    rt_void load_aos(const rt_G *src, rt_size n)
+    {
+        static_assert(rt_DATA_SAME<rt_G, rt_F...>::value,
+                      "rt_Soa::load_aos: all fields must be of type rt_G");
+
+        rt_size p = num;
+
+        resize(num + n);
+
+        if (num != p + n)
+        {
+            return;
+        }
+
+        copy_aos2soa<sizeof...(rt_F)>((rt_G *const *)ptr, p, src, n);
+    }
+
+    /* store "n" elements from "pos" as AoS records of type rt_G fields */
+    template <typename rt_G>
+    rt_void store_aos(rt_G *dst, rt_size pos, rt_size n) const
+    {
+        static_assert(rt_DATA_SAME<rt_G, rt_F...>::value,
+                      "rt_Soa::store_aos: all fields must be of type rt_G");
+
+        copy_soa2aos<sizeof...(rt_F)>(dst, (const rt_G *const *)ptr, pos, n);
+    }
+
+    private:
+
+    rt_Soa(const rt_Soa&);
+    rt_Soa& operator=(const rt_Soa&);
+};
+
+/******************************************************************************/
+/********************************   AOSOA   ***********************************/
+/******************************************************************************/
+
+/*
+ * Array-of-structures-of-arrays container of "rt_NF" fields of type rt_F,
+ * elements are grouped in RT_DATA_ALIGN-aligned blocks of "rt_NF" rows,
+ * each row holding one field of rt_W = RT_DATA_WIDTH(rt_F)*rt_MW elements.
+ * Growth is geometric (at least 2x) in whole blocks.
+ */
+template <typename rt_F, rt_size rt_NF, rt_size rt_MW = 1>
+class rt_AoSoa
+{
+/*  fields */
+
+    protected:
+
+    rt_FUNC_ALLOC       f_alloc;
+    rt_FUNC_FREE        f_free;
+
+    rt_pntr             mem;
+    rt_size             mem_size;
+
+    rt_size             num;
+    rt_size             cap;
+
+    rt_F               *ptr;
+
+/*  methods */
+
+    public:
+
+    /* tile width (row length) in elements */
+    static rt_size width()
+    {
+        return RT_DATA_WIDTH(rt_F)*rt_MW;
+    }
+
+    /* block stride in bytes (for pointer increments in ASM loops) */
+    static rt_size stride()
+    {
+        return rt_NF*RT_DATA_ALIGN*rt_MW;
+    }
+
+    rt_AoSoa(rt_FUNC_ALLOC f_alloc, rt_FUNC_FREE f_free, rt_size num = 0) :
+
+        f_alloc(f_alloc), f_free(f_free),
+        mem(RT_NULL), mem_size(0), num(0), cap(0), ptr(RT_NULL)
+    {
+        resize(num);
+    }
+
+   ~rt_AoSoa()
+    {
+        if (mem != RT_NULL)
+        {
+            f_free(mem, mem_size);
+        }
+    }
+
+    /* number of valid elements */
+    rt_size size() const
+    {
+        return num;
+    }
+
+    /* number of allocated elements, multiple of tile width */
+    rt_size capacity() const
+    {
+        return cap;
+    }
+
+    /* number of blocks covering valid elements */
+    rt_size blocks() const
+    {
+        return (num + width() - 1) / width();
+    }
+
+    /* aligned pointer to block "b" (valid until next growth) */
+    rt_F *block(rt_size b)
+    {
+        return ptr + b * rt_NF * width();
+    }
+
+    /* aligned pointer to row of field "f" in block "b" */
+    rt_F *field(rt_size b, rt_size f)
+    {
+        return ptr + (b * rt_NF + f) * width();
+    }
+
+    /* field "f" of element "i" */
+    rt_F &at(rt_size i, rt_size f)
+    {
+        return field(i / width(), f)[i % width()];
+    }
+
+    /* make room for at least "n" elements */
+    rt_void reserve(rt_size n)
+    {
+        if (n <= cap)
+        {
+            return;
+        }
+
+        rt_size c = RT_MAX(n, cap * 2);
+        c = ((c + width() - 1) / width()) * width();
+
+        rt_size s = c / width() * stride();
+
+        rt_pntr m = f_alloc(s + RT_DATA_ALIGN - 1);
+
+        if (m == RT_NULL)
+        {
+            return;
+        }
+
+        rt_F *p = (rt_F *)(((rt_word)m + RT_DATA_ALIGN - 1)
+                                  & ~((rt_word)RT_DATA_ALIGN - 1));
+
+        rt_size h = cap / width() * stride();
+
+        if (h > 0)
+        {
+            memcpy(p, ptr, h);
+        }
+        memset((rt_byte *)p + h, 0, s - h);
+
+        if (mem != RT_NULL)
+        {
+            f_free(mem, mem_size);
+        }
+
+        mem = m;
+        mem_size = s + RT_DATA_ALIGN - 1;
+        cap = c;
+        ptr = p;
+    }
+
+    /* set number of valid elements, new elements and padding are zeroed */
+    rt_void resize(rt_size n)
+    {
+        reserve(n);
+
+        if (n > cap)
+        {
+            return;
+        }
+
+        rt_size i, k;
+
+        for (i = n; i < num; i++)
+        {
+            for (k = 0; k < rt_NF; k++)
+            {
+                at(i, k) = (rt_F)0;
+            }
+        }
+
+        num = n;
+    }
+
+    /* append one element given its "rt_NF" fields */
+    rt_void push_back(const rt_F *v)
+    {
+        reserve(num + 1);
+
+        if (num == cap)
+        {
+            return;
+        }
+
+        rt_size k;
+
+        for (k = 0; k < rt_NF; k++)
+        {
+            at(num, k) = v[k];
+        }
+
+        num++;
+    }
+
+    /* append "n" AoS records of "rt_NF" fields */
+    rt_void load_aos(const rt_F *src, rt_size n)
+    {
+        rt_size i = num, k;
+
+        resize(num + n);
+
+        if (num != i + n)
+        {
+            return;
+        }
+
+        for (; i % width() != 0 && n > 0; i++, n--, src += rt_NF)
+        {
+            for (k = 0; k < rt_NF; k++)
+            {
+                at(i, k) = src[k];
+            }
+        }
+        for (; n >= width(); i += width(), n -= width(), src += rt_NF*width())
+        {
+            copy_aos2blk<rt_NF, RT_DATA_WIDTH(rt_F)*rt_MW>(
+                                                block(i / width()), src);
+        }
+        for (; n > 0; i++, n--, src += rt_NF)
+        {
+            for (k = 0; k < rt_NF; k++)
+            {
+                at(i, k) = src[k];
+            }
+        }
+    }
+
+    /* store "n" elements from "pos" as AoS records of "rt_NF" fields */
+    rt_void store_aos(rt_F *dst, rt_size pos, rt_size n)
+    {
+        rt_size i = pos, k;
+
+        for (; i % width() != 0 && n > 0; i++, n--, dst += rt_NF)
+        {
+            for (k = 0; k < rt_NF; k++)
+            {
+                dst[k] = at(i, k);
+            }
+        }
+        for (; n >= width(); i += width(), n -= width(), dst += rt_NF*width())
+        {
+            copy_blk2aos<rt_NF, RT_DATA_WIDTH(rt_F)*rt_MW>(
+                                                dst, block(i / width()));
+        }
+        for (; n > 0; i++, n--, dst += rt_NF)
+        {
+            for (k = 0; k < rt_NF; k++)
+            {
+                dst[k] = at(i, k);
+            }
+        }
+    }
+
+    private:
+
+    rt_AoSoa(const rt_AoSoa&);
+    rt_AoSoa& operator=(const rt_AoSoa&);
+};
+
+#endif /* RT_RTDATA_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -277,6 +277,26 @@
  * definition in "core/config/rtbase.h". Immediate arguments only apply to BASE
  * instructions and don't need any additional SIMD scaling. All displacement and
  * immediate values are always unsigned within the assembler.
+ *
+ * Applications which keep their own data in SoA or AoSoA form can use container
+ * templates from "core/config/rtdata.h" (C++11), which align and pad each field
+ * to the maximal SIMD width (Q) so that ASM sections can walk the arrays
+ * in whole SIMD registers without tail handling.
+ *
+ * Batches of small matrices (3x3, 4x4) and quaternions can be processed with
+ * macros from "core/config/rtgeom.h", which work on SoA blocks of S objects
+ * (one object per SIMD lane) matching a block of rt_AoSoa<...> from rtdata.h.
+ *
+ * Register-blocked Bloom filters (one SIMD register per block) can be built
+ * and probed with macros from "core/config/rthash.h", which combine integer
+ * multiply, variable shift and compare ops into insert/probe primitives.
+ *
+ * Byte-stream coding kernels (LZ77 match length and overlapping copies) are
+ * in "core/config/rtcode.h", they work on 32-bit BASE words at arbitrary byte
+ * offsets, as SIMD loads/stores of the common subset must be aligned.
+ * Base64 and hex encode/decode translate whole SIMD vectors of characters
+ * with byte range compares (also returning a mask of valid characters),
+ * while raw bytes are regrouped into 32-bit lanes in BASE.
  */
 
 /******************************************************************************/
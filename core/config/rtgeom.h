@@ -0,0 +1,607 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2025 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTGEOM_H
+#define RT_RTGEOM_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtgeom.h: batched small-matrix, quaternion and nearest-centroid kernels
+ * (SoA, macros only).
+ * Include after rtbase.h in sources with ASM sections working on batches.
+ *
+ * Each SIMD lane holds a different object, so S objects are processed at once
+ * without any horizontal ops or shuffles. A batch block consists of fields
+ * stored as consecutive SIMD vectors (field k at GF(k) from block's base),
+ * which matches one block of rt_AoSoa<...> from rtdata.h with rt_real fields.
+ * Matrices are row-major (3x3: 9 fields, 4x4: 16 fields), vectors are (x, y, z)
+ * and quaternions are (x, y, z, w), scalar results take a single field.
+ *
+ * Block macros are named after SIMD instructions with "_mm" suffix, where
+ * MD, MS, MT (MU, MC) are BASE register addressing modes (Mesi, Mebx, ...)
+ * pointing to the block's base. Temporary SIMD registers are passed explicitly,
+ * as only 8 are available on 32-bit x86, and are listed as destroyed.
+ * Only packed mul/add/sub are used for matrix and quaternion products (no fma),
+ * so that results are consistent across targets, including fma fallbacks.
+ * Squared distances for nearest-centroid search use fmaps_rr as they only feed
+ * comparisons (check RT_SIMD_COMPAT_FMA on targets with x87 fma fallbacks).
+ *
+ * Inverses and normalization rely on rcpps_rr/rsqps_rr with the accuracy of
+ * a given target (see RT_SIMD_COMPAT_RCP/RSQ in rtconf.h). As the common SIMD
+ * subset has no transcendentals, slerp uses a polynomial approximation
+ * (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP")
+ * with coefficients set by RT_GEOM_SLERP_SET (max error about 2.0E-5).
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+/*
+ * Field displacement within a batch block (k-th SIMD vector from the base).
+ * Blocks of up to 16 fields are within native DP range for all Q values.
+ */
+#define GF(k)               DP(Q*0x010*(k))
+
+/*
+ * Fill slerp coefficients table (16 fields of S rt_real elements) for qslps_mm:
+ * u(i) = 1/(i*(2i+1)), v(i) = i/(2i+1) for i = 1..8 with last terms scaled.
+ */
+#define RT_GEOM_SLERP_MU    1.85298109240830
+
+#define RT_GEOM_SLERP_SET(__Tab__)                                          \
+    RT_SIMD_SET(((__Tab__) + 0x00*S), (rt_real)(1.0/3.0));                  \
+    RT_SIMD_SET(((__Tab__) + 0x01*S), (rt_real)(1.0/10.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x02*S), (rt_real)(1.0/21.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x03*S), (rt_real)(1.0/36.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x04*S), (rt_real)(1.0/55.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x05*S), (rt_real)(1.0/78.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x06*S), (rt_real)(1.0/105.0));                \
+    RT_SIMD_SET(((__Tab__) + 0x07*S), (rt_real)(RT_GEOM_SLERP_MU/136.0));   \
+    RT_SIMD_SET(((__Tab__) + 0x08*S), (rt_real)(1.0/3.0));                  \
+    RT_SIMD_SET(((__Tab__) + 0x09*S), (rt_real)(2.0/5.0));                  \
+    RT_SIMD_SET(((__Tab__) + 0x0A*S), (rt_real)(3.0/7.0));                  \
+    RT_SIMD_SET(((__Tab__) + 0x0B*S), (rt_real)(4.0/9.0));                  \
+    RT_SIMD_SET(((__Tab__) + 0x0C*S), (rt_real)(5.0/11.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x0D*S), (rt_real)(6.0/13.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x0E*S), (rt_real)(7.0/15.0));                 \
+    RT_SIMD_SET(((__Tab__) + 0x0F*S), (rt_real)(RT_GEOM_SLERP_MU*8.0/17.0));
+
+/* internal helpers (field-level), not for direct use */
+
+#define CF2PS(XD, XT, MS, a, b, c, d) /* XD = S[a]*S[b] - S[c]*S[d] */      \
+        movpx_ld(W(XD), W(MS), GF(a))                                       \
+        mulps_ld(W(XD), W(MS), GF(b))                                       \
+        movpx_ld(W(XT), W(MS), GF(c))                                       \
+        mulps_ld(W(XT), W(MS), GF(d))                                       \
+        subps_rr(W(XD), W(XT))
+
+#define DT3PS(XD, XT, X0, X1, X2, MT, a, b, c) /* XD = X0*T[a] +.. */       \
+        movpx_ld(W(XD), W(MT), GF(a))                                       \
+        mulps_rr(W(XD), W(X0))                                              \
+        movpx_ld(W(XT), W(MT), GF(b))                                       \
+        mulps_rr(W(XT), W(X1))                                              \
+        addps_rr(W(XD), W(XT))                                              \
+        movpx_ld(W(XT), W(MT), GF(c))                                       \
+        mulps_rr(W(XT), W(X2))                                              \
+        addps_rr(W(XD), W(XT))
+
+#define DT4PS(XD, XT, X0, X1, X2, X3, MT, a, b, c, d) /* +X3*T[d] */        \
+        DT3PS(W(XD), W(XT), W(X0), W(X1), W(X2), W(MT), a, b, c)            \
+        movpx_ld(W(XT), W(MT), GF(d))                                       \
+        mulps_rr(W(XT), W(X3))                                              \
+        addps_rr(W(XD), W(XT))
+
+#define SC3PS(XD, XT, MS, MT, a, p, b, q, c, r) /* S*T - S*T + S*T */       \
+        movpx_ld(W(XD), W(MS), GF(a))                                       \
+        mulps_ld(W(XD), W(MT), GF(p))                                       \
+        movpx_ld(W(XT), W(MS), GF(b))                                       \
+        mulps_ld(W(XT), W(MT), GF(q))                                       \
+        subps_rr(W(XD), W(XT))                                              \
+        movpx_ld(W(XT), W(MS), GF(c))                                       \
+        mulps_ld(W(XT), W(MT), GF(r))                                       \
+        addps_rr(W(XD), W(XT))
+
+#define QM4PS(XD, XT, X0, X1, X2, X3, MT, a, b, c, d, o1, o2, o3)           \
+        movpx_ld(W(XD), W(MT), GF(a))                                       \
+        mulps_rr(W(XD), W(X3))                                              \
+        movpx_ld(W(XT), W(MT), GF(b))                                       \
+        mulps_rr(W(XT), W(X0))                                              \
+        o1##ps_rr(W(XD), W(XT))                                             \
+        movpx_ld(W(XT), W(MT), GF(c))                                       \
+        mulps_rr(W(XT), W(X1))                                              \
+        o2##ps_rr(W(XD), W(XT))                                             \
+        movpx_ld(W(XT), W(MT), GF(d))                                       \
+        mulps_rr(W(XT), W(X2))                                              \
+        o3##ps_rr(W(XD), W(XT))
+
+#define SLHPS(XG, XT, XQ, XM, MC, i) /* XG = 1 + XG * b(i) */               \
+        movpx_ld(W(XT), W(MC), GF(i-1))                                     \
+        mulps_rr(W(XT), W(XQ))                                              \
+        subps_ld(W(XT), W(MC), GF(i+7))                                     \
+        mulps_rr(W(XT), W(XM))                                              \
+        mulps_rr(W(XG), W(XT))                                              \
+        addps_ld(W(XG), Mebp, inf_GPC01)
+
+/* mm3 (D = S * T), 3x3 matrices
+ * D may alias S (rows are loaded first), but not T */
+
+#define mm3ps_mm(MD, MS, MT, X0, X1, X2, X3, X4) /* destroys X0-X4 */       \
+        movpx_ld(W(X0), W(MS), GF(0))                                       \
+        movpx_ld(W(X1), W(MS), GF(1))                                       \
+        movpx_ld(W(X2), W(MS), GF(2))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 0, 3, 6)            \
+        movpx_st(W(X3), W(MD), GF(0))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 1, 4, 7)            \
+        movpx_st(W(X3), W(MD), GF(1))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 2, 5, 8)            \
+        movpx_st(W(X3), W(MD), GF(2))                                       \
+        movpx_ld(W(X0), W(MS), GF(3))                                       \
+        movpx_ld(W(X1), W(MS), GF(4))                                       \
+        movpx_ld(W(X2), W(MS), GF(5))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 0, 3, 6)            \
+        movpx_st(W(X3), W(MD), GF(3))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 1, 4, 7)            \
+        movpx_st(W(X3), W(MD), GF(4))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 2, 5, 8)            \
+        movpx_st(W(X3), W(MD), GF(5))                                       \
+        movpx_ld(W(X0), W(MS), GF(6))                                       \
+        movpx_ld(W(X1), W(MS), GF(7))                                       \
+        movpx_ld(W(X2), W(MS), GF(8))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 0, 3, 6)            \
+        movpx_st(W(X3), W(MD), GF(6))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 1, 4, 7)            \
+        movpx_st(W(X3), W(MD), GF(7))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MT), 2, 5, 8)            \
+        movpx_st(W(X3), W(MD), GF(8))
+
+/* mm4 (D = S * T), 4x4 matrices
+ * D may alias S (rows are loaded first), but not T */
+
+#define mm4ps_mm(MD, MS, MT, X0, X1, X2, X3, X4, X5) /* destroys X0-X5 */   \
+        movpx_ld(W(X0), W(MS), GF(0))                                       \
+        movpx_ld(W(X1), W(MS), GF(1))                                       \
+        movpx_ld(W(X2), W(MS), GF(2))                                       \
+        movpx_ld(W(X3), W(MS), GF(3))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                0, 4, 8, 12)                                \
+        movpx_st(W(X4), W(MD), GF(0))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                1, 5, 9, 13)                                \
+        movpx_st(W(X4), W(MD), GF(1))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                2, 6, 10, 14)                               \
+        movpx_st(W(X4), W(MD), GF(2))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                3, 7, 11, 15)                               \
+        movpx_st(W(X4), W(MD), GF(3))                                       \
+        movpx_ld(W(X0), W(MS), GF(4))                                       \
+        movpx_ld(W(X1), W(MS), GF(5))                                       \
+        movpx_ld(W(X2), W(MS), GF(6))                                       \
+        movpx_ld(W(X3), W(MS), GF(7))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                0, 4, 8, 12)                                \
+        movpx_st(W(X4), W(MD), GF(4))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                1, 5, 9, 13)                                \
+        movpx_st(W(X4), W(MD), GF(5))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                2, 6, 10, 14)                               \
+        movpx_st(W(X4), W(MD), GF(6))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                3, 7, 11, 15)                               \
+        movpx_st(W(X4), W(MD), GF(7))                                       \
+        movpx_ld(W(X0), W(MS), GF(8))                                       \
+        movpx_ld(W(X1), W(MS), GF(9))                                       \
+        movpx_ld(W(X2), W(MS), GF(10))                                      \
+        movpx_ld(W(X3), W(MS), GF(11))                                      \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                0, 4, 8, 12)                                \
+        movpx_st(W(X4), W(MD), GF(8))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                1, 5, 9, 13)                                \
+        movpx_st(W(X4), W(MD), GF(9))                                       \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                2, 6, 10, 14)                               \
+        movpx_st(W(X4), W(MD), GF(10))                                      \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                3, 7, 11, 15)                               \
+        movpx_st(W(X4), W(MD), GF(11))                                      \
+        movpx_ld(W(X0), W(MS), GF(12))                                      \
+        movpx_ld(W(X1), W(MS), GF(13))                                      \
+        movpx_ld(W(X2), W(MS), GF(14))                                      \
+        movpx_ld(W(X3), W(MS), GF(15))                                      \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                0, 4, 8, 12)                                \
+        movpx_st(W(X4), W(MD), GF(12))                                      \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                1, 5, 9, 13)                                \
+        movpx_st(W(X4), W(MD), GF(13))                                      \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                2, 6, 10, 14)                               \
+        movpx_st(W(X4), W(MD), GF(14))                                      \
+        DT4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                3, 7, 11, 15)                               \
+        movpx_st(W(X4), W(MD), GF(15))
+
+/* tr3 (D = S * T), 3x3 matrix S, 3d vector T
+ * D may alias T (vector is loaded first), but not S */
+
+#define tr3ps_mm(MD, MS, MT, X0, X1, X2, X3, X4) /* destroys X0-X4 */       \
+        movpx_ld(W(X0), W(MT), GF(0))                                       \
+        movpx_ld(W(X1), W(MT), GF(1))                                       \
+        movpx_ld(W(X2), W(MT), GF(2))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MS), 0, 1, 2)            \
+        movpx_st(W(X3), W(MD), GF(0))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MS), 3, 4, 5)            \
+        movpx_st(W(X3), W(MD), GF(1))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MS), 6, 7, 8)            \
+        movpx_st(W(X3), W(MD), GF(2))
+
+/* tr4 (D = S * [T, 1]), 4x4 affine matrix S (last row ignored), 3d point T
+ * D may alias T (point is loaded first), but not S */
+
+#define tr4ps_mm(MD, MS, MT, X0, X1, X2, X3, X4) /* destroys X0-X4 */       \
+        movpx_ld(W(X0), W(MT), GF(0))                                       \
+        movpx_ld(W(X1), W(MT), GF(1))                                       \
+        movpx_ld(W(X2), W(MT), GF(2))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MS), 0, 1, 2)            \
+        addps_ld(W(X3), W(MS), GF(3))                                       \
+        movpx_st(W(X3), W(MD), GF(0))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MS), 4, 5, 6)            \
+        addps_ld(W(X3), W(MS), GF(7))                                       \
+        movpx_st(W(X3), W(MD), GF(1))                                       \
+        DT3PS(W(X3), W(X4), W(X0), W(X1), W(X2), W(MS), 8, 9, 10)           \
+        addps_ld(W(X3), W(MS), GF(11))                                      \
+        movpx_st(W(X3), W(MD), GF(2))
+
+/* dt3 (D = det S), 3x3 matrix S, D is a single field */
+
+#define dt3ps_mm(MD, MS, X0, X1, X2) /* destroys X0-X2 */                   \
+        CF2PS(W(X0), W(X2), W(MS), 4, 8, 5, 7)                              \
+        mulps_ld(W(X0), W(MS), GF(0))                                       \
+        CF2PS(W(X1), W(X2), W(MS), 5, 6, 3, 8)                              \
+        mulps_ld(W(X1), W(MS), GF(1))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        CF2PS(W(X1), W(X2), W(MS), 3, 7, 4, 6)                              \
+        mulps_ld(W(X1), W(MS), GF(2))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_st(W(X0), W(MD), GF(0))
+
+/* iv3 (D = S^-1), 3x3 matrix S via cofactors and rcpps_rr (1.0 / det S)
+ * accuracy follows rcpps_rr on a given target, D must not alias S */
+
+#define iv3ps_mm(MD, MS, X0, X1, X2, X3, X4) /* destroys X0-X4 */           \
+        CF2PS(W(X0), W(X3), W(MS), 4, 8, 5, 7)                              \
+        CF2PS(W(X1), W(X3), W(MS), 5, 6, 3, 8)                              \
+        CF2PS(W(X2), W(X3), W(MS), 3, 7, 4, 6)                              \
+        movpx_ld(W(X3), W(MS), GF(0))                                       \
+        mulps_rr(W(X3), W(X0))                                              \
+        movpx_ld(W(X4), W(MS), GF(1))                                       \
+        mulps_rr(W(X4), W(X1))                                              \
+        addps_rr(W(X3), W(X4))                                              \
+        movpx_ld(W(X4), W(MS), GF(2))                                       \
+        mulps_rr(W(X4), W(X2))                                              \
+        addps_rr(W(X3), W(X4))                                              \
+        rcpps_rr(W(X4), W(X3)) /* destroys X3 */                            \
+        mulps_rr(W(X0), W(X4))                                              \
+        movpx_st(W(X0), W(MD), GF(0))                                       \
+        mulps_rr(W(X1), W(X4))                                              \
+        movpx_st(W(X1), W(MD), GF(3))                                       \
+        mulps_rr(W(X2), W(X4))                                              \
+        movpx_st(W(X2), W(MD), GF(6))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 2, 7, 1, 8)                              \
+        mulps_rr(W(X0), W(X4))                                              \
+        movpx_st(W(X0), W(MD), GF(1))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 1, 5, 2, 4)                              \
+        mulps_rr(W(X0), W(X4))                                              \
+        movpx_st(W(X0), W(MD), GF(2))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 0, 8, 2, 6)                              \
+        mulps_rr(W(X0), W(X4))                                              \
+        movpx_st(W(X0), W(MD), GF(4))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 2, 3, 0, 5)                              \
+        mulps_rr(W(X0), W(X4))                                              \
+        movpx_st(W(X0), W(MD), GF(5))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 1, 6, 0, 7)                              \
+        mulps_rr(W(X0), W(X4))                                              \
+        movpx_st(W(X0), W(MD), GF(7))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 0, 4, 1, 3)                              \
+        mulps_rr(W(X0), W(X4))                                              \
+        movpx_st(W(X0), W(MD), GF(8))
+
+/* dt4 (D = det S), 4x4 matrix S, D is a single field */
+
+#define dt4ps_mm(MD, MS, X0, X1, X2, X3) /* destroys X0-X3 */               \
+        CF2PS(W(X0), W(X3), W(MS), 0, 5, 4, 1)                              \
+        CF2PS(W(X2), W(X3), W(MS), 10, 15, 14, 11)                          \
+        mulps_rr(W(X0), W(X2))                                              \
+        CF2PS(W(X1), W(X3), W(MS), 0, 6, 4, 2)                              \
+        CF2PS(W(X2), W(X3), W(MS), 9, 15, 13, 11)                           \
+        mulps_rr(W(X1), W(X2))                                              \
+        subps_rr(W(X0), W(X1))                                              \
+        CF2PS(W(X1), W(X3), W(MS), 0, 7, 4, 3)                              \
+        CF2PS(W(X2), W(X3), W(MS), 9, 14, 13, 10)                           \
+        mulps_rr(W(X1), W(X2))                                              \
+        addps_rr(W(X0), W(X1))                                              \
+        CF2PS(W(X1), W(X3), W(MS), 1, 6, 5, 2)                              \
+        CF2PS(W(X2), W(X3), W(MS), 8, 15, 12, 11)                           \
+        mulps_rr(W(X1), W(X2))                                              \
+        addps_rr(W(X0), W(X1))                                              \
+        CF2PS(W(X1), W(X3), W(MS), 1, 7, 5, 3)                              \
+        CF2PS(W(X2), W(X3), W(MS), 8, 14, 12, 10)                           \
+        mulps_rr(W(X1), W(X2))                                              \
+        subps_rr(W(X0), W(X1))                                              \
+        CF2PS(W(X1), W(X3), W(MS), 2, 7, 6, 3)                              \
+        CF2PS(W(X2), W(X3), W(MS), 8, 13, 12, 9)                            \
+        mulps_rr(W(X1), W(X2))                                              \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_st(W(X0), W(MD), GF(0))
+
+/* iv4 (D = S^-1), 4x4 matrix S via 2x2 minors and rcpps_rr (1.0 / det S)
+ * T is a scratch block of 12 fields for minors (6 upper, 6 lower rows)
+ * accuracy follows rcpps_rr on a given target, D must not alias S or T */
+
+#define iv4ps_mm(MD, MS, MT, X0, X1, X2, X3) /* destroys X0-X3 */           \
+        CF2PS(W(X0), W(X1), W(MS), 0, 5, 4, 1)                              \
+        movpx_st(W(X0), W(MT), GF(0))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 0, 6, 4, 2)                              \
+        movpx_st(W(X0), W(MT), GF(1))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 0, 7, 4, 3)                              \
+        movpx_st(W(X0), W(MT), GF(2))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 1, 6, 5, 2)                              \
+        movpx_st(W(X0), W(MT), GF(3))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 1, 7, 5, 3)                              \
+        movpx_st(W(X0), W(MT), GF(4))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 2, 7, 6, 3)                              \
+        movpx_st(W(X0), W(MT), GF(5))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 8, 13, 12, 9)                            \
+        movpx_st(W(X0), W(MT), GF(6))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 8, 14, 12, 10)                           \
+        movpx_st(W(X0), W(MT), GF(7))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 8, 15, 12, 11)                           \
+        movpx_st(W(X0), W(MT), GF(8))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 9, 14, 13, 10)                           \
+        movpx_st(W(X0), W(MT), GF(9))                                       \
+        CF2PS(W(X0), W(X1), W(MS), 9, 15, 13, 11)                           \
+        movpx_st(W(X0), W(MT), GF(10))                                      \
+        CF2PS(W(X0), W(X1), W(MS), 10, 15, 14, 11)                          \
+        movpx_st(W(X0), W(MT), GF(11))                                      \
+        movpx_ld(W(X0), W(MT), GF(0))                                       \
+        mulps_ld(W(X0), W(MT), GF(11))                                      \
+        movpx_ld(W(X1), W(MT), GF(1))                                       \
+        mulps_ld(W(X1), W(MT), GF(10))                                      \
+        subps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MT), GF(2))                                       \
+        mulps_ld(W(X1), W(MT), GF(9))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MT), GF(3))                                       \
+        mulps_ld(W(X1), W(MT), GF(8))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MT), GF(4))                                       \
+        mulps_ld(W(X1), W(MT), GF(7))                                       \
+        subps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MT), GF(5))                                       \
+        mulps_ld(W(X1), W(MT), GF(6))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        rcpps_rr(W(X2), W(X0)) /* destroys X0 */                            \
+        xorpx_rr(W(X3), W(X3))                                              \
+        subps_rr(W(X3), W(X2))                                              \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 5, 11, 6, 10, 7, 9)               \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(0))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 1, 11, 2, 10, 3, 9)               \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(1))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 13, 5, 14, 4, 15, 3)              \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(2))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 9, 5, 10, 4, 11, 3)               \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(3))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 4, 11, 6, 8, 7, 7)                \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(4))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 0, 11, 2, 8, 3, 7)                \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(5))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 12, 5, 14, 2, 15, 1)              \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(6))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 8, 5, 10, 2, 11, 1)               \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(7))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 4, 10, 5, 8, 7, 6)                \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(8))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 0, 10, 1, 8, 3, 6)                \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(9))                                       \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 12, 4, 13, 2, 15, 0)              \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(10))                                      \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 8, 4, 9, 2, 11, 0)                \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(11))                                      \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 4, 9, 5, 7, 6, 6)                 \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(12))                                      \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 0, 9, 1, 7, 2, 6)                 \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(13))                                      \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 12, 3, 13, 1, 14, 0)              \
+        mulps_rr(W(X0), W(X3))                                              \
+        movpx_st(W(X0), W(MD), GF(14))                                      \
+        SC3PS(W(X0), W(X1), W(MS), W(MT), 8, 3, 9, 1, 10, 0)                \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(15))
+
+/* qml (D = S * T), quaternions (x, y, z, w)
+ * D may alias S (it is loaded first), but not T */
+
+#define qmlps_mm(MD, MS, MT, X0, X1, X2, X3, X4, X5) /* destroys X0-X5 */   \
+        movpx_ld(W(X0), W(MS), GF(0))                                       \
+        movpx_ld(W(X1), W(MS), GF(1))                                       \
+        movpx_ld(W(X2), W(MS), GF(2))                                       \
+        movpx_ld(W(X3), W(MS), GF(3))                                       \
+        QM4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                0, 3, 2, 1, add, add, sub)                  \
+        movpx_st(W(X4), W(MD), GF(0))                                       \
+        QM4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                1, 2, 3, 0, sub, add, add)                  \
+        movpx_st(W(X4), W(MD), GF(1))                                       \
+        QM4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                2, 1, 0, 3, add, sub, add)                  \
+        movpx_st(W(X4), W(MD), GF(2))                                       \
+        QM4PS(W(X4), W(X5), W(X0), W(X1), W(X2), W(X3), W(MT),              \
+                                3, 0, 1, 2, sub, sub, sub)                  \
+        movpx_st(W(X4), W(MD), GF(3))
+
+/* qnr (D = S / |S|), quaternions (x, y, z, w) via rsqps_rr
+ * accuracy follows rsqps_rr on a given target, D may alias S */
+
+#define qnrps_mm(MD, MS, X0, X1, X2) /* destroys X0-X2 */                   \
+        movpx_ld(W(X0), W(MS), GF(0))                                       \
+        mulps_rr(W(X0), W(X0))                                              \
+        movpx_ld(W(X1), W(MS), GF(1))                                       \
+        mulps_rr(W(X1), W(X1))                                              \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MS), GF(2))                                       \
+        mulps_rr(W(X1), W(X1))                                              \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MS), GF(3))                                       \
+        mulps_rr(W(X1), W(X1))                                              \
+        addps_rr(W(X0), W(X1))                                              \
+        rsqps_rr(W(X2), W(X0)) /* destroys X0 */                            \
+        movpx_ld(W(X0), W(MS), GF(0))                                       \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(0))                                       \
+        movpx_ld(W(X0), W(MS), GF(1))                                       \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(1))                                       \
+        movpx_ld(W(X0), W(MS), GF(2))                                       \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(2))                                       \
+        movpx_ld(W(X0), W(MS), GF(3))                                       \
+        mulps_rr(W(X0), W(X2))                                              \
+        movpx_st(W(X0), W(MD), GF(3))
+
+/* qsl (D = slerp(S, T, U)), unit quaternions (x, y, z, w), U is a single
+ * field with t in [0, 1], C is a table of 16 fields from RT_GEOM_SLERP_SET
+ * takes the shorter arc (T is negated if S.T < 0), result isn't normalized
+ * D may alias S or T, uses Mebp (inf_GPC01, inf_GPC06) as in ASM sections */
+
+#define qslps_mm(MD, MS, MT, MU, MC, X0, X1, X2, X3, X4, X5, X6)            \
+        movpx_ld(W(X0), W(MS), GF(0))                                       \
+        mulps_ld(W(X0), W(MT), GF(0))                                       \
+        movpx_ld(W(X1), W(MS), GF(1))                                       \
+        mulps_ld(W(X1), W(MT), GF(1))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MS), GF(2))                                       \
+        mulps_ld(W(X1), W(MT), GF(2))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), W(MS), GF(3))                                       \
+        mulps_ld(W(X1), W(MT), GF(3))                                       \
+        addps_rr(W(X0), W(X1))                                              \
+        movpx_ld(W(X1), Mebp, inf_GPC06)                                    \
+        andpx_rr(W(X1), W(X0))                                              \
+        xorpx_rr(W(X0), W(X1))                                              \
+        subps_ld(W(X0), Mebp, inf_GPC01)                                    \
+        movpx_ld(W(X2), W(MU), GF(0))                                       \
+        movpx_ld(W(X4), Mebp, inf_GPC01)                                    \
+        subps_rr(W(X4), W(X2))                                              \
+        movpx_rr(W(X3), W(X2))                                              \
+        mulps_rr(W(X3), W(X2))                                              \
+        movpx_ld(W(X5), W(MC), GF(7))                                       \
+        mulps_rr(W(X5), W(X3))                                              \
+        subps_ld(W(X5), W(MC), GF(15))                                      \
+        mulps_rr(W(X5), W(X0))                                              \
+        addps_ld(W(X5), Mebp, inf_GPC01)                                    \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 7)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 6)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 5)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 4)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 3)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 2)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 1)                         \
+        mulps_rr(W(X2), W(X5))                                              \
+        xorpx_rr(W(X2), W(X1))                                              \
+        movpx_rr(W(X3), W(X4))                                              \
+        mulps_rr(W(X3), W(X4))                                              \
+        movpx_ld(W(X5), W(MC), GF(7))                                       \
+        mulps_rr(W(X5), W(X3))                                              \
+        subps_ld(W(X5), W(MC), GF(15))                                      \
+        mulps_rr(W(X5), W(X0))                                              \
+        addps_ld(W(X5), Mebp, inf_GPC01)                                    \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 7)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 6)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 5)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 4)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 3)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 2)                         \
+        SLHPS(W(X5), W(X6), W(X3), W(X0), W(MC), 1)                         \
+        mulps_rr(W(X4), W(X5))                                              \
+        movpx_ld(W(X5), W(MS), GF(0))                                       \
+        mulps_rr(W(X5), W(X4))                                              \
+        movpx_ld(W(X6), W(MT), GF(0))                                       \
+        mulps_rr(W(X6), W(X2))                                              \
+        addps_rr(W(X5), W(X6))                                              \
+        movpx_st(W(X5), W(MD), GF(0))                                       \
+        movpx_ld(W(X5), W(MS), GF(1))                                       \
+        mulps_rr(W(X5), W(X4))                                              \
+        movpx_ld(W(X6), W(MT), GF(1))                                       \
+        mulps_rr(W(X6), W(X2))                                              \
+        addps_rr(W(X5), W(X6))                                              \
+        movpx_st(W(X5), W(MD), GF(1))                                       \
+        movpx_ld(W(X5), W(MS), GF(2))                                       \
+        mulps_rr(W(X5), W(X4))                                              \
+        movpx_ld(W(X6), W(MT), GF(2))                                       \
+        mulps_rr(W(X6), W(X2))                                              \
+        addps_rr(W(X5), W(X6))                                              \
+        movpx_st(W(X5), W(MD), GF(2))                                       \
+        movpx_ld(W(X5), W(MS), GF(3))                                       \
+        mulps_rr(W(X5), W(X4))                                              \
+        movpx_ld(W(X6), W(MT), GF(3))                                       \
+        mulps_rr(W(X6), W(X2))                                              \
+        addps_rr(W(X5), W(X6))                                              \
+        movpx_st(W(X5), W(MD), GF(3))
+
+/* sd3 (D = |X - S|^2), 3d points X0, X1, X2 (registers), S is a 3d vector
+ * usually a centroid broadcast to all lanes (each field holds S equal values) */
+
+#define sd3ps_ld(XD, XT, X0, X1, X2, MS) /* destroys XT */                  \
+        movpx_rr(W(XD), W(X0))                                              \
+        subps_ld(W(XD), W(MS), GF(0))                                       \
+        mulps_rr(W(XD), W(XD))                                              \
+        movpx_rr(W(XT), W(X1))                                              \
+        subps_ld(W(XT), W(MS), GF(1))                                       \
+        fmaps_rr(W(XD), W(XT), W(XT))                                       \
+        movpx_rr(W(XT), W(X2))                                              \
+        subps_ld(W(XT), W(MS), GF(2))                                       \
+        fmaps_rr(W(XD), W(XT), W(XT))
+
+/* amn (G = min(G, S), I = S < G ? K : I), running minimum with index per lane
+ * indices are kept as floating point values (exact up to 2^24 for fp32),
+ * ties keep the previous (lower) index, convert with cvzps_rr when done */
+
+#define amnps_rr(XG, XI, XS, XK, XT) /* destroys XS, XT */                  \
+        movpx_rr(W(XT), W(XS))                                              \
+        cltps_rr(W(XT), W(XG))                                              \
+        minps_rr(W(XG), W(XS))                                              \
+        movpx_rr(W(XS), W(XK))                                              \
+        xorpx_rr(W(XS), W(XI))                                              \
+        andpx_rr(W(XS), W(XT))                                              \
+        xorpx_rr(W(XI), W(XS))
+
+#endif /* RT_RTGEOM_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
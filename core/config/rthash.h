@@ -0,0 +1,169 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2025 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTHASH_H
+#define RT_RTHASH_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rthash.h: register-blocked Bloom filter kernels (macros only).
+ * Include after rtbase.h in sources with ASM sections probing key sets.
+ *
+ * The filter is an array of blocks, each block is one SIMD vector of S elements
+ * (RT_SIMD_WIDTH wide), so that both insert and probe take a single load/store.
+ * A key sets exactly one bit in every lane of its block (split-block layout):
+ * bit index in lane i is the top RT_BLOOM_LOG bits of (h * salt[i]),
+ * where h is the key's hash and salts are distinct odd constants.
+ * Block index is taken from the top bits of h by the caller (BASE shift).
+ * Keys are rt_elem integers, hashes are computed for S keys at once (vertical),
+ * with all arithmetic modulo element size, so that C/C++ can match it exactly.
+ *
+ * Constants table (RT_BLOOM_FLD fields of S elements) set by RT_BLOOM_SET:
+ * field 0 - ones, field 1 - hash multiplier, field 2 - per-lane salts.
+ * As the common SIMD subset has no broadcast or shuffle instructions,
+ * a single key's hash is replicated to all lanes with S BASE stores (blbyx_st)
+ * before deriving its block mask (blmpx_ld). Broadcast hashes of S keys
+ * into S separate scratch vectors first, then derive masks in a second pass,
+ * as loading a vector right after its element-sized stores stalls
+ * on store-to-load forwarding (several times slower on x86).
+ *
+ * Probe result is a full-lane mask if all bits are set, check with mkjpx_rx.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#if   RT_ELEMENT == 32
+
+#define RT_BLOOM_LOG        5 /* log2 of bits in one lane */
+#define RT_BLOOM_MUL        0x5BD1E995
+
+#elif RT_ELEMENT == 64
+
+#define RT_BLOOM_LOG        6 /* log2 of bits in one lane */
+#define RT_BLOOM_MUL        ULL(0xC6A4A7935BD1E995)
+
+#endif /* RT_ELEMENT */
+
+#define RT_BLOOM_FLD        3 /* fields in constants table */
+
+/*
+ * Fill constants table (RT_BLOOM_FLD fields of S rt_elem elements),
+ * salt for lane i is hash(i + 1) | 1 (as in hshpx_ld), as plain multiples
+ * of a single constant would make bit positions correlated across lanes.
+ */
+#define RT_BLOOM_SET(__Tab__)                                               \
+    {                                                                       \
+        rt_si32 __i;                                                        \
+        rt_uelm __h;                                                        \
+        for (__i = 0; __i < S; __i++)                                       \
+        {                                                                   \
+            __h = (rt_uelm)(__i + 1) * (rt_uelm)RT_BLOOM_MUL;               \
+            __h ^= __h >> (RT_ELEMENT/2-1);                                 \
+            __h *= (rt_uelm)RT_BLOOM_MUL;                                   \
+            (__Tab__)[0x00*S + __i] = 1;                                    \
+            (__Tab__)[0x01*S + __i] = (rt_elem)RT_BLOOM_MUL;                \
+            (__Tab__)[0x02*S + __i] = (rt_elem)(__h | 1);                   \
+        }                                                                   \
+    }
+
+/* internal helpers (unrolled broadcast stores), not for direct use */
+
+#define BLB01(RS, MD, k)                                                    \
+        movyx_st(W(RS), W(MD), DP(0x004*L*(k)))
+
+#define BLB02(RS, MD, k)                                                    \
+        BLB01(W(RS), W(MD), (k)+0x00)                                       \
+        BLB01(W(RS), W(MD), (k)+0x01)
+
+#define BLB04(RS, MD, k)                                                    \
+        BLB02(W(RS), W(MD), (k)+0x00)                                       \
+        BLB02(W(RS), W(MD), (k)+0x02)
+
+#define BLB08(RS, MD, k)                                                    \
+        BLB04(W(RS), W(MD), (k)+0x00)                                       \
+        BLB04(W(RS), W(MD), (k)+0x04)
+
+#define BLB16(RS, MD, k)                                                    \
+        BLB08(W(RS), W(MD), (k)+0x00)                                       \
+        BLB08(W(RS), W(MD), (k)+0x08)
+
+#define BLB32(RS, MD, k)                                                    \
+        BLB16(W(RS), W(MD), (k)+0x00)                                       \
+        BLB16(W(RS), W(MD), (k)+0x10)
+
+#define BLB64(RS, MD, k)                                                    \
+        BLB32(W(RS), W(MD), (k)+0x00)                                       \
+        BLB32(W(RS), W(MD), (k)+0x20)
+
+/* hsh (G = hash(G)), lane-wise: h = k*M, h ^= h >> (E/2-1), h *= M
+ * C is the constants table */
+
+#define hshpx_ld(XG, XT, MC) /* destroys XT */                              \
+        mulpx_ld(W(XG), W(MC), DP(Q*0x010))                                 \
+        movpx_rr(W(XT), W(XG))                                              \
+        shrpx_ri(W(XT), IB(RT_ELEMENT/2-1))                                 \
+        xorpx_rr(W(XG), W(XT))                                              \
+        mulpx_ld(W(XG), W(MC), DP(Q*0x010))
+
+/* blb (broadcast element-sized BASE register S to SIMD vector at D) */
+
+#if   S == 64
+#define blbyx_st(RS, MD)                                                    \
+        BLB64(W(RS), W(MD), 0x00)
+#elif S == 32
+#define blbyx_st(RS, MD)                                                    \
+        BLB32(W(RS), W(MD), 0x00)
+#elif S == 16
+#define blbyx_st(RS, MD)                                                    \
+        BLB16(W(RS), W(MD), 0x00)
+#elif S == 8
+#define blbyx_st(RS, MD)                                                    \
+        BLB08(W(RS), W(MD), 0x00)
+#elif S == 4
+#define blbyx_st(RS, MD)                                                    \
+        BLB04(W(RS), W(MD), 0x00)
+#elif S == 2
+#define blbyx_st(RS, MD)                                                    \
+        BLB02(W(RS), W(MD), 0x00)
+#endif /* S */
+
+/* blm (D = block mask), one bit per lane for hash broadcast at S
+ * mask lane i = 1 << ((h * salt[i]) >> (RT_ELEMENT - RT_BLOOM_LOG))
+ * C is the constants table */
+
+#define blmpx_ld(XD, XT, MC, MS, DS) /* destroys XT */                      \
+        movpx_ld(W(XT), W(MS), W(DS))                                       \
+        mulpx_ld(W(XT), W(MC), DP(Q*0x020))                                 \
+        shrpx_ri(W(XT), IB(RT_ELEMENT-RT_BLOOM_LOG))                        \
+        movpx_ld(W(XD), W(MC), DP(Q*0x000))                                 \
+        svlpx_rr(W(XD), W(XT))
+
+/* bls (D |= S), insert block mask S into block at D, destroys S */
+
+#define blspx_st(XS, MD, DD)                                                \
+        orrpx_ld(W(XS), W(MD), W(DD))                                       \
+        movpx_st(W(XS), W(MD), W(DD))
+
+/* blt (D = (S & block) == S), probe block mask S against block at MS,
+ * all lanes are full if the key may be present (check with mkjpx_rx) */
+
+#define bltpx_ld(XD, XS, MS, DS)                                            \
+        movpx_ld(W(XD), W(MS), W(DS))                                       \
+        andpx_rr(W(XD), W(XS))                                              \
+        ceqpx_rr(W(XD), W(XS))
+
+#endif /* RT_RTHASH_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -54,6 +54,9 @@ simd_test_a32:
 # For 128-bit ARMv8.2 build use (replace): RT_128=8 (adds new fp16 ops) (15 rs)
 # For 256-bit NEON build use (replace): RT_256=1            (15 SIMD reg-pairs)
 # For 256-bit ARMv8.2 build use (replace): RT_256=2 (adds new fp16 ops) (15 rp)
+# For 16 SIMD reg-pairs on NEON (RT_256=1,2) add: -DRT_SIMD_COMPAT_XMM=0
+# (temps are then spilled to Info around load-op forms, slightly slower)
+# To interleave halves of reg-pairs in composite ops add: -DRT_SIMD_INTERLEAVE=1
 
 # For 256-bit  SVEx1 build use (replace): RT_256=4          (30 SIMD registers)
 # For 512-bit  SVEx2 build use (replace): RT_512=1          (15 SIMD reg-pairs)
@@ -64,5 +67,13 @@ simd_test_a32:
 # For 2048-bit SVEx1 build use (replace): RT_2K8_R8=4       (15 SIMD registers)
 # The last two slots are artificially reg-limited for compatibility with AVX512
 
+# For 256-bit  SVE2x1 build use (replace): RT_256=8         (30 SIMD registers)
+# For 512-bit  SVE2x1 build use (replace): RT_512=8         (30 SIMD registers)
+# For 1024-bit SVE2x1 build use (replace): RT_1K4=8         (30 SIMD registers)
+# For 2048-bit SVE2x1 build use (replace): RT_2K8_R8=8      (15 SIMD registers)
+# SVE2 slots are selected at runtime if ID_AA64ZFR0_EL1 reports SVE2 support,
+# test them with qemu-aarch64 -cpu max (same sve-max-vq values as for SVE)
+# SVE2 slots differ from SVE only in 3-operand MUL, no SVE2 for reg-pairs
+
 # 32-bit ABI hasn't been fully tested yet due to lack of available libs,
 # check out 64/32-bit (ptr/adr) hybrid mode for 64-bit ABI in simd_make_a64.mk
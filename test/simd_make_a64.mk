@@ -201,6 +201,9 @@ simd_test.a64f64sve:
 # For 128-bit ARMv8.2 build use (replace): RT_128=8 (adds new fp16 ops) (15 rs)
 # For 256-bit NEON build use (replace): RT_256=1            (15 SIMD reg-pairs)
 # For 256-bit ARMv8.2 build use (replace): RT_256=2 (adds new fp16 ops) (15 rp)
+# For 16 SIMD reg-pairs on NEON (RT_256=1,2) add: -DRT_SIMD_COMPAT_XMM=0
+# (temps are then spilled to Info around load-op forms, slightly slower)
+# To interleave halves of reg-pairs in composite ops add: -DRT_SIMD_INTERLEAVE=1
 
 # For 256-bit  SVEx1 build use (replace): RT_256=4          (30 SIMD registers)
 # For 512-bit  SVEx2 build use (replace): RT_512=1          (15 SIMD reg-pairs)
@@ -211,6 +214,14 @@ simd_test.a64f64sve:
 # For 2048-bit SVEx1 build use (replace): RT_2K8_R8=4       (15 SIMD registers)
 # The last two slots are artificially reg-limited for compatibility with AVX512
 
+# For 256-bit  SVE2x1 build use (replace): RT_256=8         (30 SIMD registers)
+# For 512-bit  SVE2x1 build use (replace): RT_512=8         (30 SIMD registers)
+# For 1024-bit SVE2x1 build use (replace): RT_1K4=8         (30 SIMD registers)
+# For 2048-bit SVE2x1 build use (replace): RT_2K8_R8=8      (15 SIMD registers)
+# SVE2 slots are selected at runtime if ID_AA64ZFR0_EL1 reports SVE2 support,
+# test them with qemu-aarch64 -cpu max (same sve-max-vq values as for SVE)
+# SVE2 slots differ from SVE only in 3-operand MUL, no SVE2 for reg-pairs
+
 # 64/32-bit (ptr/adr) hybrid mode is compatible with native 64-bit ABI,
 # use (replace): RT_ADDRESS=32, rename the binary to simd_test.a64_**
 # 64-bit packed SIMD mode (fp64/int64) is supported on 64-bit targets,
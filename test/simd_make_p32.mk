@@ -80,6 +80,7 @@ simd_test_p32Bp9:
 # For 128-bit VSX2 build use (replace): RT_128=1 RT_SIMD_COMPAT_PW8=1 (30 regs)
 # For 128-bit VSX3 build use (replace): RT_128=2            (30 SIMD registers)
 # For 128-bit VMX  build use (replace): RT_128=4 RT_SIMD_COMPAT_VSX=0 (15 regs)
+# Add RT_SIMD_COMPAT_XMM=0 to 128-bit VMX build to expose all 16 SIMD regs
 
 # For 256-bit VMX  build use (replace): RT_256_R8=4 RT_SIMD_COMPAT_VSX=0 (8 rp)
 # For 256-bit VSX1 build use (replace): RT_256=1            (15 SIMD reg-pairs)
@@ -92,3 +93,4 @@ simd_test_p32Bp9:
 # For 512-bit VSX1 build use (replace): RT_512=1 (<=test29) (15 SIMD reg-quads)
 # For 512-bit VSX2 build use (replace): RT_512=1 RT_SIMD_COMPAT_PW8=1   (15 rq)
 # For 512-bit VSX3 build use (replace): RT_512=2 (<=test29) (15 SIMD reg-quads)
+# To interleave halves of reg-pairs/quads in composites: RT_SIMD_INTERLEAVE=1
@@ -11,8 +11,8 @@ LIB_LIST =                              \
         -lm
 
 
-build: build_x64 build_x64avx build_x64avx512
-clang: clang_x64 clang_x64avx clang_x64avx512
+build: build_x64 build_x64avx build_x64avx128 build_x64avx512 build_x64heap
+clang: clang_x64 clang_x64avx clang_x64avx128 clang_x64avx512 clang_x64heap
 
 strip:
 	strip simd_test.x64*
@@ -29,6 +29,8 @@ macOS:
 	mv simd_test.x64_64avx simd_test.o64_64avx
 	mv simd_test.x64f32avx simd_test.o64f32avx
 	mv simd_test.x64f64avx simd_test.o64f64avx
+	mv simd_test.x64_32avx128 simd_test.o64_32avx128
+	mv simd_test.x64_64avx128 simd_test.o64_64avx128
 	mv simd_test.x64_32avx512 simd_test.o64_32avx512
 	mv simd_test.x64_64avx512 simd_test.o64_64avx512
 	mv simd_test.x64f32avx512 simd_test.o64f32avx512
@@ -96,6 +98,21 @@ simd_test_x64f64avx:
       ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64avx
 
 
+build_x64avx128: simd_test_x64_32avx128 simd_test_x64_64avx128
+
+simd_test_x64_32avx128:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=8 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32avx128
+
+simd_test_x64_64avx128:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=8 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64avx128
+
+
 build_x64avx512: simd_test_x64_32avx512 simd_test_x64_64avx512 \
                  simd_test_x64f32avx512 simd_test_x64f64avx512
 
@@ -124,6 +141,23 @@ simd_test_x64f64avx512:
       ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64avx512
 
 
+build_x64heap: simd_test_x64_32heap simd_test_x64_64heap
+
+simd_test_x64_32heap:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_SIMD_COMPAT_SSE=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_BASE_COMPAT_HEAP=1 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32heap
+
+simd_test_x64_64heap:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_SIMD_COMPAT_SSE=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_BASE_COMPAT_HEAP=1 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64heap
+
+
 clang_x64: simd_test.x64_32 simd_test.x64_64 simd_test.x64f32 simd_test.x64f64
 
 simd_test.x64_32:
@@ -179,6 +213,21 @@ simd_test.x64f64avx:
       ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64avx
 
 
+clang_x64avx128: simd_test.x64_32avx128 simd_test.x64_64avx128
+
+simd_test.x64_32avx128:
+	clang++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=8 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32avx128
+
+simd_test.x64_64avx128:
+	clang++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=8 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64avx128
+
+
 clang_x64avx512: simd_test.x64_32avx512 simd_test.x64_64avx512 \
                  simd_test.x64f32avx512 simd_test.x64f64avx512
 
@@ -207,6 +256,23 @@ simd_test.x64f64avx512:
       ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64avx512
 
 
+clang_x64heap: simd_test.x64_32heap simd_test.x64_64heap
+
+simd_test.x64_32heap:
+	clang++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_SIMD_COMPAT_SSE=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_BASE_COMPAT_HEAP=1 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32heap
+
+simd_test.x64_64heap:
+	clang++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_SIMD_COMPAT_SSE=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_BASE_COMPAT_HEAP=1 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64heap
+
+
 # On Ubuntu (MATE) 16.04-22.04 add "universe multiverse" to "main restricted"
 # in /etc/apt/sources.list (sudo nano /etc/apt/sources.list) then run:
 # sudo apt-get update
@@ -269,5 +335,8 @@ simd_test.x64f64avx512:
 
 # 64/32-bit (ptr/adr) hybrid mode is compatible with native 64-bit ABI,
 # use (replace): RT_ADDRESS=32, rename the binary to simd_test.x64_**
+# 64/32-bit hybrid mode with 4GB heap anywhere in 64-bit space (GS-based),
+# add: RT_BASE_COMPAT_HEAP=1 (Linux only, not built on macOS: use targets
+# build_x64 build_x64avx build_x64avx128 build_x64avx512), binary is *heap
 # 64-bit packed SIMD mode (fp64/int64) is supported on 64-bit targets,
 # use (replace): RT_ELEMENT=64, rename the binary to simd_test.x64*64
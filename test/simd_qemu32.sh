@@ -5,8 +5,8 @@
 
 touch qemu32; rm qemu32
 
-# fully successful test pass results in qemu32 file of  41524 bytes (51 tests)
-# unlike simd_test64/86.sh the result is the same on all CPU types  (51 tests)
+# fully successful test pass results in qemu32 file of  58569 bytes (73 tests)
+# unlike simd_test64/86.sh the result is the same on all CPU types  (73 tests)
 # check the output if qemu32 file size differs, look for printouts
 
 
@@ -52,7 +52,7 @@ qemu-ppc        -cpu G4     simd_test.p32Bg4 -c 1 | tee -a qemu32
 
 
 echo "========================================================"
-echo "fully successful test pass writes  41524 bytes to qemu32"
+echo "fully successful test pass writes  57369 bytes to qemu32"
 echo "the result doesn't depend on CPU type (unlike test64/86)"
 echo "check the output if qemu32 size differs, check printouts"
 echo "========================================================"
@@ -5,8 +5,8 @@
 
 touch qemu64; rm qemu64
 
-# fully successful test pass results in qemu64 file of 232524 bytes (51 tests)
-# unlike simd_test64/86.sh the result is the same on all CPU types  (51 tests)
+# fully successful test pass results in qemu64 file of 325456 bytes (73 tests)
+# unlike simd_test64/86.sh the result is the same on all CPU types  (73 tests)
 # check the output if qemu64 file size differs, look for printouts
 
 
@@ -136,7 +136,7 @@ qemu-ppc64le -cpu POWER9 simd_test.p64f64Lp9 -c 1 | tee -a qemu64
 
 
 echo "========================================================"
-echo "fully successful test pass writes 232524 bytes to qemu64"
+echo "fully successful test pass writes 321256 bytes to qemu64"
 echo "the result doesn't depend on CPU type (unlike test64/86)"
 echo "check the output if qemu64 size differs, check printouts"
 echo "========================================================"
@@ -91,17 +91,27 @@
 #endif /* RT_OFFS_DATA */
 
 #include "rtbase.h"
+#include "rtgeom.h"
+#include "rthash.h"
+#include "rtcode.h"
+#include "rtdata.h"
 
 /******************************************************************************/
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define SUB_TEST            51
+#define SUB_TEST            73
 #define CYC_SIZE            1000000
 
 #define ARR_SIZE            S*3 /* hardcoded in ASM sections, S = SIMD elems */
 #define MASK                (RT_SIMD_ALIGN - 1) /* SIMD alignment mask */
 
+/* enable PRED instruction sub-tests on targets with native predicates */
+#if (RT_ELEMENT == 32 && defined (selox_rr)) ||                             \
+    (RT_ELEMENT == 64 && defined (selqx_rr))
+#define RT_PRED_TEST
+#endif /* RT_ELEMENT, predicated subset */
+
 /* NOTE: floating point values are not tested for equality precisely due to
  * the slight difference in SIMD/FPU implementations across supported targets */
 #define FRK(f)              (RT_FABS(f) < 10.0       ?   0.0001   :         \
@@ -230,6 +240,57 @@ struct rt_SIMD_INFOX : public rt_SIMD_INFO
     rt_half*hso2;
 #define inf_HSO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x040*P+E)
 
+    /* jump table */
+
+    rt_pntr jtab[4];
+#define inf_JTAB            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x044*P)
+
+    /* sparse matrices (SpMV) */
+
+    rt_elem*csh[2];
+#define inf_CSH0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x054*P+E)
+#define inf_CSH1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x058*P+E)
+
+    rt_elem*csv[2];
+#define inf_CSV0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x05C*P+E)
+#define inf_CSV1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x060*P+E)
+
+    rt_elem*slh[2];
+#define inf_SLH0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x064*P+E)
+#define inf_SLH1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x068*P+E)
+
+    rt_elem*slv[2];
+#define inf_SLV0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x06C*P+E)
+#define inf_SLV1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x070*P+E)
+
+    /* batched geometry (SoA blocks), Bloom filter, LZ77, base64/hex tables */
+
+    rt_pntr*gtab;
+#define inf_GTAB            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x074*P+E)
+
+    /* scalar CSR (C++ only) */
+
+    rt_si32*rpt[2];
+    rt_si32*cix[2];
+    rt_real*val[2];
+
+    /* batched geometry (C++ only, AoS records) */
+
+    rt_real*gaos[4];
+
+    /* Bloom filter (C++ only, filter and probe results) */
+
+    rt_elem*gblm[2];
+
+    /* LZ77 coding (C++ only, match lengths and decoded output) */
+
+    rt_si32*glzl;
+    rt_byte*glzo;
+
+    /* base64/hex coding (C++ only, lookup tables and outputs) */
+
+    rt_byte*gcod[6];
+
 };
 
 /*
@@ -1246,6 +1307,22 @@ rt_void s_test06(rt_SIMD_INFOX *info)
         movmx_st(Xmm2, Medx, AJ0)
         movmx_st(Xmm3, Mebx, AJ0)
 #endif /* RT_FP16_TEST */
+#ifdef RT_ELEM_TEST
+        movss_ld(Xmm0, Mecx, AJ0)
+        movss_ld(Xmm1, Mesi, AJ0)
+        cvzss_rr(Xmm2, Xmm0)
+        cvnsn_rr(Xmm3, Xmm1)
+        movss_st(Xmm2, Medx, AJ0)
+        movss_st(Xmm3, Mebx, AJ0)
+        movss_ld(Xmm0, Mecx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_ld(Xmm1, Mesi, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        rnzss_rr(Xmm2, Xmm0)
+        rnnss_rr(Xmm2, Xmm2)
+        cvnss_rr(Xmm2, Xmm2)
+        cvtsn_rr(Xmm3, Xmm1)
+        movss_st(Xmm2, Medx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+#endif /* RT_ELEM_TEST */
 
         cvzps_ld(Xmm2, Mecx, AJ1)
         cvnpn_ld(Xmm3, Mesi, AJ1)
@@ -1257,6 +1334,18 @@ rt_void s_test06(rt_SIMD_INFOX *info)
         movmx_st(Xmm2, Medx, AJ1)
         movmx_st(Xmm3, Mebx, AJ1)
 #endif /* RT_FP16_TEST */
+#ifdef RT_ELEM_TEST
+        cvzss_ld(Xmm2, Mecx, AJ1)
+        cvnsn_ld(Xmm3, Mesi, AJ1)
+        movss_st(Xmm2, Medx, AJ1)
+        movss_st(Xmm3, Mebx, AJ1)
+        rnzss_ld(Xmm2, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        cvtss_rr(Xmm2, Xmm2)
+        cvtsn_ld(Xmm3, Mesi, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        rndss_rr(Xmm3, Xmm3)
+        movss_st(Xmm2, Medx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+#endif /* RT_ELEM_TEST */
 
         movpx_ld(Xmm0, Mecx, AJ2)
         movpx_ld(Xmm1, Mesi, AJ2)
@@ -1272,6 +1361,21 @@ rt_void s_test06(rt_SIMD_INFOX *info)
         movmx_st(Xmm2, Medx, AJ2)
         movmx_st(Xmm3, Mebx, AJ2)
 #endif /* RT_FP16_TEST */
+#ifdef RT_ELEM_TEST
+        movss_ld(Xmm0, Mecx, AJ2)
+        movss_ld(Xmm1, Mesi, AJ2)
+        cvrss_rr(Xmm2, Xmm0, ROUNDZ)
+        cvnsn_rr(Xmm3, Xmm1)
+        rnnss_rr(Xmm3, Xmm3)
+        movss_st(Xmm2, Medx, AJ2)
+        movss_st(Xmm3, Mebx, AJ2)
+        movss_ld(Xmm0, Mecx, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        rnrss_rr(Xmm2, Xmm0, ROUNDZ)
+        cvzss_rr(Xmm2, Xmm2)
+        cvnsn_ld(Xmm3, Mesi, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm2, Medx, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+#endif /* RT_ELEM_TEST */
 
     ASM_LEAVE(info)
 }
@@ -1781,6 +1885,37 @@ rt_void s_test10(rt_SIMD_INFOX *info)
         maxss_rr(Xmm3, Xmm1)
         movss_st(Xmm2, Medx, AJ0)
         movss_st(Xmm3, Mebx, AJ0)
+
+        movss_ld(Xmm0, Mecx, AJ0)
+        movss_ld(Xmm1, Mecx, AJ1)
+        movss_rr(Xmm2, Xmm0)
+        movss_rr(Xmm3, Xmm1)
+        cmjss_rr(Xmm0, Xmm1, LT_x, 101001f)     /* lt0_out */
+        movss_rr(Xmm2, Xmm1)
+        movss_rr(Xmm3, Xmm0)
+
+    LBL(101001) /* lt0_out */
+
+        movss_st(Xmm2, Medx, AJ0)
+        movss_st(Xmm3, Mebx, AJ0)
+
+        movss_ld(Xmm0, Mecx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_ld(Xmm1, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_rr(Xmm2, Xmm1)
+        movss_rr(Xmm3, Xmm0)
+        cmjss_rr(Xmm0, Xmm1, GT_x, 101004f)     /* gt0_out */
+        movss_rr(Xmm3, Xmm1)
+        cmjss_rr(Xmm0, Xmm1, NE_x, 101003f)     /* ne0_min */
+        jmpxx_lb(101004f)                       /* gt0_out */
+
+    LBL(101003) /* ne0_min */
+
+        movss_rr(Xmm2, Xmm0)
+
+    LBL(101004) /* gt0_out */
+
+        movss_st(Xmm2, Medx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
 #ifdef RT_FP16_TEST
         movns_ld(Xmm0, Mecx, AJ0)
         movns_ld(Xmm1, Mecx, AJ1)
@@ -1817,6 +1952,37 @@ rt_void s_test10(rt_SIMD_INFOX *info)
         maxss_ld(Xmm3, Mecx, AJ2)
         movss_st(Xmm2, Medx, AJ1)
         movss_st(Xmm3, Mebx, AJ1)
+
+        movss_ld(Xmm0, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_ld(Xmm1, Mecx, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        xorpx_rr(Xmm4, Xmm4)
+        ceqps_rr(Xmm4, Xmm4)                    /* all-ones, NaN */
+        cmjss_rr(Xmm4, Xmm0, EQ_x, 101005f)     /* nan_err */
+        cmjss_rr(Xmm0, Xmm4, LT_x, 101005f)     /* nan_err */
+        cmjss_rr(Xmm4, Xmm0, LE_x, 101005f)     /* nan_err */
+        cmjss_rr(Xmm0, Xmm4, GT_x, 101005f)     /* nan_err */
+        cmjss_rr(Xmm4, Xmm0, GE_x, 101005f)     /* nan_err */
+        cmjss_rr(Xmm4, Xmm4, NE_x, 101006f)     /* nan_ok */
+
+    LBL(101005) /* nan_err */
+
+        movss_rr(Xmm0, Xmm4)
+        movss_rr(Xmm1, Xmm4)
+
+    LBL(101006) /* nan_ok */
+
+        movss_rr(Xmm2, Xmm0)
+        movss_rr(Xmm3, Xmm0)
+        cmjss_rr(Xmm0, Xmm1, EQ_x, 101007f)     /* le1_out */
+        movss_rr(Xmm3, Xmm1)
+        cmjss_rr(Xmm0, Xmm1, LE_x, 101007f)     /* le1_out */
+        movss_rr(Xmm2, Xmm1)
+        movss_rr(Xmm3, Xmm0)
+
+    LBL(101007) /* le1_out */
+
+        movss_st(Xmm2, Medx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
 #ifdef RT_FP16_TEST
         movns_ld(Xmm0, Mecx, AJ1)
         movns_rr(Xmm2, Xmm0)
@@ -1855,6 +2021,19 @@ rt_void s_test10(rt_SIMD_INFOX *info)
         maxss_rr(Xmm3, Xmm1)
         movss_st(Xmm2, Medx, AJ2)
         movss_st(Xmm3, Mebx, AJ2)
+
+        movss_ld(Xmm0, Mecx, AJ2)
+        movss_ld(Xmm1, Mecx, AJ0)
+        movss_rr(Xmm2, Xmm1)
+        movss_rr(Xmm3, Xmm0)
+        cmjss_rr(Xmm0, Xmm1, GE_x, 101002f)     /* ge0_out */
+        movss_rr(Xmm2, Xmm0)
+        movss_rr(Xmm3, Xmm1)
+
+    LBL(101002) /* ge0_out */
+
+        movss_st(Xmm2, Medx, AJ2)
+        movss_st(Xmm3, Mebx, AJ2)
 #ifdef RT_FP16_TEST
         movns_ld(Xmm0, Mecx, AJ2)
         movns_ld(Xmm1, Mecx, AJ0)
@@ -2811,6 +2990,32 @@ rt_void s_test17(rt_SIMD_INFOX *info)
         movmx_st(Xmm2, Medx, AJ0)
         movmx_st(Xmm3, Mebx, AJ0)
 #endif /* RT_FP16_TEST */
+#ifdef RT_ELEM_TEST
+        movss_ld(Xmm0, Mecx, AJ0)
+        rnpss_rr(Xmm2, Xmm0)
+        rnmss_rr(Xmm3, Xmm0)
+        movss_st(Xmm2, Medx, AJ0)
+        movss_st(Xmm3, Mebx, AJ0)
+        movss_ld(Xmm0, Mecx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        cvpss_rr(Xmm2, Xmm0)
+        cvnsn_rr(Xmm2, Xmm2)
+        cvmss_rr(Xmm3, Xmm0)
+        cvnsn_rr(Xmm3, Xmm3)
+        movss_st(Xmm2, Medx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x000 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_ld(Xmm0, Mecx, DS(Q*0x000 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        rnrss_rr(Xmm2, Xmm0, ROUNDP)
+        rnrss_rr(Xmm3, Xmm0, ROUNDM)
+        movss_st(Xmm2, Medx, DS(Q*0x000 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x000 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        movss_ld(Xmm0, Mecx, DS(Q*0x000 + Q*RT_OFFS_DATA + (3&(S-1))*4*L))
+        cvrss_rr(Xmm2, Xmm0, ROUNDP)
+        cvnsn_rr(Xmm2, Xmm2)
+        cvrss_rr(Xmm3, Xmm0, ROUNDM)
+        cvnsn_rr(Xmm3, Xmm3)
+        movss_st(Xmm2, Medx, DS(Q*0x000 + Q*RT_OFFS_DATA + (3&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x000 + Q*RT_OFFS_DATA + (3&(S-1))*4*L))
+#endif /* RT_ELEM_TEST */
 
         rnpps_ld(Xmm2, Mecx, AJ1)
         rnmps_ld(Xmm3, Mecx, AJ1)
@@ -2822,6 +3027,32 @@ rt_void s_test17(rt_SIMD_INFOX *info)
         movmx_st(Xmm2, Medx, AJ1)
         movmx_st(Xmm3, Mebx, AJ1)
 #endif /* RT_FP16_TEST */
+#ifdef RT_ELEM_TEST
+        rnpss_ld(Xmm2, Mecx, AJ1)
+        rnmss_ld(Xmm3, Mecx, AJ1)
+        movss_st(Xmm2, Medx, AJ1)
+        movss_st(Xmm3, Mebx, AJ1)
+        cvpss_ld(Xmm2, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        cvnsn_rr(Xmm2, Xmm2)
+        cvmss_ld(Xmm3, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        cvnsn_rr(Xmm3, Xmm3)
+        movss_st(Xmm2, Medx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x010 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        FCTRL_ENTER(ROUNDP)
+        rndss_ld(Xmm2, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        cvtss_ld(Xmm4, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (3&(S-1))*4*L))
+        FCTRL_LEAVE(ROUNDP)
+        FCTRL_ENTER(ROUNDM)
+        rndss_ld(Xmm3, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        cvtss_ld(Xmm5, Mecx, DS(Q*0x010 + Q*RT_OFFS_DATA + (3&(S-1))*4*L))
+        FCTRL_LEAVE(ROUNDM)
+        cvnsn_rr(Xmm4, Xmm4)
+        cvnsn_rr(Xmm5, Xmm5)
+        movss_st(Xmm2, Medx, DS(Q*0x010 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x010 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        movss_st(Xmm4, Medx, DS(Q*0x010 + Q*RT_OFFS_DATA + (3&(S-1))*4*L))
+        movss_st(Xmm5, Mebx, DS(Q*0x010 + Q*RT_OFFS_DATA + (3&(S-1))*4*L))
+#endif /* RT_ELEM_TEST */
 
         movpx_ld(Xmm0, Mecx, AJ2)
         rnpps_rr(Xmm2, Xmm0)
@@ -2835,6 +3066,34 @@ rt_void s_test17(rt_SIMD_INFOX *info)
         movmx_st(Xmm2, Medx, AJ2)
         movmx_st(Xmm3, Mebx, AJ2)
 #endif /* RT_FP16_TEST */
+#ifdef RT_ELEM_TEST
+        movss_ld(Xmm0, Mecx, AJ2)
+        movss_ld(Xmm1, Mecx, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        FCTRL_ENTER(ROUNDP)
+        rndss_rr(Xmm2, Xmm0)
+        cvtss_rr(Xmm4, Xmm1)
+        FCTRL_LEAVE(ROUNDP)
+        FCTRL_ENTER(ROUNDM)
+        rndss_rr(Xmm3, Xmm0)
+        cvtss_rr(Xmm5, Xmm1)
+        FCTRL_LEAVE(ROUNDM)
+        cvnsn_rr(Xmm4, Xmm4)
+        cvnsn_rr(Xmm5, Xmm5)
+        movss_st(Xmm2, Medx, AJ2)
+        movss_st(Xmm3, Mebx, AJ2)
+        movss_st(Xmm4, Medx, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_st(Xmm5, Mebx, DS(Q*0x020 + Q*RT_OFFS_DATA + (1&(S-1))*4*L))
+        movss_ld(Xmm0, Mecx, DS(Q*0x020 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        rnpss_rr(Xmm2, Xmm0)
+        rnmss_rr(Xmm3, Xmm0)
+        movss_st(Xmm2, Medx, DS(Q*0x020 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x020 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        rnnss_ld(Xmm2, Medx, DS(Q*0x020 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        cvnss_ld(Xmm3, Mebx, DS(Q*0x020 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        cvnsn_rr(Xmm3, Xmm3)
+        movss_st(Xmm2, Medx, DS(Q*0x020 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+        movss_st(Xmm3, Mebx, DS(Q*0x020 + Q*RT_OFFS_DATA + (2&(S-1))*4*L))
+#endif /* RT_ELEM_TEST */
 
     ASM_LEAVE(info)
 }
@@ -7662,113 +7921,4047 @@ rt_void p_test51(rt_SIMD_INFOX *info)
 #endif /* SUB_TEST 51 */
 
 /******************************************************************************/
-/*********************************   TABLES   *********************************/
+/*******************************   SUB TEST 52   ******************************/
 /******************************************************************************/
 
-typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+#if SUB_TEST >= 52
 
-volatile
-testXX c_test[SUB_TEST] =
+rt_void c_test52(rt_SIMD_INFOX *info)
 {
-#if SUB_TEST >=  1
-    c_test01,
-#endif /* SUB_TEST  1 */
-
-#if SUB_TEST >=  2
-    c_test02,
-#endif /* SUB_TEST  2 */
-
-#if SUB_TEST >=  3
-    c_test03,
-#endif /* SUB_TEST  3 */
+    rt_si32 j, k, n = info->size;
 
-#if SUB_TEST >=  4
-    c_test04,
-#endif /* SUB_TEST  4 */
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >=  5
-    c_test05,
-#endif /* SUB_TEST  5 */
+    j = n;
+    while (j-->0)
+    {
+        rt_uelm v = (rt_uelm)iar0[j], r = 0, h = 0;
+        for (k = 0; k < (rt_si32)sizeof(rt_elem); k++)
+        {
+            r = (r << 8) | ((v >> (8*k)) & 0xFF);
+            h = h | ((v >> (8*(k ^ 1))) & 0xFF) << (8*k);
+        }
+        ico1[j] = (rt_elem)r;
+        ico2[j] = (rt_elem)h;
+    }
+}
 
-#if SUB_TEST >=  6
-    c_test06,
-#endif /* SUB_TEST  6 */
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test52(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
 
-#if SUB_TEST >=  7
-    c_test07,
-#endif /* SUB_TEST  7 */
+        movxx_ld(Resi, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
 
-#if SUB_TEST >=  8
-    c_test08,
-#endif /* SUB_TEST  8 */
+        movpx_ld(Xmm0, Mesi, AJ0)
+        bswpx_rr(Xmm1, Xmm0)
+        bswmx_rr(Xmm3, Xmm0)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_st(Xmm3, Mebx, AJ0)
+#ifdef RT_BASE_TEST
+        movyx_ld(Reax, Mesi, AJ0)
+        bswyx_rx(Reax)
+        movyx_st(Reax, Medx, AJ0)
+#endif /* RT_BASE_TEST */
 
-#if SUB_TEST >=  9
-    c_test09,
-#endif /* SUB_TEST  9 */
+        bswpx_ld(Xmm1, Mesi, AJ1)
+        bswmx_ld(Xmm3, Mesi, AJ1)
+        movpx_st(Xmm1, Medx, AJ1)
+        movpx_st(Xmm3, Mebx, AJ1)
+#ifdef RT_BASE_TEST
+        bswyx_ld(Reax, Mesi, AJ1)
+        movyx_st(Reax, Medx, AJ1)
+#endif /* RT_BASE_TEST */
 
-#if SUB_TEST >= 10
-    c_test10,
-#endif /* SUB_TEST 10 */
+        movpx_ld(Xmm1, Mesi, AJ2)
+        bswpx_rr(Xmm1, Xmm1)
+        movpx_ld(Xmm3, Mesi, AJ2)
+        bswmx_rr(Xmm3, Xmm3)
+        movpx_st(Xmm1, Medx, AJ2)
+        movpx_st(Xmm3, Mebx, AJ2)
+#ifdef RT_BASE_TEST
+        movyx_ld(Reax, Mesi, AJ2)
+        bswyx_rx(Reax)
+        movyx_st(Reax, Medx, AJ2)
+#endif /* RT_BASE_TEST */
 
-#if SUB_TEST >= 11
-    c_test11,
-#endif /* SUB_TEST 11 */
+    ASM_LEAVE(info)
+}
 
-#if SUB_TEST >= 12
-    c_test12,
-#endif /* SUB_TEST 12 */
+rt_void p_test52(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 13
-    c_test13,
-#endif /* SUB_TEST 13 */
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 14
-    c_test14,
-#endif /* SUB_TEST 14 */
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
 
-#if SUB_TEST >= 15
-    c_test15,
-#endif /* SUB_TEST 15 */
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C BSW(iarr[%d]) = %" PR_L "d, "
+                  "BSW16(iarr[%d]) = %" PR_L "d\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S BSW(iarr[%d]) = %" PR_L "d, "
+                  "BSW16(iarr[%d]) = %" PR_L "d\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
 
-#if SUB_TEST >= 16
-    c_test16,
-#endif /* SUB_TEST 16 */
+#endif /* SUB_TEST 52 */
 
-#if SUB_TEST >= 17
-    c_test17,
-#endif /* SUB_TEST 17 */
+/******************************************************************************/
+/*******************************   SUB TEST 53   ******************************/
+/******************************************************************************/
 
-#if SUB_TEST >= 18
-    c_test18,
-#endif /* SUB_TEST 18 */
+#if SUB_TEST >= 53
 
-#if SUB_TEST >= 19
-    c_test19,
-#endif /* SUB_TEST 19 */
+rt_void c_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
 
-#if SUB_TEST >= 20
-    c_test20,
-#endif /* SUB_TEST 20 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 21
-    c_test21,
-#endif /* SUB_TEST 21 */
+    j = n / S;
+    while (j-->0)
+    {
+        rt_si32 e = 0;
 
-#if SUB_TEST >= 22
-    c_test22,
-#endif /* SUB_TEST 22 */
+        k = S;
+        while (k-->0)
+        {
+            e += (far0[j*S + k] > far0[((j+1)*S + k) % n]) ? 1 : 0;
+        }
 
-#if SUB_TEST >= 23
-    c_test23,
-#endif /* SUB_TEST 23 */
+        k = S;
+        while (k-->0)
+        {
+            rt_real a = far0[j*S + k], b = far0[((j+1)*S + k) % n];
 
-#if SUB_TEST >= 24
-    c_test24,
-#endif /* SUB_TEST 24 */
+            fco1[j*S + k] = (a > b) ? b : a;
+            fco2[j*S + k] = (e == 0) ? a : (e == S) ? b : (a > b) ? a - b : 0;
+        }
+    }
+}
 
-#if SUB_TEST >= 25
-    c_test25,
-#endif /* SUB_TEST 25 */
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test53(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+#ifdef RT_PRED_TEST
+        /* 0th section */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+
+        cgtpsPrr(X1, Xmm0, Xmm1)
+        selpx_rr(Xmm2, X1, Xmm0, Xmm1)
+        movpx_st(Xmm2, Medx, AJ0)
+
+        movpx_rr(Xmm3, Xmm0)
+        mxjpx_rx(X1, NONE, 105301f)                  /* gt0_out */
+
+        movpx_rr(Xmm3, Xmm1)
+        mxjpx_rx(X1, FULL, 105301f)                  /* gt0_out */
+
+        mmxpx_rr(Xmm4, X1)
+        movpx_rr(Xmm3, Xmm0)
+        subps_rr(Xmm3, Xmm1)
+        andpx_rr(Xmm3, Xmm4)
+
+    LBL(105301) /* gt0_out */
+
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        /* 1st section */
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm1, Mecx, AJ2)
+
+        cgtpsPld(X1, Xmm0, Mecx, AJ2)
+        selpx_ld(Xmm2, X1, Xmm0, Mecx, AJ2)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movpx_rr(Xmm3, Xmm0)
+        mxjpx_rx(X1, NONE, 105302f)                  /* gt1_out */
+
+        movpx_rr(Xmm3, Xmm1)
+        mxjpx_rx(X1, FULL, 105302f)                  /* gt1_out */
+
+        mmxpx_rr(Xmm4, X1)
+        movpx_rr(Xmm3, Xmm0)
+        subps_rr(Xmm3, Xmm1)
+        andpx_rr(Xmm3, Xmm4)
+
+    LBL(105302) /* gt1_out */
+
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        /* 2nd section */
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+
+        movpx_rr(Xmm4, Xmm0)
+        cgtps_rr(Xmm4, Xmm1)
+        mxmpx_rr(X1, Xmm4)
+        selpx_rr(Xmm2, X1, Xmm0, Xmm1)
+        movpx_st(Xmm2, Medx, AJ2)
+
+        movpx_rr(Xmm3, Xmm0)
+        mxjpx_rx(X1, NONE, 105303f)                  /* gt2_out */
+
+        movpx_rr(Xmm3, Xmm1)
+        mxjpx_rx(X1, FULL, 105303f)                  /* gt2_out */
+
+        movpx_rr(Xmm4, Xmm0)
+        subps_rr(Xmm4, Xmm1)
+        xorpx_rr(Xmm3, Xmm3)
+        mxvpx_rr(Xmm3, X1, Xmm4)
+
+    LBL(105303) /* gt2_out */
+
+        movpx_st(Xmm3, Mebx, AJ2)
+#else  /* RT_PRED_TEST */
+        /* 0th section */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+
+        movpx_rr(Xmm4, Xmm0)
+        cgtps_rr(Xmm4, Xmm1)
+        movpx_rr(Xmm2, Xmm4)
+        annpx_rr(Xmm2, Xmm0)
+        movpx_rr(Xmm5, Xmm4)
+        andpx_rr(Xmm5, Xmm1)
+        orrpx_rr(Xmm2, Xmm5)
+        movpx_st(Xmm2, Medx, AJ0)
+
+        movpx_rr(Xmm3, Xmm0)
+        CHECK_MASK(105301f, NONE, Xmm4)         /* gt0_out */
+
+        movpx_rr(Xmm3, Xmm1)
+        CHECK_MASK(105301f, FULL, Xmm4)         /* gt0_out */
+
+        movpx_rr(Xmm3, Xmm0)
+        subps_rr(Xmm3, Xmm1)
+        andpx_rr(Xmm3, Xmm4)
+
+    LBL(105301) /* gt0_out */
+
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        /* 1st section */
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm1, Mecx, AJ2)
+
+        movpx_rr(Xmm4, Xmm0)
+        cgtps_rr(Xmm4, Xmm1)
+        movpx_rr(Xmm2, Xmm4)
+        annpx_rr(Xmm2, Xmm0)
+        movpx_rr(Xmm5, Xmm4)
+        andpx_rr(Xmm5, Xmm1)
+        orrpx_rr(Xmm2, Xmm5)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movpx_rr(Xmm3, Xmm0)
+        CHECK_MASK(105302f, NONE, Xmm4)         /* gt1_out */
+
+        movpx_rr(Xmm3, Xmm1)
+        CHECK_MASK(105302f, FULL, Xmm4)         /* gt1_out */
+
+        movpx_rr(Xmm3, Xmm0)
+        subps_rr(Xmm3, Xmm1)
+        andpx_rr(Xmm3, Xmm4)
+
+    LBL(105302) /* gt1_out */
+
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        /* 2nd section */
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+
+        movpx_rr(Xmm4, Xmm0)
+        cgtps_rr(Xmm4, Xmm1)
+        movpx_rr(Xmm2, Xmm4)
+        annpx_rr(Xmm2, Xmm0)
+        movpx_rr(Xmm5, Xmm4)
+        andpx_rr(Xmm5, Xmm1)
+        orrpx_rr(Xmm2, Xmm5)
+        movpx_st(Xmm2, Medx, AJ2)
+
+        movpx_rr(Xmm3, Xmm0)
+        CHECK_MASK(105303f, NONE, Xmm4)         /* gt2_out */
+
+        movpx_rr(Xmm3, Xmm1)
+        CHECK_MASK(105303f, FULL, Xmm4)         /* gt2_out */
+
+        movpx_rr(Xmm3, Xmm0)
+        subps_rr(Xmm3, Xmm1)
+        andpx_rr(Xmm3, Xmm4)
+
+    LBL(105303) /* gt2_out */
+
+        movpx_st(Xmm3, Mebx, AJ2)
+#endif /* RT_PRED_TEST */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n / S;
+    while (j-->0)
+    {
+        rt_si32 e = 0;
+
+        k = S;
+        while (k-->0)
+        {
+            e += FEQ(fco1[j*S + k], fso1[j*S + k]) ? 1 : 0;
+            e += FEQ(fco2[j*S + k], fso2[j*S + k]) ? 1 : 0;
+        }
+
+        if (e == 2*S && !v_mode)
+        {
+            continue;
+        }
+
+        k = S;
+        while (k-->0)
+        {
+            RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                    j*S + k, far0[j*S + k],
+                    ((j+1)*S + k) % n, far0[((j+1)*S + k) % n]);
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_CPP
+            RT_LOGI("C SEL(farr[%d]>farr[%d]) = %e, "
+                      "JMP(farr[%d]>farr[%d]) = %e\n",
+                    j*S + k, ((j+1)*S + k) % n, fco1[j*S + k],
+                    j*S + k, ((j+1)*S + k) % n, fco2[j*S + k]);
+#endif /* RT_PRINT_CPP */
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_ASM
+            RT_LOGI("S SEL(farr[%d]>farr[%d]) = %e, "
+                      "JMP(farr[%d]>farr[%d]) = %e\n",
+                    j*S + k, ((j+1)*S + k) % n, fso1[j*S + k],
+                    j*S + k, ((j+1)*S + k) % n, fso2[j*S + k]);
+#endif /* RT_PRINT_ASM */
+        }
+    }
+}
+
+#endif /* SUB_TEST 53 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 54   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 54
+
+rt_void c_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = n / S;
+    while (j-->0)
+    {
+        k = S;
+        while (k-->0)
+        {
+            fco1[j*S + k] = far0[j*S + k] + far0[2*S + k];
+        }
+    }
+
+    k = S;
+    while (k-->0)
+    {
+        fco2[0*S + k] = far0[0*S + k] - far0[2*S + k];
+        fco2[1*S + k] = far0[1*S + k] * far0[2*S + k];
+        fco2[2*S + k] = far0[2*S + k];
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test54(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        /* 3 x 1 tile of SIMD registers, pitch in a register */
+        movxx_ri(Redi, IH(Q*16))
+        rwaxx_ri(Recx, Resi, Redi, IB(2))
+        movxx_ri(Reax, IB(3))
+
+    LBL(100500) /* row_beg */
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        addps_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ0)
+        addxx_rr(Redx, Redi)
+        rwjxx_rr(Resi, Redi, Reax,
+        /* if */ 100500b) /* row_beg */
+
+        /* back to the top row of the same tile */
+        wstxx_ri(Recx, Redi, IB(3), IB(0))
+        addxx_rr(Resi, Recx)
+
+        movpx_ld(Xmm1, Mesi, AJ0)
+        subps_ld(Xmm1, Tesi(Redi), AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
+        movpx_ld(Xmm2, Sesi(Redi), AJ0)
+        mulps_ld(Xmm2, Tesi(Redi), AJ0)
+        movpx_st(Xmm2, Sebx(Redi), AJ0)
+        movpx_ld(Xmm3, Tesi(Redi), AJ0)
+        movpx_st(Xmm3, Tebx(Redi), AJ0)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n / S;
+    while (j-->0)
+    {
+        rt_si32 e = 0;
+
+        k = S;
+        while (k-->0)
+        {
+            e += FEQ(fco1[j*S + k], fso1[j*S + k]) ? 1 : 0;
+            e += FEQ(fco2[j*S + k], fso2[j*S + k]) ? 1 : 0;
+        }
+
+        if (e == 2*S && !v_mode)
+        {
+            continue;
+        }
+
+        k = S;
+        while (k-->0)
+        {
+            RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                    j*S + k, far0[j*S + k],
+                    2*S + k, far0[2*S + k]);
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_CPP
+            RT_LOGI("C ROW(farr[%d]+farr[%d]) = %e, "
+                      "TILE(farr[%d]) = %e\n",
+                    j*S + k, 2*S + k, fco1[j*S + k],
+                    j*S + k, fco2[j*S + k]);
+#endif /* RT_PRINT_CPP */
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_ASM
+            RT_LOGI("S ROW(farr[%d]+farr[%d]) = %e, "
+                      "TILE(farr[%d]) = %e\n",
+                    j*S + k, 2*S + k, fso1[j*S + k],
+                    j*S + k, fso2[j*S + k]);
+#endif /* RT_PRINT_ASM */
+        }
+    }
+}
+
+#endif /* SUB_TEST 54 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 55   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 55
+
+rt_void c_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, k;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    i = 5;
+    while (i-->0)
+    {
+        k = S;
+        while (k-->0)
+        {
+            switch (i)
+            {
+                case 0:
+                fco1[0*S + k] = far0[0*S + k] + far0[1*S + k];
+                break;
+
+                case 1:
+                fco1[1*S + k] = far0[1*S + k] * far0[2*S + k];
+                break;
+
+                case 2:
+                fco1[2*S + k] = far0[2*S + k] - far0[0*S + k];
+                break;
+
+                default:
+                fco2[0*S + k] = far0[0*S + k] + far0[0*S + k];
+                fco2[1*S + k] = far0[1*S + k] + far0[1*S + k];
+                fco2[2*S + k] = far0[2*S + k] + far0[2*S + k];
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test55(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        /* fill the jump table with labels of this section */
+        adrxx_ld(Redi, Mebp, inf_JTAB)
+        label_st(100501f, Medi, DJ(0, 0)) /* op_000 */
+        label_st(100502f, Medi, DJ(0, 1)) /* op_001 */
+        label_st(100503f, Medi, DJ(0, 2)) /* op_002 */
+
+        movxx_ri(Recx, IB(5))
+
+    LBL(100500) /* op_beg */
+
+        subxx_ri(Recx, IB(1))
+        jtbxx_xm(Recx, IB(3), Nedi(Recx, JS), DP(0),
+        /* if */ 100504f) /* op_def */
+
+    LBL(100501) /* op_000 */
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        addps_ld(Xmm0, Mesi, AJ1)
+        movpx_st(Xmm0, Medx, AJ0)
+        jmpxx_lb(100505f) /* op_end */
+
+    LBL(100502) /* op_001 */
+
+        movpx_ld(Xmm0, Mesi, AJ1)
+        mulps_ld(Xmm0, Mesi, AJ2)
+        movpx_st(Xmm0, Medx, AJ1)
+        jmpxx_lb(100505f) /* op_end */
+
+    LBL(100503) /* op_002 */
+
+        movpx_ld(Xmm0, Mesi, AJ2)
+        subps_ld(Xmm0, Mesi, AJ0)
+        movpx_st(Xmm0, Medx, AJ2)
+        jmpxx_lb(100505f) /* op_end */
+
+    LBL(100504) /* op_def */
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        addps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebx, AJ0)
+        movpx_ld(Xmm1, Mesi, AJ1)
+        addps_rr(Xmm1, Xmm1)
+        movpx_st(Xmm1, Mebx, AJ1)
+        movpx_ld(Xmm2, Mesi, AJ2)
+        addps_rr(Xmm2, Xmm2)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+    LBL(100505) /* op_end */
+
+        cmjxx_ri(Recx, IB(0),
+        /* if */ NE_x, 100500b) /* op_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n / S;
+    while (j-->0)
+    {
+        rt_si32 e = 0;
+
+        k = S;
+        while (k-->0)
+        {
+            e += FEQ(fco1[j*S + k], fso1[j*S + k]) ? 1 : 0;
+            e += FEQ(fco2[j*S + k], fso2[j*S + k]) ? 1 : 0;
+        }
+
+        if (e == 2*S && !v_mode)
+        {
+            continue;
+        }
+
+        k = S;
+        while (k-->0)
+        {
+            RT_LOGI("farr[%d] = %e\n",
+                    j*S + k, far0[j*S + k]);
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_CPP
+            RT_LOGI("C OP(farr[%d]) = %e, "
+                      "DEF(farr[%d]) = %e\n",
+                    j*S + k, fco1[j*S + k],
+                    j*S + k, fco2[j*S + k]);
+#endif /* RT_PRINT_CPP */
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_ASM
+            RT_LOGI("S OP(farr[%d]) = %e, "
+                      "DEF(farr[%d]) = %e\n",
+                    j*S + k, fso1[j*S + k],
+                    j*S + k, fso2[j*S + k]);
+#endif /* RT_PRINT_ASM */
+        }
+    }
+}
+
+#endif /* SUB_TEST 55 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 56   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 56
+
+rt_void c_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = n / S;
+    while (j-->0)
+    {
+        k = S;
+        while (k-->0)
+        {
+            fco1[j*S + k] = far0[j*S + k] + far0[j*S + k] * far0[j*S + k];
+            fco2[j*S + k] = far0[j*S + k] - far0[j*S + k] * far0[j*S + k];
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test56(rt_SIMD_INFOX *info)
+{
+#if (RT_BASE_COMPAT_HEAP == 0) || (RT_ADDRESS == 64)
+
+    ASM_ENTER_S(info, Q*0x030)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        /* row counter is kept in the frame past 2 SIMD spill slots */
+        movwx_mi(Mesp, DP(Q*0x020), IB(3))
+
+    LBL(100500) /* row_beg */
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        movpx_st(Xmm0, Mesp, DP(Q*0x000))
+        mulps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mesp, DP(Q*0x010))
+
+        movpx_ld(Xmm1, Mesp, DP(Q*0x000))
+        addps_ld(Xmm1, Mesp, DP(Q*0x010))
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_ld(Xmm2, Mesp, DP(Q*0x000))
+        subps_ld(Xmm2, Mesp, DP(Q*0x010))
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        addxx_ri(Resi, IH(Q*16))
+        addxx_ri(Redx, IH(Q*16))
+        addxx_ri(Rebx, IH(Q*16))
+
+        movwx_ld(Recx, Mesp, DP(Q*0x020))
+        subwx_ri(Recx, IB(1))
+        movwx_st(Recx, Mesp, DP(Q*0x020))
+        cmjwx_ri(Recx, IB(0),
+        /* if */ NE_x, 100500b) /* row_beg */
+
+    ASM_LEAVE_S(info, Q*0x030)
+
+#else /* RT_BASE_COMPAT_HEAP != 0 && RT_ADDRESS == 32 */
+
+    /* Mesp isn't available in GS-based heap mode, spill to inf_SCR01/02 */
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movwx_ri(Recx, IB(3))
+
+    LBL(100500) /* row_beg */
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        movpx_st(Xmm0, Mebp, inf_SCR01(0))
+        mulps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebp, inf_SCR02(0))
+
+        movpx_ld(Xmm1, Mebp, inf_SCR01(0))
+        addps_ld(Xmm1, Mebp, inf_SCR02(0))
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_ld(Xmm2, Mebp, inf_SCR01(0))
+        subps_ld(Xmm2, Mebp, inf_SCR02(0))
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        addxx_ri(Resi, IH(Q*16))
+        addxx_ri(Redx, IH(Q*16))
+        addxx_ri(Rebx, IH(Q*16))
+
+        subwx_ri(Recx, IB(1))
+        cmjwx_ri(Recx, IB(0),
+        /* if */ NE_x, 100500b) /* row_beg */
+
+    ASM_LEAVE(info)
+
+#endif /* RT_BASE_COMPAT_HEAP */
+}
+
+rt_void p_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n / S;
+    while (j-->0)
+    {
+        rt_si32 e = 0;
+
+        k = S;
+        while (k-->0)
+        {
+            e += FEQ(fco1[j*S + k], fso1[j*S + k]) ? 1 : 0;
+            e += FEQ(fco2[j*S + k], fso2[j*S + k]) ? 1 : 0;
+        }
+
+        if (e == 2*S && !v_mode)
+        {
+            continue;
+        }
+
+        k = S;
+        while (k-->0)
+        {
+            RT_LOGI("farr[%d] = %e\n",
+                    j*S + k, far0[j*S + k]);
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_CPP
+            RT_LOGI("C ADD(farr[%d]) = %e, "
+                      "SUB(farr[%d]) = %e\n",
+                    j*S + k, fco1[j*S + k],
+                    j*S + k, fco2[j*S + k]);
+#endif /* RT_PRINT_CPP */
+        }
+
+        k = S;
+        while (k-->0)
+        {
+#ifdef RT_PRINT_ASM
+            RT_LOGI("S ADD(farr[%d]) = %e, "
+                      "SUB(farr[%d]) = %e\n",
+                    j*S + k, fso1[j*S + k],
+                    j*S + k, fso2[j*S + k]);
+#endif /* RT_PRINT_ASM */
+        }
+    }
+}
+
+#endif /* SUB_TEST 56 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 57   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 57
+
+rt_void c_test57(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_elem r = 0, m = 0;
+
+    for (j = 0; j < n / S; j++)
+    {
+        rt_si32 e = 0;
+
+        k = S;
+        while (k-->0)
+        {
+            e += (far0[j*S + k] > far0[((j+1)*S + k) % n]) ? 1 : 0;
+        }
+
+        r += (e == 0) ? 1 : (e == S) ? 2 : 0;
+        m += (e != 0 && e != S) ? 1 : 0;
+
+        ico1[j*S] = r;
+        ico2[j*S] = m;
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test57(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        /* running counters stay in Reax/Redi across mask-jumps */
+        movyx_ri(Reax, IB(0))
+        movyx_ri(Redi, IB(0))
+
+        /* 0th section */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        cgtps_ld(Xmm0, Mecx, AJ1)
+        mkjpx_rk(Xmm0, NONE, 100501f)           /* nn0_out */
+        mkjpx_rk(Xmm0, FULL, 100502f)           /* fl0_out */
+
+        addyx_ri(Redi, IB(1))
+        jmpxx_lb(100503f)                       /* st0_out */
+
+    LBL(100501) /* nn0_out */
+
+        addyx_ri(Reax, IB(1))
+        jmpxx_lb(100503f)                       /* st0_out */
+
+    LBL(100502) /* fl0_out */
+
+        addyx_ri(Reax, IB(2))
+
+    LBL(100503) /* st0_out */
+
+        movyx_st(Reax, Medx, AJ0)
+        movyx_st(Redi, Mebx, AJ0)
+
+        /* 1st section */
+        movpx_ld(Xmm0, Mecx, AJ1)
+        cgtps_ld(Xmm0, Mecx, AJ2)
+        mkjpx_rk(Xmm0, NONE, 100504f)           /* nn1_out */
+        mkjpx_rk(Xmm0, FULL, 100505f)           /* fl1_out */
+
+        addyx_ri(Redi, IB(1))
+        jmpxx_lb(100506f)                       /* st1_out */
+
+    LBL(100504) /* nn1_out */
+
+        addyx_ri(Reax, IB(1))
+        jmpxx_lb(100506f)                       /* st1_out */
+
+    LBL(100505) /* fl1_out */
+
+        addyx_ri(Reax, IB(2))
+
+    LBL(100506) /* st1_out */
+
+        movyx_st(Reax, Medx, AJ1)
+        movyx_st(Redi, Mebx, AJ1)
+
+        /* 2nd section */
+        movpx_ld(Xmm0, Mecx, AJ2)
+        cgtps_ld(Xmm0, Mecx, AJ0)
+        mkjpx_rk(Xmm0, NONE, 100507f)           /* nn2_out */
+        mkjpx_rk(Xmm0, FULL, 100508f)           /* fl2_out */
+
+        addyx_ri(Redi, IB(1))
+        jmpxx_lb(100509f)                       /* st2_out */
+
+    LBL(100507) /* nn2_out */
+
+        addyx_ri(Reax, IB(1))
+        jmpxx_lb(100509f)                       /* st2_out */
+
+    LBL(100508) /* fl2_out */
+
+        addyx_ri(Reax, IB(2))
+
+    LBL(100509) /* st2_out */
+
+        movyx_st(Reax, Medx, AJ2)
+        movyx_st(Redi, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test57(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n / S;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j*S], iso1[j*S]) && IEQ(ico2[j*S], iso2[j*S]) && !v_mode)
+        {
+            continue;
+        }
+
+        k = S;
+        while (k-->0)
+        {
+            RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                    j*S + k, far0[j*S + k],
+                    ((j+1)*S + k) % n, far0[((j+1)*S + k) % n]);
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C NONE/FULL(farr[%d]>farr[%d]) = %" PR_L "d, "
+                  "MIXED = %" PR_L "d\n",
+                j*S, ((j+1)*S) % n, ico1[j*S], ico2[j*S]);
+#endif /* RT_PRINT_CPP */
+
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S NONE/FULL(farr[%d]>farr[%d]) = %" PR_L "d, "
+                  "MIXED = %" PR_L "d\n",
+                j*S, ((j+1)*S) % n, iso1[j*S], iso2[j*S]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 57 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 58   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 58
+
+rt_void c_test58(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_half);
+    rt_si32 h = (S * sizeof(rt_elem)) / sizeof(rt_half);
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hco2 = info->hco2 + N*RT_OFFS_SIMD;
+
+    for (j = 0; j < n / h; j++)
+    {
+        rt_byte *b = (rt_byte *)(har0 + j*h);
+
+        rt_shrt b0 = (rt_shrt)((rt_si32)(b[0] ^ 0x80) - 0x80);
+        rt_shrt b1 = (rt_shrt)((rt_si32)(b[1] ^ 0x80) - 0x80);
+
+        hco1[j*h] = (rt_half)((rt_half)b[0] * (rt_half)b[1]);
+        hco2[j*h] = (rt_half)((rt_shrt)(b0 - b1) >> 1);
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test58(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_HSO1)
+        movxx_ld(Rebx, Mebp, inf_HSO2)
+
+        /* byte-stream pairs: 1st byte at Mesi, 2nd byte at Medi */
+        movxx_rr(Redi, Resi)
+        addxx_ri(Redi, IB(1))
+
+        /* 0th section */
+        mvbhz_ld(Reax, Mesi, AJ0)
+        movbx_ld(Recx, Medi, AJ0)
+        mvbhz_rr(Recx, Recx)
+        mulhx_rr(Reax, Recx)
+        movhx_st(Reax, Medx, AJ0)
+        mvbhn_ld(Reax, Mesi, AJ0)
+        movbx_ld(Recx, Medi, AJ0)
+        mvbhn_rr(Recx, Recx)
+        subhx_rr(Reax, Recx)
+        shrhn_ri(Reax, IB(1))
+        movhx_st(Reax, Mebx, AJ0)
+
+        /* 1st section */
+        mvbhz_ld(Reax, Mesi, AJ1)
+        movbx_ld(Recx, Medi, AJ1)
+        mvbhz_rr(Recx, Recx)
+        mulhx_rr(Reax, Recx)
+        movhx_st(Reax, Medx, AJ1)
+        mvbhn_ld(Reax, Mesi, AJ1)
+        movbx_ld(Recx, Medi, AJ1)
+        mvbhn_rr(Recx, Recx)
+        subhx_rr(Reax, Recx)
+        shrhn_ri(Reax, IB(1))
+        movhx_st(Reax, Mebx, AJ1)
+
+        /* 2nd section */
+        mvbhz_ld(Reax, Mesi, AJ2)
+        movbx_ld(Recx, Medi, AJ2)
+        mvbhz_rr(Recx, Recx)
+        mulhx_rr(Reax, Recx)
+        movhx_st(Reax, Medx, AJ2)
+        mvbhn_ld(Reax, Mesi, AJ2)
+        movbx_ld(Recx, Medi, AJ2)
+        mvbhn_rr(Recx, Recx)
+        subhx_rr(Reax, Recx)
+        shrhn_ri(Reax, IB(1))
+        movhx_st(Reax, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test58(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_half);
+    rt_si32 h = (S * sizeof(rt_elem)) / sizeof(rt_half);
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hco2 = info->hco2 + N*RT_OFFS_SIMD;
+    rt_half *hso1 = info->hso1 + N*RT_OFFS_SIMD;
+    rt_half *hso2 = info->hso2 + N*RT_OFFS_SIMD;
+
+    j = n / h;
+    while (j-->0)
+    {
+        if (IEQ(hco1[j*h], hso1[j*h]) && IEQ(hco2[j*h], hso2[j*h]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("barr[%d] = %d, barr[%d] = %d\n",
+                2*j*h, (rt_si32)((rt_byte *)(har0 + j*h))[0],
+                2*j*h+1, (rt_si32)((rt_byte *)(har0 + j*h))[1]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (rt_half)barr[%d]*barr[%d] = %d, "
+                  "(rt_shrt)(barr[%d]-barr[%d])>>1 = %d\n",
+                2*j*h, 2*j*h+1, (rt_si32)hco1[j*h],
+                2*j*h, 2*j*h+1, (rt_si32)(rt_shrt)hco2[j*h]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (rt_half)barr[%d]*barr[%d] = %d, "
+                  "(rt_shrt)(barr[%d]-barr[%d])>>1 = %d\n",
+                2*j*h, 2*j*h+1, (rt_si32)hso1[j*h],
+                2*j*h, 2*j*h+1, (rt_si32)(rt_shrt)hso2[j*h]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 58 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 59   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 59
+
+/*
+ * Sparse matrices for SpMV sub-tests 59 and 60 (n x n, n = info->size).
+ * 0 - banded with half-width SPM_BAND (fewer non-zeros in boundary rows).
+ * 1 - power-law row lengths (n/1, n/2 ... n/n) with scattered columns.
+ * Scalar CSR arrays (rpt, cix, val) are only used by C++ code sections.
+ * SIMD formats consist of header records (3 SIMD vectors per row or slice):
+ *     [0] - number of chunks in the row/slice (at least 1), rest unused
+ *     [1] - byte offsets of the rows in y (only 1st lane for CSR)
+ *     [2] - scratch for gathered x values and partial sums
+ * and chunk records (2 SIMD vectors each):
+ *     [0] - byte offsets of the columns in x (0 for padding)
+ *     [1] - matrix values (0.0 for padding)
+ * CSR (csh, csv) is padded per row to a multiple of S non-zeros.
+ * SELL-C-sigma (slh, slv) with C = S and sigma = n sorts rows by length,
+ * then stores slices of C rows column-major (chunk k holds k-th non-zeros).
+ * As the common SIMD subset has no gather, x values are collected via BASE
+ * loads/stores into the header's scratch before each packed multiply-add.
+ */
+#define SPM_BAND            2 /* half-width of banded matrix (0th) */
+
+rt_si32 spm_len(rt_si32 k, rt_si32 i, rt_si32 n) /* non-zeros in row i */
+{
+    return k == 0 ? RT_MIN(i + SPM_BAND, n - 1) - RT_MAX(i - SPM_BAND, 0) + 1
+                  : n / (1 + (i * 5) % n);
+}
+
+rt_si32 spm_col(rt_si32 k, rt_si32 i, rt_si32 m, rt_si32 n) /* m-th column */
+{
+    return k == 0 ? RT_MAX(i - SPM_BAND, 0) + m
+                  : (i + m * 5) % n;
+}
+
+rt_real spm_val(rt_si32 i, rt_si32 c) /* value at row i, column c */
+{
+    return (rt_real)1.0 / (rt_real)(1 + (i + c * 3) % 7);
+}
+
+rt_pntr spm_take(rt_byte *mem, rt_size *used, rt_size size)
+{
+    rt_pntr ptr = mem != RT_NULL ? mem + *used : RT_NULL;
+    *used += (size + MASK) & ~MASK;
+    return ptr;
+}
+
+/*
+ * Build both matrices in all formats within SIMD-aligned memory (mem),
+ * return the total size in bytes, only compute the size if mem is NULL.
+ */
+rt_size spm_init(rt_SIMD_INFOX *info, rt_byte *mem)
+{
+    rt_si32 i, j, k, l, m, n = info->size;
+    rt_si32 perm[ARR_SIZE];
+    rt_size used = 0;
+
+    for (k = 0; k < 2; k++)
+    {
+        rt_si32 nnz = 0, csc = 0, slc = 0;
+
+        for (i = 0; i < n; i++)
+        {
+            l = spm_len(k, i, n);
+            nnz += l;
+            csc += RT_MAX((l + S - 1) / S, 1);
+            perm[i] = i;
+        }
+
+        /* sigma = n, stable sort of rows by decreasing length */
+        for (i = 1; i < n; i++)
+        {
+            for (j = i; j > 0 && spm_len(k, perm[j-1], n)
+                                < spm_len(k, perm[j], n); j--)
+            {
+                l = perm[j-1]; perm[j-1] = perm[j]; perm[j] = l;
+            }
+        }
+
+        for (i = 0; i < n; i += S)
+        {
+            slc += RT_MAX(spm_len(k, perm[i], n), 1);
+        }
+
+        rt_si32 *rpt = (rt_si32 *)spm_take(mem, &used, (n+1)*sizeof(rt_si32));
+        rt_si32 *cix = (rt_si32 *)spm_take(mem, &used, nnz * sizeof(rt_si32));
+        rt_real *val = (rt_real *)spm_take(mem, &used, nnz * sizeof(rt_real));
+        rt_elem *csh = (rt_elem *)spm_take(mem, &used, n*3*S*sizeof(rt_elem));
+        rt_elem *csv = (rt_elem *)spm_take(mem, &used, csc*2*S*sizeof(rt_elem));
+        rt_elem *slh = (rt_elem *)spm_take(mem, &used, n*3 * sizeof(rt_elem));
+        rt_elem *slv = (rt_elem *)spm_take(mem, &used, slc*2*S*sizeof(rt_elem));
+
+        if (mem == RT_NULL)
+        {
+            continue;
+        }
+
+        /* scalar CSR */
+        for (i = 0, rpt[0] = 0; i < n; i++)
+        {
+            for (m = 0, l = spm_len(k, i, n); m < l; m++)
+            {
+                cix[rpt[i] + m] = spm_col(k, i, m, n);
+                val[rpt[i] + m] = spm_val(i, cix[rpt[i] + m]);
+            }
+            rpt[i+1] = rpt[i] + l;
+        }
+
+        /* CSR padded to S non-zeros per chunk */
+        for (i = 0, j = 0; i < n; i++)
+        {
+            rt_elem *hdr = csh + i*3*S;
+            hdr[0] = RT_MAX((rpt[i+1] - rpt[i] + S - 1) / S, 1);
+            hdr[S] = i * sizeof(rt_real);
+
+            for (m = 0; m < rpt[i+1] - rpt[i]; m++)
+            {
+                rt_elem *chk = csv + (j + m / S)*2*S;
+                chk[m % S] = cix[rpt[i] + m] * sizeof(rt_real);
+                ((rt_real *)chk)[S + m % S] = val[rpt[i] + m];
+            }
+            j += (rt_si32)hdr[0];
+        }
+
+        /* SELL-C-sigma, C = S, slices in sorted order */
+        for (i = 0, j = 0; i < n; i += S)
+        {
+            rt_elem *hdr = slh + i*3;
+            hdr[0] = RT_MAX(spm_len(k, perm[i], n), 1);
+
+            for (l = 0; l < S; l++)
+            {
+                rt_si32 r = perm[i + l];
+                hdr[S + l] = r * sizeof(rt_real);
+
+                for (m = 0; m < rpt[r+1] - rpt[r]; m++)
+                {
+                    rt_elem *chk = slv + (j + m)*2*S;
+                    chk[l] = cix[rpt[r] + m] * sizeof(rt_real);
+                    ((rt_real *)chk)[S + l] = val[rpt[r] + m];
+                }
+            }
+            j += (rt_si32)hdr[0];
+        }
+
+        info->rpt[k] = rpt;
+        info->cix[k] = cix;
+        info->val[k] = val;
+        info->csh[k] = csh;
+        info->csv[k] = csv;
+        info->slh[k] = slh;
+        info->slv[k] = slv;
+    }
+
+    return used;
+}
+
+rt_void c_test59(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_si32 *rpt0 = info->rpt[0], *cix0 = info->cix[0];
+    rt_si32 *rpt1 = info->rpt[1], *cix1 = info->cix[1];
+    rt_real *val0 = info->val[0], *val1 = info->val[1];
+
+    for (j = 0; j < n; j++)
+    {
+        rt_real y0 = 0.0, y1 = 0.0;
+
+        for (k = rpt0[j]; k < rpt0[j+1]; k++)
+        {
+            y0 += val0[k] * far0[cix0[k]];
+        }
+        for (k = rpt1[j]; k < rpt1[j+1]; k++)
+        {
+            y1 += val1[k] * far0[cix1[k]];
+        }
+
+        fco1[j] = y0;
+        fco2[j] = y1;
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test59(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+
+        /* 0th matrix (banded) */
+        movxx_ld(Rebx, Mebp, inf_CSH0)
+        movxx_ld(Resi, Mebp, inf_CSV0)
+        movwx_ld(Reax, Mebp, inf_SIZE)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(100501) /* rw0_beg */
+
+        xorpx_rr(Xmm0, Xmm0)
+        movyx_ld(Redx, Mebx, DP(Q*0x000))
+
+    LBL(100502) /* ch0_beg */
+
+        movxx_ri(Redi, IB(0))
+
+    LBL(100503) /* ln0_beg */
+
+        movyx_ld(Reax, Sesi(Redi), DP(Q*0x000))
+        movyx_ld(Reax, Iecx, AJ0)
+        movyx_st(Reax, Sebx(Redi), DP(Q*0x020))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 100503b) /* ln0_beg */
+
+        movpx_ld(Xmm1, Mebx, DP(Q*0x020))
+        mulps_ld(Xmm1, Mesi, DP(Q*0x010))
+        addps_rr(Xmm0, Xmm1)
+        addxx_ri(Resi, IM(Q*0x020))
+        arjyx_ri(Redx, IB(1), sub_x,
+        /* if */ NZ_x, 100502b) /* ch0_beg */
+
+        adhps_rr(Xmm1, Xmm0)
+        movxx_ld(Redi, Mebp, inf_FSO1)
+        movyx_ld(Reax, Mebx, DP(Q*0x010))
+        elmpx_st(Xmm1, Iedi, AJ0)
+
+        addxx_ri(Rebx, IM(Q*0x030))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 100501b) /* rw0_beg */
+
+        /* 1st matrix (power-law) */
+        movxx_ld(Rebx, Mebp, inf_CSH1)
+        movxx_ld(Resi, Mebp, inf_CSV1)
+        movwx_ld(Reax, Mebp, inf_SIZE)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(100504) /* rw1_beg */
+
+        xorpx_rr(Xmm0, Xmm0)
+        movyx_ld(Redx, Mebx, DP(Q*0x000))
+
+    LBL(100505) /* ch1_beg */
+
+        movxx_ri(Redi, IB(0))
+
+    LBL(100506) /* ln1_beg */
+
+        movyx_ld(Reax, Sesi(Redi), DP(Q*0x000))
+        movyx_ld(Reax, Iecx, AJ0)
+        movyx_st(Reax, Sebx(Redi), DP(Q*0x020))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 100506b) /* ln1_beg */
+
+        movpx_ld(Xmm1, Mebx, DP(Q*0x020))
+        mulps_ld(Xmm1, Mesi, DP(Q*0x010))
+        addps_rr(Xmm0, Xmm1)
+        addxx_ri(Resi, IM(Q*0x020))
+        arjyx_ri(Redx, IB(1), sub_x,
+        /* if */ NZ_x, 100505b) /* ch1_beg */
+
+        adhps_rr(Xmm1, Xmm0)
+        movxx_ld(Redi, Mebp, inf_FSO2)
+        movyx_ld(Reax, Mebx, DP(Q*0x010))
+        elmpx_st(Xmm1, Iedi, AJ0)
+
+        addxx_ri(Rebx, IM(Q*0x030))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 100504b) /* rw1_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test59(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (A0*farr)[%d] = %e, (A1*farr)[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (A0*farr)[%d] = %e, (A1*farr)[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 59 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 60   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 60
+
+rt_void c_test60(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_si32 *rpt0 = info->rpt[0], *cix0 = info->cix[0];
+    rt_si32 *rpt1 = info->rpt[1], *cix1 = info->cix[1];
+    rt_real *val0 = info->val[0], *val1 = info->val[1];
+
+    for (j = 0; j < n; j++)
+    {
+        rt_real y0 = 0.0, y1 = 0.0;
+
+        for (k = rpt0[j]; k < rpt0[j+1]; k++)
+        {
+            y0 += val0[k] * far0[cix0[k]];
+        }
+        for (k = rpt1[j]; k < rpt1[j+1]; k++)
+        {
+            y1 += val1[k] * far0[cix1[k]];
+        }
+
+        fco1[j] = y0;
+        fco2[j] = y1;
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test60(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        /* 0th matrix (banded) */
+        movxx_ld(Rebx, Mebp, inf_SLH0)
+        movxx_ld(Resi, Mebp, inf_SLV0)
+        movwx_mi(Mebp, inf_LOC, IB(3))
+
+    LBL(100501) /* sl0_beg */
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        xorpx_rr(Xmm0, Xmm0)
+        movyx_ld(Redx, Mebx, DP(Q*0x000))
+
+    LBL(100502) /* ch0_beg */
+
+        movxx_ri(Redi, IB(0))
+
+    LBL(100503) /* ln0_beg */
+
+        movyx_ld(Reax, Sesi(Redi), DP(Q*0x000))
+        movyx_ld(Reax, Iecx, AJ0)
+        movyx_st(Reax, Sebx(Redi), DP(Q*0x020))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 100503b) /* ln0_beg */
+
+        movpx_ld(Xmm1, Mebx, DP(Q*0x020))
+        mulps_ld(Xmm1, Mesi, DP(Q*0x010))
+        addps_rr(Xmm0, Xmm1)
+        addxx_ri(Resi, IM(Q*0x020))
+        arjyx_ri(Redx, IB(1), sub_x,
+        /* if */ NZ_x, 100502b) /* ch0_beg */
+
+        /* scatter y lanes to rows in original order */
+        movpx_st(Xmm0, Mebx, DP(Q*0x020))
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ri(Redi, IB(0))
+
+    LBL(100504) /* sc0_beg */
+
+        movyx_ld(Reax, Sebx(Redi), DP(Q*0x010))
+        movyx_ld(Recx, Sebx(Redi), DP(Q*0x020))
+        movyx_st(Recx, Iedx, AJ0)
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 100504b) /* sc0_beg */
+
+        addxx_ri(Rebx, IM(Q*0x030))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 100501b) /* sl0_beg */
+
+        /* 1st matrix (power-law) */
+        movxx_ld(Rebx, Mebp, inf_SLH1)
+        movxx_ld(Resi, Mebp, inf_SLV1)
+        movwx_mi(Mebp, inf_LOC, IB(3))
+
+    LBL(100505) /* sl1_beg */
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        xorpx_rr(Xmm0, Xmm0)
+        movyx_ld(Redx, Mebx, DP(Q*0x000))
+
+    LBL(100506) /* ch1_beg */
+
+        movxx_ri(Redi, IB(0))
+
+    LBL(100507) /* ln1_beg */
+
+        movyx_ld(Reax, Sesi(Redi), DP(Q*0x000))
+        movyx_ld(Reax, Iecx, AJ0)
+        movyx_st(Reax, Sebx(Redi), DP(Q*0x020))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 100507b) /* ln1_beg */
+
+        movpx_ld(Xmm1, Mebx, DP(Q*0x020))
+        mulps_ld(Xmm1, Mesi, DP(Q*0x010))
+        addps_rr(Xmm0, Xmm1)
+        addxx_ri(Resi, IM(Q*0x020))
+        arjyx_ri(Redx, IB(1), sub_x,
+        /* if */ NZ_x, 100506b) /* ch1_beg */
+
+        /* scatter y lanes to rows in original order */
+        movpx_st(Xmm0, Mebx, DP(Q*0x020))
+        movxx_ld(Redx, Mebp, inf_FSO2)
+        movxx_ri(Redi, IB(0))
+
+    LBL(100508) /* sc1_beg */
+
+        movyx_ld(Reax, Sebx(Redi), DP(Q*0x010))
+        movyx_ld(Recx, Sebx(Redi), DP(Q*0x020))
+        movyx_st(Recx, Iedx, AJ0)
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 100508b) /* sc1_beg */
+
+        addxx_ri(Rebx, IM(Q*0x030))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 100505b) /* sl1_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test60(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (A0*farr)[%d] = %e, (A1*farr)[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (A0*farr)[%d] = %e, (A1*farr)[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 60 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 61   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 61
+
+/*
+ * Batched small-matrix, quaternion and nearest-centroid sub-tests 61-63
+ * (rtgeom.h).
+ * C++ sections work on AoS records (one object per record) with scalar code,
+ * ASM sections work on SoA blocks of S objects (one object per SIMD lane),
+ * where each operand takes a slot of up to 16 fields (one SIMD vector each).
+ * Operands are listed in slot order with offsets (in rt_real) in AoS records.
+ * Matrices (gtab[0] blocks, gaos[0] records):
+ *     A(3x3), B(3x3), M(4x4), P(3d) - inputs,
+ *     A*B, A*P, M*M, M*[P, 1], inv A, det A, inv M, det M - results,
+ *     the last slot in SoA blocks is a scratch for minors of inv M
+ *     (M*M with burst ld/st in sub-test 72).
+ * Quaternions (gtab[1] blocks, gaos[1] records):
+ *     Q1 (not normalized), Q2 (normalized), t in [0, 1] - inputs,
+ *     Q1*Q2, Q1/|Q1|, slerp(Q1/|Q1|, Q2, t) - results.
+ * Slerp coefficients table from RT_GEOM_SLERP_SET is at gtab[2].
+ * Nearest-centroid search (k-means assignment step):
+ *     3d points in SoA blocks at gtab[3] (AoS at gaos[2]),
+ *     KMN_SIZE centroids broadcast to SIMD vectors at gtab[4] (AoS at gaos[3]),
+ *     assignments to the first KMN_HEAD and all KMN_SIZE centroids.
+ * As each ASM pass takes ARR_SIZE points, use -c to scale the total number
+ * of points processed in benchmarks (e.g. -c 100000 for about 1M with S = 4).
+ */
+#define GEO_MSLT            13 /* slots in SoA matrix block */
+#define GEO_MLEN            96 /* rt_reals in AoS matrix record (padded) */
+#define GEO_QSLT            6  /* slots in SoA quaternion block */
+#define GEO_QLEN            24 /* rt_reals in AoS quaternion record (padded) */
+
+#define KMN_HEAD            8  /* centroids in 1st assignment */
+#define KMN_SIZE            64 /* centroids in 2nd assignment (up to 256) */
+
+#define GS(k)               DH(Q*0x100*(k)) /* slot within SoA block */
+
+rt_si32 geo_mof[12] = {  0,  9, 18, 34, 37, 46, 49, 65, 68, 77, 78, 94 };
+rt_si32 geo_mnf[12] = {  9,  9, 16,  3,  9,  3, 16,  3,  9,  1, 16,  1 };
+rt_si32 geo_qof[6]  = {  0,  4,  8,  9, 13, 17 };
+rt_si32 geo_qnf[6]  = {  4,  4,  1,  4,  4,  4 };
+
+const rt_char *geo_mnm[12] =
+{
+    "A", "B", "M", "P", "A*B", "A*P", "M*M", "M*[P,1]",
+    "inv A", "det A", "inv M", "det M",
+};
+
+const rt_char *geo_qnm[6] =
+{
+    "Q1", "Q2", "t", "Q1*Q2", "Q1/|Q1|", "slerp",
+};
+
+/*
+ * Return k-th field of j-th object in SoA blocks of "slt" slots (at "soa").
+ */
+rt_real *geo_fld(rt_real *soa, rt_si32 slt, rt_si32 j, rt_si32 s, rt_si32 k)
+{
+    return soa + ((j / S) * slt + s) * 16 * S + k * S + j % S;
+}
+
+rt_real geo_val(rt_si32 j, rt_si32 k) /* off-diagonal value in [-0.2, +0.2] */
+{
+    return (rt_real)(((j * 7 + k * 5) % 11) - 5) / (rt_real)25.0;
+}
+
+/*
+ * Build matrix and quaternion inputs in both AoS and SoA forms within
+ * SIMD-aligned memory (mem), return the total size in bytes,
+ * only compute the size if mem is NULL.
+ */
+rt_size geo_init(rt_SIMD_INFOX *info, rt_byte *mem)
+{
+    rt_si32 j, k, s, n = info->size;
+    rt_size used = 0;
+
+    rt_pntr *gtab = (rt_pntr *)spm_take(mem, &used, 23 * sizeof(rt_pntr));
+    rt_real *gmat = (rt_real *)spm_take(mem, &used,
+                                n * GEO_MLEN * sizeof(rt_real));
+    rt_real *gqua = (rt_real *)spm_take(mem, &used,
+                                n * GEO_QLEN * sizeof(rt_real));
+    rt_real *smat = (rt_real *)spm_take(mem, &used,
+                                n * GEO_MSLT * 16 * sizeof(rt_real));
+    rt_real *squa = (rt_real *)spm_take(mem, &used,
+                                n * GEO_QSLT * 16 * sizeof(rt_real));
+    rt_real *stab = (rt_real *)spm_take(mem, &used,
+                                16 * S * sizeof(rt_real));
+    rt_real *gpnt = (rt_real *)spm_take(mem, &used,
+                                n * 3 * sizeof(rt_real));
+    rt_real *gctr = (rt_real *)spm_take(mem, &used,
+                                KMN_SIZE * 3 * sizeof(rt_real));
+    rt_real *spnt = (rt_real *)spm_take(mem, &used,
+                                n * 3 * sizeof(rt_real));
+    rt_real *sctr = (rt_real *)spm_take(mem, &used,
+                                KMN_SIZE * 3 * S * sizeof(rt_real));
+
+    if (mem == RT_NULL)
+    {
+        return used;
+    }
+
+    for (j = 0; j < n; j++)
+    {
+        rt_real *g = gmat + j * GEO_MLEN;
+        rt_real *q = gqua + j * GEO_QLEN;
+
+        /* diagonally dominant A and M, so that inverses are well-defined */
+        for (k = 0; k < 9; k++)
+        {
+            g[ 0 + k] = geo_val(j, k) + (k % 4 == 0 ? (rt_real)2.0 : 0);
+            g[ 9 + k] = geo_val(j + 3, k) + (k % 4 == 0 ? (rt_real)1.0 : 0);
+        }
+        for (k = 0; k < 16; k++)
+        {
+            g[18 + k] = geo_val(j + 5, k) + (k % 5 == 0 ? (rt_real)1.5 : 0);
+        }
+        for (k = 0; k < 3; k++)
+        {
+            g[34 + k] = (rt_real)(j % 9 - 4 + k) / (rt_real)2.0;
+        }
+
+        q[0] = (rt_real)0.3 + (rt_real)0.1 * (j % 5);
+        q[1] = (rt_real)-0.2 + (rt_real)0.05 * (j % 7);
+        q[2] = (rt_real)0.5 - (rt_real)0.1 * (j % 3);
+        q[3] = (rt_real)1.0 + (rt_real)0.1 * (j % 4);
+
+        q[4] = (rt_real)-0.4 + (rt_real)0.1 * (j % 6);
+        q[5] = (rt_real)0.6 - (rt_real)0.1 * (j % 5);
+        q[6] = (rt_real)0.2 * (j % 3) - (rt_real)0.1;
+        q[7] = (rt_real)((j & 1) ? -1.0 : +1.0) * /* both arcs */
+               ((rt_real)0.5 + (rt_real)0.1 * (j % 4));
+
+        rt_real r = RT_SQRT(q[4]*q[4] + q[5]*q[5] + q[6]*q[6] + q[7]*q[7]);
+        for (k = 4; k < 8; k++)
+        {
+            q[k] /= r;
+        }
+
+        q[8] = (rt_real)(j % 11) / (rt_real)10.0;
+
+        for (s = 0; s < 4; s++)
+        {
+            for (k = 0; k < geo_mnf[s]; k++)
+            {
+                *geo_fld(smat, GEO_MSLT, j, s, k) = g[geo_mof[s] + k];
+            }
+        }
+        for (s = 0; s < 3; s++)
+        {
+            for (k = 0; k < geo_qnf[s]; k++)
+            {
+                *geo_fld(squa, GEO_QSLT, j, s, k) = q[geo_qof[s] + k];
+            }
+        }
+    }
+
+    RT_GEOM_SLERP_SET(stab);
+
+    for (j = 0; j < n; j++)
+    {
+        for (k = 0; k < 3; k++)
+        {
+            gpnt[j*3 + k] = (rt_real)((j * (5 + k * 2) + k) % 23) / 5.0 - 2.2;
+            spnt[(j / S)*3*S + k*S + j % S] = gpnt[j*3 + k];
+        }
+    }
+    for (j = 0; j < KMN_SIZE; j++)
+    {
+        for (k = 0; k < 3; k++)
+        {
+            gctr[j*3 + k] = (rt_real)((j * (37 + k * 16)) % (101 - k * 4))
+                                                        / 23.0 - 2.2;
+            RT_SIMD_SET((sctr + (j*3 + k)*S), gctr[j*3 + k]);
+        }
+    }
+
+    gtab[0] = smat;
+    gtab[1] = squa;
+    gtab[2] = stab;
+    gtab[3] = spnt;
+    gtab[4] = sctr;
+
+    info->gtab = gtab;
+    info->gaos[0] = gmat;
+    info->gaos[1] = gqua;
+    info->gaos[2] = gpnt;
+    info->gaos[3] = gctr;
+
+    return used;
+}
+
+rt_void c_test61(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, r, c, n = info->size;
+
+    rt_real *gmat = info->gaos[0];
+
+    for (j = 0; j < n; j++)
+    {
+        rt_real *g = gmat + j * GEO_MLEN;
+        rt_real *a = g + 0, *b = g + 9, *m = g + 18, *p = g + 34;
+
+        for (r = 0; r < 3; r++)
+        {
+            for (c = 0; c < 3; c++)
+            {
+                g[37 + r*3 + c] = a[r*3+0] * b[0+c] + a[r*3+1] * b[3+c]
+                                + a[r*3+2] * b[6+c];
+            }
+            g[46 + r] = a[r*3+0] * p[0] + a[r*3+1] * p[1] + a[r*3+2] * p[2];
+        }
+
+        for (r = 0; r < 4; r++)
+        {
+            for (c = 0; c < 4; c++)
+            {
+                g[49 + r*4 + c] = m[r*4+0] * m[0+c] + m[r*4+1] * m[4+c]
+                                + m[r*4+2] * m[8+c] + m[r*4+3] * m[12+c];
+            }
+        }
+        for (r = 0; r < 3; r++)
+        {
+            g[65 + r] = m[r*4+0] * p[0] + m[r*4+1] * p[1]
+                      + m[r*4+2] * p[2] + m[r*4+3];
+        }
+
+        /* 3x3 inverse via adjugate */
+        rt_real *i3 = g + 68;
+
+        i3[0] = a[4] * a[8] - a[5] * a[7];
+        i3[3] = a[5] * a[6] - a[3] * a[8];
+        i3[6] = a[3] * a[7] - a[4] * a[6];
+
+        rt_real d3 = a[0] * i3[0] + a[1] * i3[3] + a[2] * i3[6];
+
+        i3[1] = a[2] * a[7] - a[1] * a[8];
+        i3[2] = a[1] * a[5] - a[2] * a[4];
+        i3[4] = a[0] * a[8] - a[2] * a[6];
+        i3[5] = a[2] * a[3] - a[0] * a[5];
+        i3[7] = a[1] * a[6] - a[0] * a[7];
+        i3[8] = a[0] * a[4] - a[1] * a[3];
+
+        for (c = 0; c < 9; c++)
+        {
+            i3[c] /= d3;
+        }
+        g[77] = d3;
+
+        /* 4x4 inverse via 2x2 minors of upper and lower rows */
+        rt_real *i4 = g + 78;
+
+        rt_real s0 = m[0] * m[5]  - m[4]  * m[1];
+        rt_real s1 = m[0] * m[6]  - m[4]  * m[2];
+        rt_real s2 = m[0] * m[7]  - m[4]  * m[3];
+        rt_real s3 = m[1] * m[6]  - m[5]  * m[2];
+        rt_real s4 = m[1] * m[7]  - m[5]  * m[3];
+        rt_real s5 = m[2] * m[7]  - m[6]  * m[3];
+
+        rt_real c0 = m[8] * m[13] - m[12] * m[9];
+        rt_real c1 = m[8] * m[14] - m[12] * m[10];
+        rt_real c2 = m[8] * m[15] - m[12] * m[11];
+        rt_real c3 = m[9] * m[14] - m[13] * m[10];
+        rt_real c4 = m[9] * m[15] - m[13] * m[11];
+        rt_real c5 = m[10]* m[15] - m[14] * m[11];
+
+        rt_real d4 = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+        i4[0]  = ( m[5]  * c5 - m[6]  * c4 + m[7]  * c3) / d4;
+        i4[1]  = (-m[1]  * c5 + m[2]  * c4 - m[3]  * c3) / d4;
+        i4[2]  = ( m[13] * s5 - m[14] * s4 + m[15] * s3) / d4;
+        i4[3]  = (-m[9]  * s5 + m[10] * s4 - m[11] * s3) / d4;
+        i4[4]  = (-m[4]  * c5 + m[6]  * c2 - m[7]  * c1) / d4;
+        i4[5]  = ( m[0]  * c5 - m[2]  * c2 + m[3]  * c1) / d4;
+        i4[6]  = (-m[12] * s5 + m[14] * s2 - m[15] * s1) / d4;
+        i4[7]  = ( m[8]  * s5 - m[10] * s2 + m[11] * s1) / d4;
+        i4[8]  = ( m[4]  * c4 - m[5]  * c2 + m[7]  * c0) / d4;
+        i4[9]  = (-m[0]  * c4 + m[1]  * c2 - m[3]  * c0) / d4;
+        i4[10] = ( m[12] * s4 - m[13] * s2 + m[15] * s0) / d4;
+        i4[11] = (-m[8]  * s4 + m[9]  * s2 - m[11] * s0) / d4;
+        i4[12] = (-m[4]  * c3 + m[5]  * c1 - m[6]  * c0) / d4;
+        i4[13] = ( m[0]  * c3 - m[1]  * c1 + m[2]  * c0) / d4;
+        i4[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) / d4;
+        i4[15] = ( m[8]  * s3 - m[9]  * s1 + m[10] * s0) / d4;
+        g[94] = d4;
+    }
+}
+
+rt_void s_test61(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x000*P+E))
+        movwx_ri(Reax, IB(3)) /* ARR_SIZE / S */
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(106101) /* blk_beg */
+
+        adrxx_ld(Resi, Mebx, GS(1))
+        adrxx_ld(Redx, Mebx, GS(4))
+        mm3ps_mm(Medx, Mebx, Mesi, Xmm0, Xmm1, Xmm2, Xmm3, Xmm4)
+
+        adrxx_ld(Resi, Mebx, GS(3))
+        adrxx_ld(Redx, Mebx, GS(5))
+        tr3ps_mm(Medx, Mebx, Mesi, Xmm0, Xmm1, Xmm2, Xmm3, Xmm4)
+
+        adrxx_ld(Redx, Mebx, GS(2))
+        adrxx_ld(Redi, Mebx, GS(6))
+        mm4ps_mm(Medi, Medx, Medx, Xmm0, Xmm1, Xmm2, Xmm3, Xmm4, Xmm5)
+
+        adrxx_ld(Redi, Mebx, GS(7))
+        tr4ps_mm(Medi, Medx, Mesi, Xmm0, Xmm1, Xmm2, Xmm3, Xmm4)
+
+        adrxx_ld(Redi, Mebx, GS(8))
+        iv3ps_mm(Medi, Mebx, Xmm0, Xmm1, Xmm2, Xmm3, Xmm4)
+
+        adrxx_ld(Redi, Mebx, GS(9))
+        dt3ps_mm(Medi, Mebx, Xmm0, Xmm1, Xmm2)
+
+        adrxx_ld(Redi, Mebx, GS(10))
+        adrxx_ld(Resi, Mebx, GS(12))
+        iv4ps_mm(Medi, Medx, Mesi, Xmm0, Xmm1, Xmm2, Xmm3)
+
+        adrxx_ld(Redi, Mebx, GS(11))
+        dt4ps_mm(Medi, Medx, Xmm0, Xmm1, Xmm2, Xmm3)
+
+        addxx_ri(Rebx, IH(Q*0x100*GEO_MSLT))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 106101b) /* blk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test61(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, s, n = info->size;
+
+    rt_real *gmat = info->gaos[0];
+    rt_real *smat = (rt_real *)info->gtab[0];
+
+    j = n;
+    while (j-->0)
+    {
+        rt_real *g = gmat + j * GEO_MLEN;
+
+        for (s = 4; s < 12; s++)
+        {
+            for (k = 0; k < geo_mnf[s]; k++)
+            {
+                rt_real fco = g[geo_mof[s] + k];
+                rt_real fso = *geo_fld(smat, GEO_MSLT, j, s, k);
+
+                if (FEQ(fco, fso) && !v_mode)
+                {
+                    continue;
+                }
+
+                RT_LOGI("A[%d][0] = %e, B[%d][0] = %e, M[%d][0] = %e\n",
+                        j, g[0], j, g[9], j, g[18]);
+#ifdef RT_PRINT_CPP
+                RT_LOGI("C (%s)[%d][%d] = %e\n",
+                        geo_mnm[s], j, k, fco);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+                RT_LOGI("S (%s)[%d][%d] = %e\n",
+                        geo_mnm[s], j, k, fso);
+#endif /* RT_PRINT_ASM */
+            }
+        }
+    }
+}
+
+#endif /* SUB_TEST 61 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 62   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 62
+
+rt_void c_test62(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *gqua = info->gaos[1];
+
+    for (j = 0; j < n; j++)
+    {
+        rt_real *q = gqua + j * GEO_QLEN;
+        rt_real *a = q + 0, *b = q + 4, t = q[8];
+        rt_real *qm = q + 9, *qn = q + 13, *qs = q + 17;
+
+        qm[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+        qm[1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+        qm[2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+        qm[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+
+        rt_real r = RT_SQRT(a[0]*a[0] + a[1]*a[1] + a[2]*a[2] + a[3]*a[3]);
+        for (k = 0; k < 4; k++)
+        {
+            qn[k] = a[k] / r;
+        }
+
+        rt_real x = qn[0]*b[0] + qn[1]*b[1] + qn[2]*b[2] + qn[3]*b[3];
+        rt_real f = x < 0.0 ? (rt_real)-1.0 : (rt_real)+1.0;
+        rt_real h = RT_ACOS(x * f);
+        rt_real w = RT_SIN(h);
+
+        rt_real cd = w < (rt_real)0.001 ? 1 - t : RT_SIN((1 - t) * h) / w;
+        rt_real ct = w < (rt_real)0.001 ? t       : RT_SIN(t * h) / w;
+
+        for (k = 0; k < 4; k++)
+        {
+            qs[k] = cd * qn[k] + ct * f * b[k];
+        }
+    }
+}
+
+rt_void s_test62(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x004*P+E))
+        movxx_ld(Recx, Mecx, DP(0x008*P+E))
+        movwx_ri(Reax, IB(3)) /* ARR_SIZE / S */
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(106201) /* blk_beg */
+
+        adrxx_ld(Resi, Mebx, GS(1))
+        adrxx_ld(Redx, Mebx, GS(3))
+        qmlps_mm(Medx, Mebx, Mesi, Xmm0, Xmm1, Xmm2, Xmm3, Xmm4, Xmm5)
+
+        adrxx_ld(Redx, Mebx, GS(4))
+        qnrps_mm(Medx, Mebx, Xmm0, Xmm1, Xmm2)
+
+        adrxx_ld(Redi, Mebx, GS(2))
+        adrxx_ld(Rebx, Mebx, GS(5)) /* block's last slot */
+        qslps_mm(Mebx, Medx, Mesi, Medi, Mecx,
+                 Xmm0, Xmm1, Xmm2, Xmm3, Xmm4, Xmm5, Xmm6)
+
+        addxx_ri(Rebx, IH(Q*0x100*(GEO_QSLT-5)))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 106201b) /* blk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test62(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, s, n = info->size;
+
+    rt_real *gqua = info->gaos[1];
+    rt_real *squa = (rt_real *)info->gtab[1];
+
+    j = n;
+    while (j-->0)
+    {
+        rt_real *q = gqua + j * GEO_QLEN;
+
+        for (s = 3; s < 6; s++)
+        {
+            for (k = 0; k < geo_qnf[s]; k++)
+            {
+                rt_real fco = q[geo_qof[s] + k];
+                rt_real fso = *geo_fld(squa, GEO_QSLT, j, s, k);
+
+                if (FEQ(fco, fso) && !v_mode)
+                {
+                    continue;
+                }
+
+                RT_LOGI("Q1[%d][%d] = %e, Q2[%d][%d] = %e, t[%d] = %e\n",
+                        j, k, q[k], j, k, q[4+k], j, q[8]);
+#ifdef RT_PRINT_CPP
+                RT_LOGI("C (%s)[%d][%d] = %e\n",
+                        geo_qnm[s], j, k, fco);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+                RT_LOGI("S (%s)[%d][%d] = %e\n",
+                        geo_qnm[s], j, k, fso);
+#endif /* RT_PRINT_ASM */
+            }
+        }
+    }
+}
+
+#endif /* SUB_TEST 62 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 63   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 63
+
+rt_real kmn_dst(rt_real *p, rt_real *c) /* squared distance, AoS */
+{
+    rt_real x = p[0] - c[0], y = p[1] - c[1], z = p[2] - c[2];
+    return x * x + y * y + z * z;
+}
+
+rt_void c_test63(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_real *pnts = info->gaos[2];
+    rt_real *ctrs = info->gaos[3];
+
+    for (j = 0; j < n; j++)
+    {
+        rt_real *p = pnts + j * 3;
+        rt_real d, m = kmn_dst(p, ctrs);
+        rt_si32 i = 0;
+
+        for (k = 1; k < KMN_SIZE; k++)
+        {
+            d = kmn_dst(p, ctrs + k * 3);
+            if (d < m)
+            {
+                m = d;
+                i = k;
+            }
+            if (k == KMN_HEAD - 1)
+            {
+                ico1[j] = i;
+            }
+        }
+
+        ico2[j] = i;
+    }
+}
+
+rt_void s_test63(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x00C*P+E))
+        movxx_ld(Recx, Mecx, DP(0x010*P+E))
+        movxx_ld(Resi, Mebp, inf_ISO1)
+        movxx_ld(Redi, Mebp, inf_ISO2)
+        movwx_ri(Reax, IB(3)) /* ARR_SIZE / S */
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(106301) /* blk_beg */
+
+        movpx_ld(Xmm0, Mebx, GF(0))
+        movpx_ld(Xmm1, Mebx, GF(1))
+        movpx_ld(Xmm2, Mebx, GF(2))
+
+        /* first KMN_HEAD centroids */
+        movxx_rr(Redx, Recx)
+        sd3ps_ld(Xmm3, Xmm7, Xmm0, Xmm1, Xmm2, Medx)
+        xorpx_rr(Xmm4, Xmm4)
+        xorpx_rr(Xmm5, Xmm5)
+        movxx_ri(Reax, IM(KMN_HEAD-1))
+
+    LBL(106302) /* hd0_beg */
+
+        addxx_ri(Redx, IM(Q*0x030))
+        addps_ld(Xmm5, Mebp, inf_GPC01)
+        sd3ps_ld(Xmm6, Xmm7, Xmm0, Xmm1, Xmm2, Medx)
+        amnps_rr(Xmm3, Xmm4, Xmm6, Xmm5, Xmm7)
+        arjxx_ri(Reax, IB(1), sub_x,
+        /* if */ NZ_x, 106302b) /* hd0_beg */
+
+        cvzps_rr(Xmm6, Xmm4)
+        movpx_st(Xmm6, Mesi, AJ0)
+
+        /* remaining centroids up to KMN_SIZE */
+        movxx_ri(Reax, IM(KMN_SIZE-KMN_HEAD))
+
+    LBL(106303) /* tl0_beg */
+
+        addxx_ri(Redx, IM(Q*0x030))
+        addps_ld(Xmm5, Mebp, inf_GPC01)
+        sd3ps_ld(Xmm6, Xmm7, Xmm0, Xmm1, Xmm2, Medx)
+        amnps_rr(Xmm3, Xmm4, Xmm6, Xmm5, Xmm7)
+        arjxx_ri(Reax, IB(1), sub_x,
+        /* if */ NZ_x, 106303b) /* tl0_beg */
+
+        cvzps_rr(Xmm6, Xmm4)
+        movpx_st(Xmm6, Medi, AJ0)
+
+        addxx_ri(Rebx, IM(Q*0x030))
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 106301b) /* blk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test63(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    rt_real *pnts = info->gaos[2];
+    rt_real *ctrs = info->gaos[3];
+
+    j = n;
+    while (j-->0)
+    {
+        rt_real *p = pnts + j * 3;
+
+        /* equidistant centroids may be resolved differently with fma */
+        if (FEQ(kmn_dst(p, ctrs + ico1[j] * 3), kmn_dst(p, ctrs + iso1[j] * 3))
+        &&  FEQ(kmn_dst(p, ctrs + ico2[j] * 3), kmn_dst(p, ctrs + iso2[j] * 3))
+        &&  !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("pnts[%d] = (%e, %e, %e)\n",
+                j, p[0], p[1], p[2]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (K=%d)[%d] = %d, (K=%d)[%d] = %d\n",
+                KMN_HEAD, j, (rt_si32)ico1[j], KMN_SIZE, j, (rt_si32)ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (K=%d)[%d] = %d, (K=%d)[%d] = %d\n",
+                KMN_HEAD, j, (rt_si32)iso1[j], KMN_SIZE, j, (rt_si32)iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 63 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 64   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 64
+
+/*
+ * Register-blocked Bloom filter sub-tests 64-65 (rthash.h).
+ * Filter of BLM_BLKS blocks (one SIMD vector each) is cleared and filled
+ * with BLM_KEYS keys (16 bits per key), then probed with 2*BLM_KEYS keys,
+ * where the first half was inserted and the second half was not.
+ * C++ sections use scalar code with the same hash and per-lane masks,
+ * ASM sections hash S keys at once and set/test all lanes of a block at once.
+ * Data (gtab[5..8]): constants table, filter, keys, probe results,
+ * C++ only (gblm[0..1]): filter, probe results.
+ * Constants table is followed by a field for S hashes and S fields
+ * for their broadcasts, probe results follow keys in memory.
+ * As each pass inserts (probes) all keys, use -c to scale the total number
+ * of keys processed in benchmarks, false-positive rate is shown in sub-test 65.
+ */
+#define BLM_BLKS            32 /* blocks in filter (SIMD vectors) */
+#define BLM_LOG             5  /* log2 of BLM_BLKS */
+#define BLM_KEYS            (BLM_BLKS * S * RT_ELEMENT / 16)
+
+rt_uelm blm_hash(rt_elem key) /* same as hshpx_ld */
+{
+    rt_uelm h = (rt_uelm)key * (rt_uelm)RT_BLOOM_MUL;
+    h ^= h >> (RT_ELEMENT/2 - 1);
+    return h * (rt_uelm)RT_BLOOM_MUL;
+}
+
+rt_uelm blm_mask(rt_elem *btab, rt_uelm h, rt_si32 i) /* as blmpx_ld */
+{
+    rt_uelm t = h * (rt_uelm)btab[2*S + i];
+    return (rt_uelm)1 << (t >> (RT_ELEMENT - RT_BLOOM_LOG));
+}
+
+/*
+ * Build Bloom filter tables within SIMD-aligned memory (mem),
+ * return the total size in bytes, only compute the size if mem is NULL.
+ */
+rt_size blm_init(rt_SIMD_INFOX *info, rt_byte *mem)
+{
+    rt_si32 j;
+    rt_size used = 0;
+
+    rt_elem *btab = (rt_elem *)spm_take(mem, &used,
+                                (RT_BLOOM_FLD + 1 + S) * S * sizeof(rt_elem));
+    rt_elem *sflt = (rt_elem *)spm_take(mem, &used,
+                                BLM_BLKS * S * sizeof(rt_elem));
+    rt_elem *cflt = (rt_elem *)spm_take(mem, &used,
+                                BLM_BLKS * S * sizeof(rt_elem));
+    rt_elem *keys = (rt_elem *)spm_take(mem, &used,
+                                BLM_KEYS * 4 * sizeof(rt_elem));
+    rt_elem *cres = (rt_elem *)spm_take(mem, &used,
+                                BLM_KEYS * 2 * sizeof(rt_elem));
+
+    if (mem == RT_NULL)
+    {
+        return used;
+    }
+
+    RT_BLOOM_SET(btab);
+
+    for (j = 0; j < BLM_KEYS * 2; j++)
+    {
+        keys[j] = (rt_elem)(j * 7919 + 13); /* distinct keys */
+    }
+
+    info->gtab[5] = btab;
+    info->gtab[6] = sflt;
+    info->gtab[7] = keys;
+    info->gtab[8] = keys + BLM_KEYS * 2;
+
+    info->gblm[0] = cflt;
+    info->gblm[1] = cres;
+
+    return used;
+}
+
+rt_void c_test64(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j;
+
+    rt_elem *btab = (rt_elem *)info->gtab[5];
+    rt_elem *keys = (rt_elem *)info->gtab[7];
+    rt_elem *cflt = info->gblm[0];
+
+    for (j = 0; j < BLM_BLKS * S; j++)
+    {
+        cflt[j] = 0;
+    }
+
+    for (j = 0; j < BLM_KEYS; j++)
+    {
+        rt_uelm h = blm_hash(keys[j]);
+        rt_elem *b = cflt + (h >> (RT_ELEMENT - BLM_LOG)) * S;
+
+        for (i = 0; i < S; i++)
+        {
+            b[i] |= (rt_elem)blm_mask(btab, h, i);
+        }
+    }
+}
+
+rt_void s_test64(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x018*P+E))
+        movxx_ld(Resi, Mecx, DP(0x01C*P+E))
+        movxx_ld(Recx, Mecx, DP(0x014*P+E))
+
+        xorpx_rr(Xmm0, Xmm0)
+        movxx_rr(Redx, Rebx)
+        movxx_ri(Reax, IM(BLM_BLKS))
+
+    LBL(106401) /* clr_beg */
+
+        movpx_st(Xmm0, Medx, DP(0))
+        addxx_ri(Redx, IM(Q*0x010))
+        arjxx_ri(Reax, IB(1), sub_x,
+        /* if */ NZ_x, 106401b) /* clr_beg */
+
+        movxx_ri(Reax, IM(BLM_KEYS/S))
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(106402) /* blk_beg */
+
+        movpx_ld(Xmm1, Mesi, DP(0))
+        hshpx_ld(Xmm1, Xmm2, Mecx)
+        movpx_st(Xmm1, Mecx, DP(Q*0x030))
+        movxx_ri(Redi, IB(0))
+        adrxx_ld(Redx, Mecx, DP(Q*0x040))
+
+    LBL(106403) /* bct_beg */
+
+        movyx_ld(Reax, Secx(Redi), DP(Q*0x030))
+        blbyx_st(Reax, Medx)
+        addxx_ri(Redx, IM(Q*0x010))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 106403b) /* bct_beg */
+
+        movxx_ri(Redi, IB(0))
+        adrxx_ld(Redx, Mecx, DP(Q*0x040))
+
+    LBL(106404) /* key_beg */
+
+        blmpx_ld(Xmm0, Xmm2, Mecx, Medx, DP(0))
+        movyx_ld(Reax, Secx(Redi), DP(Q*0x030))
+        shryx_ri(Reax, IB(RT_ELEMENT-BLM_LOG))
+        mulyx_ri(Reax, IM(Q*0x010))
+        blspx_st(Xmm0, Iebx, DP(0))
+        addxx_ri(Redx, IM(Q*0x010))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 106404b) /* key_beg */
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 106402b) /* blk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test64(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_elem *sflt = (rt_elem *)info->gtab[6];
+    rt_elem *cflt = info->gblm[0];
+
+    j = BLM_BLKS * S;
+    while (j-->0)
+    {
+        if (IEQ(cflt[j], sflt[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C filt[%d][%d] = %" PR_L "X\n",
+                j / S, j % S, cflt[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S filt[%d][%d] = %" PR_L "X\n",
+                j / S, j % S, sflt[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 64 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 65   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 65
+
+rt_void c_test65(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j;
+
+    rt_elem *btab = (rt_elem *)info->gtab[5];
+    rt_elem *keys = (rt_elem *)info->gtab[7];
+    rt_elem *cflt = info->gblm[0];
+    rt_elem *cres = info->gblm[1];
+
+    for (j = 0; j < BLM_KEYS * 2; j++)
+    {
+        rt_uelm h = blm_hash(keys[j]);
+        rt_elem *b = cflt + (h >> (RT_ELEMENT - BLM_LOG)) * S;
+        rt_uelm m;
+
+        cres[j] = 1;
+        for (i = 0; i < S; i++)
+        {
+            m = blm_mask(btab, h, i);
+            if (((rt_uelm)b[i] & m) != m)
+            {
+                cres[j] = 0;
+                break;
+            }
+        }
+    }
+}
+
+rt_void s_test65(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x018*P+E))
+        movxx_ld(Resi, Mecx, DP(0x01C*P+E))
+        movxx_ld(Recx, Mecx, DP(0x014*P+E))
+        movxx_ri(Reax, IM(BLM_KEYS*2/S))
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(106501) /* blk_beg */
+
+        movpx_ld(Xmm1, Mesi, DP(0))
+        hshpx_ld(Xmm1, Xmm2, Mecx)
+        movpx_st(Xmm1, Mecx, DP(Q*0x030))
+        movxx_ri(Redi, IB(0))
+        adrxx_ld(Redx, Mecx, DP(Q*0x040))
+
+    LBL(106502) /* bct_beg */
+
+        movyx_ld(Reax, Secx(Redi), DP(Q*0x030))
+        blbyx_st(Reax, Medx)
+        addxx_ri(Redx, IM(Q*0x010))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 106502b) /* bct_beg */
+
+        movxx_ri(Redi, IB(0))
+        adrxx_ld(Redx, Mecx, DP(Q*0x040))
+
+    LBL(106503) /* key_beg */
+
+        blmpx_ld(Xmm0, Xmm2, Mecx, Medx, DP(0))
+        movyx_ld(Reax, Secx(Redi), DP(Q*0x030))
+        shryx_ri(Reax, IB(RT_ELEMENT-BLM_LOG))
+        mulyx_ri(Reax, IM(Q*0x010))
+        bltpx_ld(Xmm1, Xmm0, Iebx, DP(0))
+        movyx_mi(Sesi(Redi), DV(BLM_KEYS*2*4*L), IB(1))
+        mkjpx_rx(Xmm1, FULL, 106504f) /* key_end */
+        movyx_mi(Sesi(Redi), DV(BLM_KEYS*2*4*L), IB(0))
+
+    LBL(106504) /* key_end */
+
+        addxx_ri(Redx, IM(Q*0x010))
+        addxx_ri(Redi, IB(4*L))
+        cmjxx_ri(Redi, IM(Q*0x010),
+        /* if */ LT_x, 106503b) /* key_beg */
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 106501b) /* blk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test65(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k = 0;
+
+    rt_elem *keys = (rt_elem *)info->gtab[7];
+    rt_elem *sres = (rt_elem *)info->gtab[8];
+    rt_elem *cres = info->gblm[1];
+
+    j = BLM_KEYS * 2;
+    while (j-->0)
+    {
+        k += j >= BLM_KEYS && sres[j] != 0; /* false positives */
+
+        if (IEQ(cres[j], sres[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("keys[%d] = %" PR_L "X\n",
+                j, keys[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (keys[%d] in filt) = %d\n",
+                j, (rt_si32)cres[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (keys[%d] in filt) = %d\n",
+                j, (rt_si32)sres[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+#ifdef RT_PRINT_NUM
+    RT_LOGI("Rate FP  = %6.3f%%\n", 100.0 * k / BLM_KEYS);
+#endif /* RT_PRINT_NUM */
+}
+
+#endif /* SUB_TEST 65 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 66   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 66
+
+/*
+ * LZ77 match-length and decode sub-tests 66-67 (rtcode.h).
+ * Synthetic text corpus of LZC_SIZE bytes (words, punctuation, short runs
+ * and repeated phrases) is parsed in C++ init with a single-entry hash table
+ * (4-byte prefixes), giving (position, candidate, limit) pairs for match
+ * lengths (sub-test 66) and a greedy token stream (literals, length,
+ * distance) for decode (67).
+ * C++ sections use scalar byte loops, ASM sections compare/copy SIMD vectors
+ * at arbitrary byte offsets (mvumx_ld/mvumx_st) and find the mismatching byte
+ * with ceqmb_rr and mlnmb_rr (mask-to-index).
+ * Data (gtab[9..13]): corpus, pair records, tokens, literals, decoded output,
+ * C++ only (glzl, glzo): match lengths, decoded output.
+ * Pair records are 4 P-size fields: position, candidate, position + limit
+ * (pointers), match length (ASM result), the last one has zero limit pointer.
+ * Tokens are 4 rt_si32 fields: literals, match length, distance, unused,
+ * the last one has zero match length.
+ */
+#define LZC_SIZE            4096 /* corpus size in bytes */
+#define LZC_MINM            4    /* min match length */
+#define LZC_MAXM            258  /* max match length */
+#define LZC_HASH            12   /* log2 of hash table size */
+#define LZC_SLCK            (Q*16) /* slack past the end of buffers */
+
+rt_si32 lzc_hash(rt_byte *p)
+{
+    rt_ui32 h = p[0] | p[1] << 8 | p[2] << 16 | (rt_ui32)p[3] << 24;
+    return (rt_si32)((h * 2654435761U) >> (32 - LZC_HASH));
+}
+
+rt_si32 lzc_mlen(rt_byte *p, rt_byte *q, rt_si32 lim) /* scalar reference */
+{
+    rt_si32 l = 0;
+    while (l < lim && p[l] == q[l])
+    {
+        l++;
+    }
+    return l;
+}
+
+/*
+ * Build LZ77 corpus, pairs and tokens within SIMD-aligned memory (mem),
+ * return the total size in bytes, only compute the size if mem is NULL.
+ */
+rt_size lzc_init(rt_SIMD_INFOX *info, rt_byte *mem)
+{
+    static const rt_char *word[] =
+    {
+        "the", "of", "and", "to", "in", "is", "that", "for", "with", "as",
+        "vector", "register", "memory", "target", "assembler", "instruction",
+        "SIMD", "lane", "mask", "element", "load", "store", "compare", "jump",
+        "a", "an", "on", "by", "this", "from", "which", "are",
+    };
+    static const rt_char *run[] =
+    {
+        "==========", "----", "abababababab", "        ", "xyzxyzxyzxyz",
+        "0000000000000000000000000000000000000000",
+    };
+
+    rt_si32 i, j, k, l, n = 0, m = 0;
+    rt_si32 head[1 << LZC_HASH];
+    rt_ui32 r = 12345;
+    rt_size used = 0;
+
+    rt_byte *corp = (rt_byte *)spm_take(mem, &used,
+                                LZC_SIZE + LZC_SLCK);
+    rt_pntr *pair = (rt_pntr *)spm_take(mem, &used,
+                                (LZC_SIZE + 1) * 4 * sizeof(rt_pntr));
+    rt_si32 *clen = (rt_si32 *)spm_take(mem, &used,
+                                (LZC_SIZE + 1) * sizeof(rt_si32));
+    rt_si32 *tokn = (rt_si32 *)spm_take(mem, &used,
+                                (LZC_SIZE + 1) * 4 * sizeof(rt_si32));
+    rt_byte *lits = (rt_byte *)spm_take(mem, &used,
+                                LZC_SIZE + LZC_SLCK);
+    rt_byte *sout = (rt_byte *)spm_take(mem, &used,
+                                LZC_SIZE + LZC_SLCK);
+    rt_byte *cout = (rt_byte *)spm_take(mem, &used,
+                                LZC_SIZE + LZC_SLCK);
+
+    if (mem == RT_NULL)
+    {
+        return used;
+    }
+
+    /* corpus: random words with punctuation, occasional runs and phrases */
+    for (i = 0; i < LZC_SIZE; )
+    {
+        const rt_char *w;
+        r = r * 1103515245 + 12345;
+        k = (rt_si32)(r >> 16);
+        if (k % 31 == 0 && i >= LZC_MAXM)
+        {
+            /* phrase: copy of earlier text, gives matches of any length */
+            r = r * 1103515245 + 12345;
+            l = (rt_si32)(r >> 16) % LZC_MAXM;
+            r = r * 1103515245 + 12345;
+            j = (rt_si32)(r >> 16) % (i - l + 1);
+            for (l += j; j < l && i < LZC_SIZE; j++)
+            {
+                corp[i++] = corp[j];
+            }
+            continue;
+        }
+        w = k % 29 == 0 ? run[(k >> 5) % 6] : word[(k >> 5) % 32];
+        for (j = 0; w[j] != '\0' && i < LZC_SIZE; j++)
+        {
+            corp[i++] = (rt_byte)w[j];
+        }
+        if (i < LZC_SIZE)
+        {
+            corp[i++] = (rt_byte)(k % 13 == 0 ? '.' : k % 7 == 0 ? '\n' : ' ');
+        }
+    }
+
+    /* pairs: every position with a candidate of the same hash */
+    for (j = 0; j < (1 << LZC_HASH); j++)
+    {
+        head[j] = -1;
+    }
+    for (i = 0; i <= LZC_SIZE - LZC_MINM; i++)
+    {
+        k = lzc_hash(corp + i);
+        if (head[k] >= 0)
+        {
+            pair[4*n+0] = corp + i;
+            pair[4*n+1] = corp + head[k];
+            pair[4*n+2] = corp + i + RT_MIN(LZC_MAXM, LZC_SIZE - i);
+            n++;
+        }
+        head[k] = i;
+    }
+
+    /* tokens: greedy parse with the same hash table */
+    for (j = 0; j < (1 << LZC_HASH); j++)
+    {
+        head[j] = -1;
+    }
+    for (i = 0, j = 0, l = 0; i < LZC_SIZE; )
+    {
+        rt_si32 len = 0;
+        if (i <= LZC_SIZE - LZC_MINM)
+        {
+            k = lzc_hash(corp + i);
+            if (head[k] >= 0)
+            {
+                len = lzc_mlen(corp + i, corp + head[k],
+                               RT_MIN(LZC_MAXM, LZC_SIZE - i));
+            }
+            if (len >= LZC_MINM)
+            {
+                tokn[4*m+0] = i - l;
+                tokn[4*m+1] = len;
+                tokn[4*m+2] = i - head[k];
+                m++;
+                l = i + len;
+                for (; i < l && i <= LZC_SIZE - LZC_MINM; i++)
+                {
+                    head[lzc_hash(corp + i)] = i;
+                }
+                i = l;
+                continue;
+            }
+            head[k] = i;
+        }
+        lits[j++] = corp[i++];
+    }
+    tokn[4*m+0] = i - l;
+
+    info->gtab[9]  = corp;
+    info->gtab[10] = pair;
+    info->gtab[11] = tokn;
+    info->gtab[12] = lits;
+    info->gtab[13] = sout;
+
+    info->glzl = clen;
+    info->glzo = cout;
+
+    return used;
+}
+
+rt_void c_test66(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_pntr *pair = (rt_pntr *)info->gtab[10];
+    rt_si32 *clen = info->glzl;
+
+    for (j = 0; pair[4*j+2] != RT_NULL; j++)
+    {
+        clen[j] = lzc_mlen((rt_byte *)pair[4*j+0], (rt_byte *)pair[4*j+1],
+                   (rt_si32)((rt_byte *)pair[4*j+2] - (rt_byte *)pair[4*j+0]));
+    }
+}
+
+rt_void s_test66(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x028*P+E))
+
+    LBL(106601) /* pair_beg */
+
+        cmjxx_mz(Mebx, DP(0x008*P+E),
+        /* if */ EQ_x, 106605f) /* pair_end */
+        movxx_ld(Resi, Mebx, DP(0x000*P+E))
+        movxx_ld(Redi, Mebx, DP(0x004*P+E))
+
+    LBL(106602) /* vect_beg */
+
+        mvumx_ld(Xmm0, Mesi, DP(0x000))
+        mvumx_ld(Xmm1, Medi, DP(0x000))
+        ceqmb_rr(Xmm1, Xmm0)
+        mlnmb_rr(Reax, Xmm1)
+        addxx_rr(Resi, Reax)
+        addxx_rr(Redi, Reax)
+        cmjxx_rm(Resi, Mebx, DP(0x008*P+E),
+        /* if */ GE_x, 106603f) /* clmp_beg */
+        cmjwx_ri(Reax, IM(Q*0x010),
+        /* if */ EQ_x, 106602b) /* vect_beg */
+        jmpxx_lb(106604f) /* clmp_end */
+
+    LBL(106603) /* clmp_beg */
+
+        movxx_ld(Resi, Mebx, DP(0x008*P+E))
+
+    LBL(106604) /* clmp_end */
+
+        subxx_ld(Resi, Mebx, DP(0x000*P+E))
+        movwx_st(Resi, Mebx, DP(0x00C*P+D))
+        addxx_ri(Rebx, IM(0x010*P))
+        jmpxx_lb(106601b) /* pair_beg */
+
+    LBL(106605) /* pair_end */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test66(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_byte *corp = (rt_byte *)info->gtab[9];
+    rt_pntr *pair = (rt_pntr *)info->gtab[10];
+    rt_si32 *clen = info->glzl;
+
+    for (j = 0; pair[4*j+2] != RT_NULL; j++)
+    {
+        rt_si32 slen = (rt_si32)(rt_word)pair[4*j+3];
+
+        if (IEQ(clen[j], slen) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("pair[%d]: pos = %d, cand = %d, lim = %d\n",
+                j, (rt_si32)((rt_byte *)pair[4*j+0] - corp),
+                (rt_si32)((rt_byte *)pair[4*j+1] - corp),
+                (rt_si32)((rt_byte *)pair[4*j+2] - (rt_byte *)pair[4*j+0]));
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (pair[%d] match) = %d\n",
+                j, clen[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (pair[%d] match) = %d\n",
+                j, slen);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 66 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 67   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 67
+
+rt_void c_test67(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k;
+
+    rt_si32 *tokn = (rt_si32 *)info->gtab[11];
+    rt_byte *lits = (rt_byte *)info->gtab[12];
+    rt_byte *cout = info->glzo;
+
+    for (j = 0; ; j += 4)
+    {
+        for (k = 0; k < tokn[j+0]; k++)
+        {
+            *cout++ = *lits++;
+        }
+        if (tokn[j+1] == 0)
+        {
+            break;
+        }
+        for (k = 0; k < tokn[j+1]; k++, cout++)
+        {
+            *cout = *(cout - tokn[j+2]);
+        }
+    }
+}
+
+rt_void s_test67(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x02C*P+E))
+        movxx_ld(Resi, Mecx, DP(0x030*P+E))
+        movxx_ld(Redi, Mecx, DP(0x034*P+E))
+
+    LBL(106701) /* tokn_beg */
+
+        movwx_ld(Redx, Mebx, DP(0x000))
+        cmjwx_rz(Redx,
+        /* if */ EQ_x, 106703f) /* lits_end */
+        addxx_rr(Redx, Redi)
+
+    LBL(106702) /* lits_cpy */
+
+        mvumx_ld(Xmm0, Mesi, DP(0x000))
+        mvumx_st(Xmm0, Medi, DP(0x000))
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        cmjxx_rr(Redi, Redx,
+        /* if */ LT_x, 106702b) /* lits_cpy */
+        subxx_rr(Redi, Redx)
+        subxx_rr(Resi, Redi)
+        movxx_rr(Redi, Redx)
+
+    LBL(106703) /* lits_end */
+
+        movwx_ld(Redx, Mebx, DP(0x004))
+        cmjwx_rz(Redx,
+        /* if */ EQ_x, 106707f) /* tokn_end */
+        addxx_rr(Redx, Redi)
+        movwx_ld(Reax, Mebx, DP(0x008))
+        movxx_rr(Recx, Redi)
+        subxx_rr(Recx, Reax)
+
+    LBL(106704) /* dist_dbl */
+
+        movxx_rr(Reax, Redi)
+        subxx_rr(Reax, Recx)
+        cmjxx_ri(Reax, IM(Q*0x010),
+        /* if */ GE_x, 106705f) /* mtch_cpy */
+        mvumx_ld(Xmm0, Mecx, DP(0x000))
+        mvumx_st(Xmm0, Medi, DP(0x000))
+        addxx_rr(Redi, Redi)
+        subxx_rr(Redi, Recx)
+        cmjxx_rr(Redi, Redx,
+        /* if */ LT_x, 106704b) /* dist_dbl */
+        jmpxx_lb(106706f) /* mtch_end */
+
+    LBL(106705) /* mtch_cpy */
+
+        mvumx_ld(Xmm0, Mecx, DP(0x000))
+        mvumx_st(Xmm0, Medi, DP(0x000))
+        addxx_ri(Recx, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        cmjxx_rr(Redi, Redx,
+        /* if */ LT_x, 106705b) /* mtch_cpy */
+
+    LBL(106706) /* mtch_end */
+
+        movxx_rr(Redi, Redx)
+        addxx_ri(Rebx, IB(16))
+        jmpxx_lb(106701b) /* tokn_beg */
+
+    LBL(106707) /* tokn_end */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test67(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_byte *corp = (rt_byte *)info->gtab[9];
+    rt_byte *sout = (rt_byte *)info->gtab[13];
+    rt_byte *cout = info->glzo;
+
+    j = LZC_SIZE;
+    while (j-->0)
+    {
+        if (IEQ(corp[j], cout[j]) && IEQ(corp[j], sout[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("corp[%d] = %02X\n",
+                j, corp[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (corp[%d] decoded) = %02X\n",
+                j, cout[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (corp[%d] decoded) = %02X\n",
+                j, sout[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 67 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 68   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 68
+
+/*
+ * Base64 and hex coding sub-tests 68-71 (rtcode.h).
+ * Random raw bytes are encoded to base64 (68) and hex (70), text inputs
+ * for decoding (69, 71) are valid encodings of the same bytes with a few
+ * characters replaced by invalid ones in every 4th chunk (SIMD vector).
+ * C++ sections use scalar lookup tables, ASM sections translate characters
+ * with range compares on bytes (rtcode.h), regrouping bytes in BASE.
+ * Decoding also accumulates the mask of valid characters (0xFF valid, 0 not)
+ * for every byte position within a chunk over all chunks.
+ * Encoding gathers raw bytes into lanes of the whole output first, then
+ * translates it in place, as loading a vector right after its 32-bit stores
+ * stalls on store-to-load forwarding (rthash.h).
+ * Data (gtab[14..22]): constants table, raw bytes, base64 text, hex text,
+ * base64 output, base64 decoded, hex output, hex decoded, masks (2 vectors),
+ * C++ only (gcod[0..5]): lookup tables and outputs as above.
+ */
+#define COD_CHNK            64 /* chunks (SIMD vectors of text) */
+#define COD_SLCK            4  /* slack past the end of buffers */
+
+/*
+ * Build base64/hex tables and inputs within SIMD-aligned memory (mem),
+ * return the total size in bytes, only compute the size if mem is NULL.
+ */
+rt_size cod_init(rt_SIMD_INFOX *info, rt_byte *mem)
+{
+    static const rt_char *b64c =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static const rt_char *hexc = "0123456789abcdef";
+    static const rt_char *hexu = "0123456789ABCDEF";
+    static const rt_byte badb[] = /* around valid ranges */
+    {
+        '=', '*', '@', '[', '`', '{', ':', '.', ',', ' ', 0x80, 0xFF,
+    };
+    static const rt_byte badh[] = /* around valid ranges */
+    {
+        'g', 'G', '@', '/', ':', '`', '.', 'x', ' ', 0x80, 0xFF, 0x00,
+    };
+
+    const rt_char *w;
+    rt_si32 i, j;
+    rt_ui32 r = 54321;
+    rt_size used = 0;
+
+    rt_byte *ctab = (rt_byte *)spm_take(mem, &used, RT_CODE_FLD * J);
+    rt_byte *raw  = (rt_byte *)spm_take(mem, &used,
+                                COD_CHNK * R * 3 + COD_SLCK);
+    rt_byte *btxt = (rt_byte *)spm_take(mem, &used, COD_CHNK * J);
+    rt_byte *htxt = (rt_byte *)spm_take(mem, &used, COD_CHNK * J);
+    rt_byte *sb64 = (rt_byte *)spm_take(mem, &used, COD_CHNK * J);
+    rt_byte *sbin = (rt_byte *)spm_take(mem, &used,
+                                COD_CHNK * R * 3 + COD_SLCK);
+    rt_byte *shex = (rt_byte *)spm_take(mem, &used, COD_CHNK * J);
+    rt_byte *shxb = (rt_byte *)spm_take(mem, &used, COD_CHNK * R * 2);
+    rt_byte *smsk = (rt_byte *)spm_take(mem, &used, 2 * J);
+    rt_byte *ctbl = (rt_byte *)spm_take(mem, &used, 64 + 256 + 16 + 256);
+    rt_byte *cb64 = (rt_byte *)spm_take(mem, &used, COD_CHNK * J);
+    rt_byte *cbin = (rt_byte *)spm_take(mem, &used, COD_CHNK * R * 3);
+    rt_byte *chex = (rt_byte *)spm_take(mem, &used, COD_CHNK * J);
+    rt_byte *chxb = (rt_byte *)spm_take(mem, &used, COD_CHNK * R * 2);
+    rt_byte *cmsk = (rt_byte *)spm_take(mem, &used, 2 * J);
+
+    if (mem == RT_NULL)
+    {
+        return used;
+    }
+
+    RT_CODE_SET(ctab);
+
+    /* scalar tables, invalid characters decode to 0x80 | own low bits */
+    for (j = 0; j < 256; j++)
+    {
+        ctbl[64 + j] = (rt_byte)(0x80 | (j & 0x3F));
+        ctbl[336 + j] = (rt_byte)(0x80 | (j & 0x0F));
+    }
+    for (j = 0; j < 64; j++)
+    {
+        ctbl[j] = (rt_byte)b64c[j];
+        ctbl[64 + (rt_byte)b64c[j]] = (rt_byte)j;
+    }
+    for (j = 0; j < 16; j++)
+    {
+        ctbl[320 + j] = (rt_byte)hexc[j];
+        ctbl[336 + (rt_byte)hexc[j]] = (rt_byte)j;
+        ctbl[336 + (rt_byte)hexu[j]] = (rt_byte)j;
+    }
+
+    /* raw bytes and their valid encodings */
+    for (i = 0; i < COD_CHNK * R * 3; i++)
+    {
+        r = r * 1103515245 + 12345;
+        raw[i] = (rt_byte)(r >> 16);
+    }
+    for (i = 0; i < COD_CHNK * R; i++)
+    {
+        rt_ui32 n = raw[3*i+0] << 16 | raw[3*i+1] << 8 | raw[3*i+2];
+        btxt[4*i+0] = ctbl[(n >> 18) & 0x3F];
+        btxt[4*i+1] = ctbl[(n >> 12) & 0x3F];
+        btxt[4*i+2] = ctbl[(n >>  6) & 0x3F];
+        btxt[4*i+3] = ctbl[(n >>  0) & 0x3F];
+    }
+    for (i = 0; i < COD_CHNK * R * 2; i++)
+    {
+        r = r * 1103515245 + 12345;
+        w = (r >> 16) & 1 ? hexu : hexc; /* mixed case input */
+        htxt[2*i+0] = (rt_byte)w[raw[i] >> 4];
+        htxt[2*i+1] = (rt_byte)w[raw[i] & 0x0F];
+    }
+
+    /* invalid characters in every 4th chunk */
+    for (i = 3; i < COD_CHNK; i += 4)
+    {
+        j = i / 4;
+        btxt[i * J + (i * 13) % J] = badb[j % RT_ARR_SIZE(badb)];
+        htxt[i * J + (i * 11) % J] = badh[j % RT_ARR_SIZE(badh)];
+    }
+
+    info->gtab[14] = ctab;
+    info->gtab[15] = raw;
+    info->gtab[16] = btxt;
+    info->gtab[17] = htxt;
+    info->gtab[18] = sb64;
+    info->gtab[19] = sbin;
+    info->gtab[20] = shex;
+    info->gtab[21] = shxb;
+    info->gtab[22] = smsk;
+
+    info->gcod[0] = ctbl;
+    info->gcod[1] = cb64;
+    info->gcod[2] = cbin;
+    info->gcod[3] = chex;
+    info->gcod[4] = chxb;
+    info->gcod[5] = cmsk;
+
+    return used;
+}
+
+rt_void c_test68(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    rt_byte *raw  = (rt_byte *)info->gtab[15];
+    rt_byte *ctbl = info->gcod[0];
+    rt_byte *cb64 = info->gcod[1];
+
+    for (i = 0; i < COD_CHNK * R; i++, raw += 3, cb64 += 4)
+    {
+        rt_ui32 n = raw[0] << 16 | raw[1] << 8 | raw[2];
+        cb64[0] = ctbl[(n >> 18) & 0x3F];
+        cb64[1] = ctbl[(n >> 12) & 0x3F];
+        cb64[2] = ctbl[(n >>  6) & 0x3F];
+        cb64[3] = ctbl[(n >>  0) & 0x3F];
+    }
+}
+
+rt_void s_test68(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Resi, Mecx, DP(0x03C*P+E))
+        movxx_ld(Redi, Mecx, DP(0x048*P+E))
+        movxx_rr(Rebx, Redi)
+        movxx_ri(Recx, IV(COD_CHNK*Q*0x010))
+        addxx_rr(Recx, Redi)
+
+    LBL(106801) /* lane_gat */
+
+        mvuwx_ld(Reax, Redx, Mesi)
+        movwx_st(Reax, Medi, DP(0x000))
+        addxx_ri(Resi, IB(3))
+        addxx_ri(Redi, IB(4))
+        cmjxx_rr(Redi, Recx,
+        /* if */ LT_x, 106801b) /* lane_gat */
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Recx, Mecx, DP(0x038*P+E))
+        movxx_ri(Reax, IM(COD_CHNK))
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(106802) /* chnk_beg */
+
+        movox_ld(Xmm0, Mebx, DP(0x000))
+        e64ox_rr(Xmm0, Xmm1, Xmm2, Mecx)
+        movox_st(Xmm0, Mebx, DP(0x000))
+        movmx_ld(Xmm0, Mebx, DP(0x000))
+        a64mb_rr(Xmm0, Xmm1, Xmm2, Mecx)
+        movmx_st(Xmm0, Mebx, DP(0x000))
+        addxx_ri(Rebx, IM(Q*0x010))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 106802b) /* chnk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test68(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_byte *sb64 = (rt_byte *)info->gtab[18];
+    rt_byte *cb64 = info->gcod[1];
+
+    j = COD_CHNK * J;
+    while (j-->0)
+    {
+        if (IEQ(cb64[j], sb64[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (b64[%d] encoded) = %02X\n",
+                j, cb64[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (b64[%d] encoded) = %02X\n",
+                j, sb64[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 68 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 69   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 69
+
+rt_void c_test69(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j;
+
+    rt_byte *btxt = (rt_byte *)info->gtab[16];
+    rt_byte *ctbl = info->gcod[0];
+    rt_byte *cbin = info->gcod[2];
+    rt_byte *cmsk = info->gcod[5];
+
+    for (j = 0; j < J; j++)
+    {
+        cmsk[j] = 0xFF;
+    }
+    for (i = 0; i < COD_CHNK * R; i++, btxt += 4, cbin += 3)
+    {
+        rt_ui32 n = 0;
+        for (j = 0; j < 4; j++)
+        {
+            rt_byte v = ctbl[64 + btxt[j]];
+            if (v & 0x80)
+            {
+                cmsk[(4 * i + j) % J] = 0x00;
+            }
+            n = n << 6 | (v & 0x3F);
+        }
+        cbin[0] = (rt_byte)(n >> 16);
+        cbin[1] = (rt_byte)(n >>  8);
+        cbin[2] = (rt_byte)(n >>  0);
+    }
+}
+
+rt_void s_test69(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Resi, Mecx, DP(0x040*P+E))
+        movxx_ld(Redi, Mecx, DP(0x04C*P+E))
+        movxx_ld(Recx, Mecx, DP(0x038*P+E))
+        ceqmb_rr(Xmm4, Xmm4)
+        movxx_ri(Reax, IM(COD_CHNK))
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(106901) /* chnk_beg */
+
+        movmx_ld(Xmm0, Mesi, DP(0x000))
+        v64mb_rr(Xmm0, Xmm3, Xmm1, Xmm2, Mecx)
+        andmx_rr(Xmm4, Xmm3)
+        movmx_st(Xmm0, Mecx, DP(0x000))
+        movox_ld(Xmm0, Mecx, DP(0x000))
+        d64ox_rr(Xmm0, Xmm1, Xmm2, Mecx)
+        movox_st(Xmm0, Mecx, DP(0x000))
+        movxx_rr(Rebx, Recx)
+        movxx_rr(Redx, Recx)
+        addxx_ri(Redx, IM(Q*0x010))
+
+    LBL(106902) /* lane_put */
+
+        movwx_ld(Reax, Mebx, DP(0x000))
+        mvuwx_st(Reax, Medi)
+        addxx_ri(Rebx, IB(4))
+        addxx_ri(Redi, IB(3))
+        cmjxx_rr(Rebx, Redx,
+        /* if */ LT_x, 106902b) /* lane_put */
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 106901b) /* chnk_beg */
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Recx, Mecx, DP(0x058*P+E))
+        movmx_st(Xmm4, Mecx, DP(0x000))
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test69(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_byte *sbin = (rt_byte *)info->gtab[19];
+    rt_byte *smsk = (rt_byte *)info->gtab[22];
+    rt_byte *cbin = info->gcod[2];
+    rt_byte *cmsk = info->gcod[5];
+
+    j = COD_CHNK * R * 3;
+    while (j-->0)
+    {
+        if (IEQ(cbin[j], sbin[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (b64[%d] decoded) = %02X\n",
+                j, cbin[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (b64[%d] decoded) = %02X\n",
+                j, sbin[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    j = J;
+    while (j-->0)
+    {
+        if (IEQ(cmsk[j], smsk[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (b64 valid[%d]) = %02X\n",
+                j, cmsk[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (b64 valid[%d]) = %02X\n",
+                j, smsk[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 69 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 70   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 70
+
+rt_void c_test70(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    rt_byte *raw  = (rt_byte *)info->gtab[15];
+    rt_byte *ctbl = info->gcod[0];
+    rt_byte *chex = info->gcod[3];
+
+    for (i = 0; i < COD_CHNK * R * 2; i++, raw += 1, chex += 2)
+    {
+        chex[0] = ctbl[320 + (raw[0] >> 4)];
+        chex[1] = ctbl[320 + (raw[0] & 0x0F)];
+    }
+}
+
+rt_void s_test70(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Resi, Mecx, DP(0x03C*P+E))
+        movxx_ld(Redi, Mecx, DP(0x050*P+E))
+        movxx_rr(Rebx, Redi)
+        movxx_ri(Recx, IV(COD_CHNK*Q*0x010))
+        addxx_rr(Recx, Redi)
+
+    LBL(107001) /* lane_gat */
+
+        movhx_ld(Reax, Mesi, DP(0x000))
+        movwx_st(Reax, Medi, DP(0x000))
+        addxx_ri(Resi, IB(2))
+        addxx_ri(Redi, IB(4))
+        cmjxx_rr(Redi, Recx,
+        /* if */ LT_x, 107001b) /* lane_gat */
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Recx, Mecx, DP(0x038*P+E))
+        movxx_ri(Reax, IM(COD_CHNK))
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(107002) /* chnk_beg */
+
+        movox_ld(Xmm0, Mebx, DP(0x000))
+        ehxox_rr(Xmm0, Xmm1, Xmm2, Mecx)
+        movox_st(Xmm0, Mebx, DP(0x000))
+        movmx_ld(Xmm0, Mebx, DP(0x000))
+        ahxmb_rr(Xmm0, Xmm1, Mecx)
+        movmx_st(Xmm0, Mebx, DP(0x000))
+        addxx_ri(Rebx, IM(Q*0x010))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 107002b) /* chnk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test70(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_byte *shex = (rt_byte *)info->gtab[20];
+    rt_byte *chex = info->gcod[3];
+
+    j = COD_CHNK * J;
+    while (j-->0)
+    {
+        if (IEQ(chex[j], shex[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (hex[%d] encoded) = %02X\n",
+                j, chex[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (hex[%d] encoded) = %02X\n",
+                j, shex[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 70 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 71   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 71
+
+rt_void c_test71(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j;
+
+    rt_byte *htxt = (rt_byte *)info->gtab[17];
+    rt_byte *ctbl = info->gcod[0];
+    rt_byte *chxb = info->gcod[4];
+    rt_byte *cmsk = info->gcod[5] + J;
+
+    for (j = 0; j < J; j++)
+    {
+        cmsk[j] = 0xFF;
+    }
+    for (i = 0; i < COD_CHNK * R * 2; i++, htxt += 2, chxb += 1)
+    {
+        rt_byte h = ctbl[336 + htxt[0]];
+        rt_byte l = ctbl[336 + htxt[1]];
+        if (h & 0x80)
+        {
+            cmsk[(2 * i + 0) % J] = 0x00;
+        }
+        if (l & 0x80)
+        {
+            cmsk[(2 * i + 1) % J] = 0x00;
+        }
+        chxb[0] = (rt_byte)((h & 0x0F) << 4 | (l & 0x0F));
+    }
+}
+
+rt_void s_test71(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Resi, Mecx, DP(0x044*P+E))
+        movxx_ld(Redi, Mecx, DP(0x054*P+E))
+        movxx_ld(Recx, Mecx, DP(0x038*P+E))
+        ceqmb_rr(Xmm4, Xmm4)
+        movxx_ri(Reax, IM(COD_CHNK))
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(107101) /* chnk_beg */
+
+        movmx_ld(Xmm0, Mesi, DP(0x000))
+        vhxmb_rr(Xmm0, Xmm3, Xmm1, Xmm2, Mecx)
+        andmx_rr(Xmm4, Xmm3)
+        movmx_st(Xmm0, Mecx, DP(0x000))
+        movox_ld(Xmm0, Mecx, DP(0x000))
+        dhxox_rr(Xmm0, Xmm1, Xmm2, Mecx)
+        movox_st(Xmm0, Mecx, DP(0x000))
+        movxx_rr(Rebx, Recx)
+        movxx_rr(Redx, Recx)
+        addxx_ri(Redx, IM(Q*0x010))
+
+    LBL(107102) /* lane_put */
+
+        movwx_ld(Reax, Mebx, DP(0x000))
+        movhx_st(Reax, Medi, DP(0x000))
+        addxx_ri(Rebx, IB(4))
+        addxx_ri(Redi, IB(2))
+        cmjxx_rr(Rebx, Redx,
+        /* if */ LT_x, 107102b) /* lane_put */
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 107101b) /* chnk_beg */
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Recx, Mecx, DP(0x058*P+E))
+        movmx_st(Xmm4, Mecx, DP(Q*0x010))
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test71(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_byte *shxb = (rt_byte *)info->gtab[21];
+    rt_byte *smsk = (rt_byte *)info->gtab[22] + J;
+    rt_byte *chxb = info->gcod[4];
+    rt_byte *cmsk = info->gcod[5] + J;
+
+    j = COD_CHNK * R * 2;
+    while (j-->0)
+    {
+        if (IEQ(chxb[j], shxb[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (hex[%d] decoded) = %02X\n",
+                j, chxb[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (hex[%d] decoded) = %02X\n",
+                j, shxb[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    j = J;
+    while (j-->0)
+    {
+        if (IEQ(cmsk[j], smsk[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (hex valid[%d]) = %02X\n",
+                j, cmsk[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (hex valid[%d]) = %02X\n",
+                j, smsk[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 71 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 72   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 72
+
+/*
+ * Batched 4x4 matrix product M*M (GEMM kernel) over SoA matrix blocks
+ * with whole rows moved by burst ld/st (movpx2ld/movpx4ld, movpx2st/movpx4st),
+ * the result is written back to the block's last (scratch) slot.
+ */
+rt_void c_test72(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, r, c, n = info->size;
+
+    rt_real *gmat = info->gaos[0];
+
+    for (j = 0; j < n; j++)
+    {
+        rt_real *g = gmat + j * GEO_MLEN;
+        rt_real *m = g + 18;
+
+        for (r = 0; r < 4; r++)
+        {
+            for (c = 0; c < 4; c++)
+            {
+                g[49 + r*4 + c] = m[r*4+0] * m[0+c] + m[r*4+1] * m[4+c]
+                                + m[r*4+2] * m[8+c] + m[r*4+3] * m[12+c];
+            }
+        }
+    }
+}
+
+rt_void s_test72(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_GTAB)
+        movxx_ld(Rebx, Mecx, DP(0x000*P+E))
+        movwx_ri(Reax, IB(3)) /* ARR_SIZE / S */
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(107201) /* blk_beg */
+
+        adrxx_ld(Resi, Mebx, GS(2))
+        adrxx_ld(Redi, Mebx, GS(GEO_MSLT-1))
+        movxx_rr(Redx, Resi)
+        movxx_ri(Reax, IB(2))
+
+    LBL(107202) /* row_beg */
+
+        /* even row: 4-register bursts */
+        movpx4ld(Xmm0, Xmm1, Xmm2, Xmm3, Mesi, GF(0))
+        mulps_ld(Xmm0, Medx, GF(0))
+        mulps_ld(Xmm1, Medx, GF(0))
+        mulps_ld(Xmm2, Medx, GF(0))
+        mulps_ld(Xmm3, Medx, GF(0))
+        movpx4ld(Xmm4, Xmm5, Xmm6, Xmm7, Mesi, GF(4))
+        mulps_ld(Xmm4, Medx, GF(1))
+        mulps_ld(Xmm5, Medx, GF(1))
+        mulps_ld(Xmm6, Medx, GF(1))
+        mulps_ld(Xmm7, Medx, GF(1))
+        addps_rr(Xmm0, Xmm4)
+        addps_rr(Xmm1, Xmm5)
+        addps_rr(Xmm2, Xmm6)
+        addps_rr(Xmm3, Xmm7)
+        movpx4ld(Xmm4, Xmm5, Xmm6, Xmm7, Mesi, GF(8))
+        mulps_ld(Xmm4, Medx, GF(2))
+        mulps_ld(Xmm5, Medx, GF(2))
+        mulps_ld(Xmm6, Medx, GF(2))
+        mulps_ld(Xmm7, Medx, GF(2))
+        addps_rr(Xmm0, Xmm4)
+        addps_rr(Xmm1, Xmm5)
+        addps_rr(Xmm2, Xmm6)
+        addps_rr(Xmm3, Xmm7)
+        movpx4ld(Xmm4, Xmm5, Xmm6, Xmm7, Mesi, GF(12))
+        mulps_ld(Xmm4, Medx, GF(3))
+        mulps_ld(Xmm5, Medx, GF(3))
+        mulps_ld(Xmm6, Medx, GF(3))
+        mulps_ld(Xmm7, Medx, GF(3))
+        addps_rr(Xmm0, Xmm4)
+        addps_rr(Xmm1, Xmm5)
+        addps_rr(Xmm2, Xmm6)
+        addps_rr(Xmm3, Xmm7)
+        movpx4st(Xmm0, Xmm1, Xmm2, Xmm3, Medi, GF(0))
+
+        /* odd row: 2-register bursts, pairs in any order */
+        movpx2ld(Xmm1, Xmm0, Mesi, GF(0))
+        movpx2ld(Xmm3, Xmm2, Mesi, GF(2))
+        mulps_ld(Xmm0, Medx, GF(4))
+        mulps_ld(Xmm1, Medx, GF(4))
+        mulps_ld(Xmm2, Medx, GF(4))
+        mulps_ld(Xmm3, Medx, GF(4))
+        movpx2ld(Xmm5, Xmm4, Mesi, GF(4))
+        movpx2ld(Xmm7, Xmm6, Mesi, GF(6))
+        mulps_ld(Xmm4, Medx, GF(5))
+        mulps_ld(Xmm5, Medx, GF(5))
+        mulps_ld(Xmm6, Medx, GF(5))
+        mulps_ld(Xmm7, Medx, GF(5))
+        addps_rr(Xmm0, Xmm4)
+        addps_rr(Xmm1, Xmm5)
+        addps_rr(Xmm2, Xmm6)
+        addps_rr(Xmm3, Xmm7)
+        movpx2ld(Xmm5, Xmm4, Mesi, GF(8))
+        movpx2ld(Xmm7, Xmm6, Mesi, GF(10))
+        mulps_ld(Xmm4, Medx, GF(6))
+        mulps_ld(Xmm5, Medx, GF(6))
+        mulps_ld(Xmm6, Medx, GF(6))
+        mulps_ld(Xmm7, Medx, GF(6))
+        addps_rr(Xmm0, Xmm4)
+        addps_rr(Xmm1, Xmm5)
+        addps_rr(Xmm2, Xmm6)
+        addps_rr(Xmm3, Xmm7)
+        movpx2ld(Xmm5, Xmm4, Mesi, GF(12))
+        movpx2ld(Xmm7, Xmm6, Mesi, GF(14))
+        mulps_ld(Xmm4, Medx, GF(7))
+        mulps_ld(Xmm5, Medx, GF(7))
+        mulps_ld(Xmm6, Medx, GF(7))
+        mulps_ld(Xmm7, Medx, GF(7))
+        addps_rr(Xmm0, Xmm4)
+        addps_rr(Xmm1, Xmm5)
+        addps_rr(Xmm2, Xmm6)
+        addps_rr(Xmm3, Xmm7)
+        movpx2st(Xmm1, Xmm0, Medi, GF(4))
+        movpx2st(Xmm3, Xmm2, Medi, GF(6))
+
+        addxx_ri(Redx, IM(Q*0x080))
+        addxx_ri(Redi, IM(Q*0x080))
+        subxx_ri(Reax, IB(1))
+        cmjxx_rz(Reax,
+        /* if */ NE_x, 107202b) /* row_beg */
+
+        addxx_ri(Rebx, IH(Q*0x100*GEO_MSLT))
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ NE_x, 107201b) /* blk_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test72(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *gmat = info->gaos[0];
+    rt_real *smat = (rt_real *)info->gtab[0];
+
+    j = n;
+    while (j-->0)
+    {
+        rt_real *g = gmat + j * GEO_MLEN;
+
+        for (k = 0; k < 16; k++)
+        {
+            rt_real fco = g[49 + k];
+            rt_real fso = *geo_fld(smat, GEO_MSLT, j, GEO_MSLT-1, k);
+
+            if (FEQ(fco, fso) && !v_mode)
+            {
+                continue;
+            }
+
+            RT_LOGI("M[%d][%d] = %e\n",
+                    j, k, g[18 + k]);
+#ifdef RT_PRINT_CPP
+            RT_LOGI("C (M*M)[%d][%d] = %e\n",
+                    j, k, fco);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+            RT_LOGI("S (M*M)[%d][%d] = %e\n",
+                    j, k, fso);
+#endif /* RT_PRINT_ASM */
+        }
+    }
+}
+
+#endif /* SUB_TEST 72 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 73   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 73
+
+rt_void c_test73(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[j] + far0[(j + S) % n];
+        fco2[j] = far0[j] - far0[(j + S) % n];
+    }
+}
+
+/*
+ * Same as subtest 1, but arrays are accessed through displacement windows:
+ * base registers are rebased once to the window's origin (AW0 or AW1) and
+ * fields are then addressed relative to that origin with DW(org, dp).
+ */
+#define AW0                 (Q*0x000 + Q*RT_OFFS_DATA)
+#define AW1                 (Q*0x010 + Q*RT_OFFS_DATA)
+#define AW2                 (Q*0x020 + Q*RT_OFFS_DATA)
+
+rt_void s_test73(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        adrxx_ld(Resi, Mecx, DS(AW1))
+        adrxx_ld(Recx, Mecx, DS(AW0))
+        adrxx_ld(Redx, Medx, DS(AW0))
+        adrxx_ld(Rebx, Mebx, DS(AW0))
+
+        movpx_ld(Xmm0, Mecx, DW(AW0, AW0))
+        movpx_ld(Xmm1, Mesi, DW(AW1, AW1))
+        movpx_rr(Xmm2, Xmm0)
+        addps_rr(Xmm2, Xmm1)
+        movpx_rr(Xmm3, Xmm0)
+        subps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm2, Medx, DW(AW0, AW0))
+        movpx_st(Xmm3, Mebx, DW(AW0, AW0))
+
+        movpx_ld(Xmm0, Mesi, DW(AW1, AW1))
+        movpx_rr(Xmm2, Xmm0)
+        addps_ld(Xmm2, Mesi, DW(AW1, AW2))
+        movpx_rr(Xmm3, Xmm0)
+        subps_ld(Xmm3, Mesi, DW(AW1, AW2))
+        movpx_st(Xmm2, Medx, DW(AW0, AW1))
+        movpx_st(Xmm3, Mebx, DW(AW0, AW1))
+
+        movpx_ld(Xmm0, Mecx, DW(AW0, AW2))
+        movpx_ld(Xmm1, Mecx, DW(AW0, AW0))
+        movpx_rr(Xmm2, Xmm0)
+        addps_rr(Xmm2, Xmm1)
+        movpx_rr(Xmm3, Xmm0)
+        subps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm2, Medx, DW(AW0, AW2))
+        movpx_st(Xmm3, Mebx, DW(AW0, AW2))
+
+    ASM_LEAVE(info)
+}
+
+#undef AW0
+#undef AW1
+#undef AW2
+
+rt_void p_test73(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[%d]+farr[%d] = %e, farr[%d]-farr[%d] = %e\n",
+                j, (j + S) % n, fco1[j], j, (j + S) % n, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[%d]+farr[%d] = %e, farr[%d]-farr[%d] = %e\n",
+                j, (j + S) % n, fso1[j], j, (j + S) % n, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 73 */
+
+/******************************************************************************/
+/*********************************   TABLES   *********************************/
+/******************************************************************************/
+
+typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+
+volatile
+testXX c_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    c_test01,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    c_test02,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    c_test03,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    c_test04,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    c_test05,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    c_test06,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    c_test07,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    c_test08,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    c_test09,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    c_test10,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    c_test11,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    c_test12,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    c_test13,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    c_test14,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    c_test15,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    c_test16,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    c_test17,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    c_test18,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    c_test19,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    c_test20,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    c_test21,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    c_test22,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    c_test23,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    c_test24,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    c_test25,
+#endif /* SUB_TEST 25 */
 
 #if SUB_TEST >= 26
     c_test26,
@@ -7873,6 +12066,94 @@ testXX c_test[SUB_TEST] =
 #if SUB_TEST >= 51
     c_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    c_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    c_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    c_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    c_test55,
+#endif /* SUB_TEST 55 */
+
+#if SUB_TEST >= 56
+    c_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    c_test57,
+#endif /* SUB_TEST 57 */
+
+#if SUB_TEST >= 58
+    c_test58,
+#endif /* SUB_TEST 58 */
+
+#if SUB_TEST >= 59
+    c_test59,
+#endif /* SUB_TEST 59 */
+
+#if SUB_TEST >= 60
+    c_test60,
+#endif /* SUB_TEST 60 */
+
+#if SUB_TEST >= 61
+    c_test61,
+#endif /* SUB_TEST 61 */
+
+#if SUB_TEST >= 62
+    c_test62,
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    c_test63,
+#endif /* SUB_TEST 63 */
+
+#if SUB_TEST >= 64
+    c_test64,
+#endif /* SUB_TEST 64 */
+
+#if SUB_TEST >= 65
+    c_test65,
+#endif /* SUB_TEST 65 */
+
+#if SUB_TEST >= 66
+    c_test66,
+#endif /* SUB_TEST 66 */
+
+#if SUB_TEST >= 67
+    c_test67,
+#endif /* SUB_TEST 67 */
+
+#if SUB_TEST >= 68
+    c_test68,
+#endif /* SUB_TEST 68 */
+
+#if SUB_TEST >= 69
+    c_test69,
+#endif /* SUB_TEST 69 */
+
+#if SUB_TEST >= 70
+    c_test70,
+#endif /* SUB_TEST 70 */
+
+#if SUB_TEST >= 71
+    c_test71,
+#endif /* SUB_TEST 71 */
+
+#if SUB_TEST >= 72
+    c_test72,
+#endif /* SUB_TEST 72 */
+
+#if SUB_TEST >= 73
+    c_test73,
+#endif /* SUB_TEST 73 */
 };
 
 volatile
@@ -8081,6 +12362,94 @@ testXX s_test[SUB_TEST] =
 #if SUB_TEST >= 51
     s_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    s_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    s_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    s_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    s_test55,
+#endif /* SUB_TEST 55 */
+
+#if SUB_TEST >= 56
+    s_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    s_test57,
+#endif /* SUB_TEST 57 */
+
+#if SUB_TEST >= 58
+    s_test58,
+#endif /* SUB_TEST 58 */
+
+#if SUB_TEST >= 59
+    s_test59,
+#endif /* SUB_TEST 59 */
+
+#if SUB_TEST >= 60
+    s_test60,
+#endif /* SUB_TEST 60 */
+
+#if SUB_TEST >= 61
+    s_test61,
+#endif /* SUB_TEST 61 */
+
+#if SUB_TEST >= 62
+    s_test62,
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    s_test63,
+#endif /* SUB_TEST 63 */
+
+#if SUB_TEST >= 64
+    s_test64,
+#endif /* SUB_TEST 64 */
+
+#if SUB_TEST >= 65
+    s_test65,
+#endif /* SUB_TEST 65 */
+
+#if SUB_TEST >= 66
+    s_test66,
+#endif /* SUB_TEST 66 */
+
+#if SUB_TEST >= 67
+    s_test67,
+#endif /* SUB_TEST 67 */
+
+#if SUB_TEST >= 68
+    s_test68,
+#endif /* SUB_TEST 68 */
+
+#if SUB_TEST >= 69
+    s_test69,
+#endif /* SUB_TEST 69 */
+
+#if SUB_TEST >= 70
+    s_test70,
+#endif /* SUB_TEST 70 */
+
+#if SUB_TEST >= 71
+    s_test71,
+#endif /* SUB_TEST 71 */
+
+#if SUB_TEST >= 72
+    s_test72,
+#endif /* SUB_TEST 72 */
+
+#if SUB_TEST >= 73
+    s_test73,
+#endif /* SUB_TEST 73 */
 };
 
 volatile
@@ -8289,6 +12658,94 @@ testXX p_test[SUB_TEST] =
 #if SUB_TEST >= 51
     p_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    p_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    p_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    p_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    p_test55,
+#endif /* SUB_TEST 55 */
+
+#if SUB_TEST >= 56
+    p_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    p_test57,
+#endif /* SUB_TEST 57 */
+
+#if SUB_TEST >= 58
+    p_test58,
+#endif /* SUB_TEST 58 */
+
+#if SUB_TEST >= 59
+    p_test59,
+#endif /* SUB_TEST 59 */
+
+#if SUB_TEST >= 60
+    p_test60,
+#endif /* SUB_TEST 60 */
+
+#if SUB_TEST >= 61
+    p_test61,
+#endif /* SUB_TEST 61 */
+
+#if SUB_TEST >= 62
+    p_test62,
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    p_test63,
+#endif /* SUB_TEST 63 */
+
+#if SUB_TEST >= 64
+    p_test64,
+#endif /* SUB_TEST 64 */
+
+#if SUB_TEST >= 65
+    p_test65,
+#endif /* SUB_TEST 65 */
+
+#if SUB_TEST >= 66
+    p_test66,
+#endif /* SUB_TEST 66 */
+
+#if SUB_TEST >= 67
+    p_test67,
+#endif /* SUB_TEST 67 */
+
+#if SUB_TEST >= 68
+    p_test68,
+#endif /* SUB_TEST 68 */
+
+#if SUB_TEST >= 69
+    p_test69,
+#endif /* SUB_TEST 69 */
+
+#if SUB_TEST >= 70
+    p_test70,
+#endif /* SUB_TEST 70 */
+
+#if SUB_TEST >= 71
+    p_test71,
+#endif /* SUB_TEST 71 */
+
+#if SUB_TEST >= 72
+    p_test72,
+#endif /* SUB_TEST 72 */
+
+#if SUB_TEST >= 73
+    p_test73,
+#endif /* SUB_TEST 73 */
 };
 
 /******************************************************************************/
@@ -8323,8 +12780,8 @@ rt_time get_time();
 /*
  * info - info original pointer
  * inf0 - info aligned pointer
- * marr - memory original pointer
- * mar0 - memory aligned pointer
+ * marr - memory SoA container (rtdata.h)
+ * moff - memory offset (RT_OFFS_DATA)
  *
  * farr - float original array
  * far0 - float aligned array 0
@@ -8441,14 +12898,16 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         }
     }
 
+    typedef rt_Soa<rt_real, rt_real, rt_real, rt_real, rt_real,
+                   rt_elem, rt_elem, rt_elem, rt_elem, rt_elem,
+                   rt_elem, rt_elem, rt_elem, rt_elem, rt_elem> rt_MARR;
+
 #if RT_OFFS_ALLOC
-    rt_pntr marr = sys_alloc(15*ARR_SIZE*sizeof(rt_elem)+Q*RT_OFFS_DATA + MASK);
-    memset(marr, 0, 15*ARR_SIZE*sizeof(rt_elem)+Q*RT_OFFS_DATA + MASK);
-    rt_pntr mar0 = (rt_pntr)(((rt_uptr)marr + MASK) & ~MASK);
+    rt_MARR marr(sys_alloc, sys_free, ARR_SIZE + S*RT_OFFS_SIMD);
+    rt_size moff = 0;
 #else /* RT_OFFS_ALLOC */
-    rt_pntr marr = sys_alloc(15*ARR_SIZE*sizeof(rt_elem) + MASK);
-    memset(marr, 0, 15*ARR_SIZE*sizeof(rt_elem) + MASK);
-    rt_pntr mar0 = (rt_pntr)(((rt_uptr)marr-Q*RT_OFFS_DATA + MASK) & ~MASK);
+    rt_MARR marr(sys_alloc, sys_free, ARR_SIZE);
+    rt_size moff = S*RT_OFFS_SIMD;
 #endif /* RT_OFFS_ALLOC */
 
 #if   RT_ELEMENT == 32
@@ -8479,11 +12938,11 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     };
 #endif /* RT_ELEMENT */
 
-    rt_real *far0 = (rt_real *)mar0 + ARR_SIZE*0x0;
-    rt_real *fco1 = (rt_real *)mar0 + ARR_SIZE*0x1;
-    rt_real *fco2 = (rt_real *)mar0 + ARR_SIZE*0x2;
-    rt_real *fso1 = (rt_real *)mar0 + ARR_SIZE*0x3;
-    rt_real *fso2 = (rt_real *)mar0 + ARR_SIZE*0x4;
+    rt_real *far0 = marr.field<0x0>() - moff;
+    rt_real *fco1 = marr.field<0x1>() - moff;
+    rt_real *fco2 = marr.field<0x2>() - moff;
+    rt_real *fso1 = marr.field<0x3>() - moff;
+    rt_real *fso2 = marr.field<0x4>() - moff;
 
     for (k = 0; k < Q; k++)
     {
@@ -8518,11 +12977,11 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     };
 #endif /* RT_ELEMENT */
 
-    rt_elem *iar0 = (rt_elem *)mar0 + ARR_SIZE*0x5;
-    rt_elem *ico1 = (rt_elem *)mar0 + ARR_SIZE*0x6;
-    rt_elem *ico2 = (rt_elem *)mar0 + ARR_SIZE*0x7;
-    rt_elem *iso1 = (rt_elem *)mar0 + ARR_SIZE*0x8;
-    rt_elem *iso2 = (rt_elem *)mar0 + ARR_SIZE*0x9;
+    rt_elem *iar0 = marr.field<0x5>() - moff;
+    rt_elem *ico1 = marr.field<0x6>() - moff;
+    rt_elem *ico2 = marr.field<0x7>() - moff;
+    rt_elem *iso1 = marr.field<0x8>() - moff;
+    rt_elem *iso2 = marr.field<0x9>() - moff;
 
     for (k = 0; k < Q; k++)
     {
@@ -8557,11 +13016,11 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         31,
     };
 
-    rt_elem *har0 = (rt_elem *)mar0 + ARR_SIZE*0xA;
-    rt_elem *hco1 = (rt_elem *)mar0 + ARR_SIZE*0xB;
-    rt_elem *hco2 = (rt_elem *)mar0 + ARR_SIZE*0xC;
-    rt_elem *hso1 = (rt_elem *)mar0 + ARR_SIZE*0xD;
-    rt_elem *hso2 = (rt_elem *)mar0 + ARR_SIZE*0xE;
+    rt_elem *har0 = marr.field<0xA>() - moff;
+    rt_elem *hco1 = marr.field<0xB>() - moff;
+    rt_elem *hco2 = marr.field<0xC>() - moff;
+    rt_elem *hso1 = marr.field<0xD>() - moff;
+    rt_elem *hso2 = marr.field<0xE>() - moff;
 
     for (k = 0; k < Q; k++)
     {
@@ -8599,6 +13058,41 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     inf0->size = ARR_SIZE;
     inf0->tail = (rt_pntr)0xABCDEF01;
 
+#if SUB_TEST >= 59
+    rt_size ssiz = spm_init(inf0, RT_NULL) + MASK;
+    rt_pntr sarr = sys_alloc(ssiz);
+    memset(sarr, 0, ssiz);
+    spm_init(inf0, (rt_byte *)(((rt_full)sarr + MASK) & ~MASK));
+#endif /* SUB_TEST 59 */
+
+#if SUB_TEST >= 61
+    rt_size gsiz = geo_init(inf0, RT_NULL) + MASK;
+    rt_pntr garr = sys_alloc(gsiz);
+    memset(garr, 0, gsiz);
+    geo_init(inf0, (rt_byte *)(((rt_full)garr + MASK) & ~MASK));
+#endif /* SUB_TEST 61 */
+
+#if SUB_TEST >= 64
+    rt_size bsiz = blm_init(inf0, RT_NULL) + MASK;
+    rt_pntr barr = sys_alloc(bsiz);
+    memset(barr, 0, bsiz);
+    blm_init(inf0, (rt_byte *)(((rt_full)barr + MASK) & ~MASK));
+#endif /* SUB_TEST 64 */
+
+#if SUB_TEST >= 66
+    rt_size lsiz = lzc_init(inf0, RT_NULL) + MASK;
+    rt_pntr larr = sys_alloc(lsiz);
+    memset(larr, 0, lsiz);
+    lzc_init(inf0, (rt_byte *)(((rt_full)larr + MASK) & ~MASK));
+#endif /* SUB_TEST 66 */
+
+#if SUB_TEST >= 68
+    rt_size dsiz = cod_init(inf0, RT_NULL) + MASK;
+    rt_pntr darr = sys_alloc(dsiz);
+    memset(darr, 0, dsiz);
+    cod_init(inf0, (rt_byte *)(((rt_full)darr + MASK) & ~MASK));
+#endif /* SUB_TEST 68 */
+
     rt_si32 simd = 0;
 
     v_simd(inf0);
@@ -8701,7 +13195,21 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
     sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
     sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
-    sys_free(marr, 10 * ARR_SIZE * sizeof(rt_ui32) + MASK);
+#if SUB_TEST >= 59
+    sys_free(sarr, ssiz);
+#endif /* SUB_TEST 59 */
+#if SUB_TEST >= 61
+    sys_free(garr, gsiz);
+#endif /* SUB_TEST 61 */
+#if SUB_TEST >= 64
+    sys_free(barr, bsiz);
+#endif /* SUB_TEST 64 */
+#if SUB_TEST >= 66
+    sys_free(larr, lsiz);
+#endif /* SUB_TEST 66 */
+#if SUB_TEST >= 68
+    sys_free(darr, dsiz);
+#endif /* SUB_TEST 68 */
 
 #if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
 
@@ -8722,10 +13230,21 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
 #if RT_POINTER == 64
 #if RT_ADDRESS == 32
+#if (defined RT_X64) && (RT_BASE_COMPAT_HEAP != 0)
+
+/* 4GB-aligned heap anywhere in 64-bit space, GS base points to its start */
+#define RT_HEAP_SIZE        ULL(0x0000000100000000)
+#define RT_ADDRESS_MIN      (s_heap + 0x0000000000001000)
+#define RT_ADDRESS_MAX      (s_heap + RT_HEAP_SIZE)
+
+rt_byte *s_heap = RT_NULL;
+
+#else /* RT_BASE_COMPAT_HEAP == 0 */
 
 #define RT_ADDRESS_MIN      ((rt_byte *)0x0000000040000000)
 #define RT_ADDRESS_MAX      ((rt_byte *)0x0000000080000000)
 
+#endif /* RT_BASE_COMPAT_HEAP */
 #else /* RT_ADDRESS == 64 */
 
 #define RT_ADDRESS_MIN      ((rt_byte *)0x0000000140000000)
@@ -8861,6 +13380,53 @@ rt_time get_time()
 
 #endif /* (RT_POINTER - RT_ADDRESS) */
 
+#ifdef RT_HEAP_SIZE
+
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <asm/prctl.h>
+
+#define RT_HEAP_MAP         MAP_FIXED /* within reserved heap region */
+
+/*
+ * Reserve 4GB-aligned heap region and point GS base of the calling thread
+ * to its start, so that in-heap 32-bit addresses become offsets from it.
+ */
+rt_void sys_heap()
+{
+    rt_byte *ptr = (rt_byte *)mmap(RT_NULL, 2 * RT_HEAP_SIZE, PROT_NONE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (ptr == (rt_byte *)MAP_FAILED)
+    {
+        RT_LOGE("heap reserve failed, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    s_heap = (rt_byte *)(((rt_full)ptr + RT_HEAP_SIZE - 1) & ~(RT_HEAP_SIZE - 1));
+
+    /* release unaligned head and tail of the reserved region */
+    if (s_heap > ptr)
+    {
+        munmap(ptr, s_heap - ptr);
+    }
+    munmap(s_heap + RT_HEAP_SIZE, ptr + RT_HEAP_SIZE - s_heap);
+
+    if (syscall(SYS_arch_prctl, ARCH_SET_GS, (rt_full)s_heap) != 0)
+    {
+        RT_LOGE("heap base setup failed, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    s_ptr = RT_ADDRESS_MIN;
+}
+
+#else /* RT_HEAP_SIZE */
+
+#define RT_HEAP_MAP         0
+
+#endif /* RT_HEAP_SIZE */
+
 /*
  * Allocate memory from system heap.
  * Not thread-safe due to common static ptr.
@@ -8869,6 +13435,15 @@ rt_pntr sys_alloc(rt_size size)
 {
 #if (RT_POINTER - RT_ADDRESS) != 0
 
+#ifdef RT_HEAP_SIZE
+
+    if (s_heap == RT_NULL)
+    {
+        sys_heap();
+    }
+
+#endif /* RT_HEAP_SIZE */
+
     /* loop around RT_ADDRESS_MAX boundary */
     /* in 64/32-bit hybrid mode addresses can't have sign bit
      * as MIPS64 sign-extends all 32-bit mem-loads by default */
@@ -8878,7 +13453,7 @@ rt_pntr sys_alloc(rt_size size)
     }
 
     rt_pntr ptr = mmap(s_ptr, size, PROT_READ | PROT_WRITE,
-                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                  MAP_PRIVATE | MAP_ANONYMOUS | RT_HEAP_MAP, -1, 0);
 
     /* advance with allocation granularity */
     /* in case when page-size differs from default 4096 bytes
@@ -8923,8 +13498,18 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
 {
 #if (RT_POINTER - RT_ADDRESS) != 0
 
+#ifdef RT_HEAP_SIZE
+
+    /* keep the range reserved within heap region */
+    mmap(ptr, size, PROT_NONE,
+         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | RT_HEAP_MAP, -1, 0);
+
+#else /* RT_HEAP_SIZE */
+
     munmap(ptr, size);
 
+#endif /* RT_HEAP_SIZE */
+
 #else /* (RT_POINTER - RT_ADDRESS) */
 
     free(ptr);
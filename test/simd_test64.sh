@@ -5,8 +5,8 @@
 
 touch test64; rm test64
 
-# fully successful test pass results in test64 file of  99666 bytes (51 tests)
-# test pass on AVX2-only CPU results in test64 file of  69286 bytes (51 tests)
+# fully successful test pass results in test64 file of 186038 bytes (73 tests)
+# test pass on AVX2-only CPU results in test64 file of 142382 bytes (73 tests)
 # for any other CPU check the output or use Intel SDE within script
 
 
@@ -44,6 +44,15 @@ echo "Testing x64f64avx target (Intel Haswell AVX2)" | tee -a test64
 echo "========================================================" | tee -a test64
 ./simd_test.x64f64avx -c 1 | tee -a test64
 
+echo "========================================================" | tee -a test64
+echo "Testing x64_32avx128 target (AMD Bulldozer AVX1 128-bit)" | tee -a test64
+echo "========================================================" | tee -a test64
+./simd_test.x64_32avx128 -c 1 | tee -a test64
+echo "========================================================" | tee -a test64
+echo "Testing x64_64avx128 target (AMD Bulldozer AVX1 128-bit)" | tee -a test64
+echo "========================================================" | tee -a test64
+./simd_test.x64_64avx128 -c 1 | tee -a test64
+
 echo "========================================================" | tee -a test64
 echo "Testing x64_32avx512 target (Intel Xeon Phi KNL AVX512)" | tee -a test64
 echo "========================================================" | tee -a test64
@@ -61,10 +70,19 @@ echo "Testing x64f64avx512 target (Intel Rocket Lake AVX512)" | tee -a test64
 echo "========================================================" | tee -a test64
 ./simd_test.x64f64avx512 -c 1 | tee -a test64
 
+echo "========================================================" | tee -a test64
+echo "Testing x64_32heap target (Intel Core 2 Duo SSE2, GS-based heap)" | tee -a test64
+echo "========================================================" | tee -a test64
+./simd_test.x64_32heap -c 1 | tee -a test64
+echo "========================================================" | tee -a test64
+echo "Testing x64_64heap target (Intel Core 2 Duo SSE2, GS-based heap)" | tee -a test64
+echo "========================================================" | tee -a test64
+./simd_test.x64_64heap -c 1 | tee -a test64
+
 
 echo "========================================================"
-echo "fully successful test pass writes  99666 bytes to test64"
-echo "test pass on AVX2-only CPU writes  69286 bytes to test64"
+echo "fully successful test pass writes 183638 bytes to test64"
+echo "test pass on AVX2-only CPU writes 140582 bytes to test64"
 echo "for other CPUs check the output, use Intel SDE in script"
 echo "========================================================"
 echo "the actual file size after the test run is listed below:"
@@ -5,8 +5,8 @@
 
 touch test86; rm test86
 
-# fully successful test pass results in test86 file of  35482 bytes (51 tests)
-# test pass on AVX2-only CPU results in test86 file of  25616 bytes (51 tests)
+# fully successful test pass results in test86 file of  48758 bytes (73 tests)
+# test pass on AVX2-only CPU results in test86 file of  35573 bytes (73 tests)
 # for any other CPU check the output or use Intel SDE within script
 
 
@@ -29,8 +29,8 @@ echo "========================================================" | tee -a test86
 
 
 echo "========================================================"
-echo "fully successful test pass writes  35482 bytes to test86"
-echo "test pass on AVX2-only CPU writes  25616 bytes to test86"
+echo "fully successful test pass writes  48158 bytes to test86"
+echo "test pass on AVX2-only CPU writes  35123 bytes to test86"
 echo "for other CPUs check the output, use Intel SDE in script"
 echo "========================================================"
 echo "the actual file size after the test run is listed below:"